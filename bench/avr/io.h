@@ -0,0 +1,88 @@
+/*
+  avr/io.h - host shim of the AVR register file for the benchmark harness
+  Part of Grbl
+
+  The MIT License (MIT)
+
+  GRBL(tm) - Embedded CNC g-code interpreter and motion-controller
+  Copyright (c) 2009-2011 Simen Svale Skogsrud
+  Copyright (c) 2011-2012 Sungeun K. Jeon
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+/* 
+  Only used by the 'make host-bench' target. The Atmega328p registers used by Grbl are plain
+  volatile variables here, defined by bench.c, so the firmware sources compile unmodified on
+  the host. Timer1 is the only register the harness interprets, to track the simulated time.
+*/
+
+#ifndef bench_avr_io_h
+#define bench_avr_io_h
+
+#include <stdint.h>
+
+#define BENCH_AVR_REGISTERS(REG8,REG16) \
+  REG8(DDRA) REG8(PORTA) REG8(PINA) REG8(DDRB) REG8(PORTB) REG8(PINB) \
+  REG8(DDRC) REG8(PORTC) REG8(PINC) REG8(DDRD) REG8(PORTD) REG8(PIND) \
+  REG8(DDRK) REG8(PORTK) REG8(PINK) \
+  REG8(TCCR0A) REG8(TCCR0B) REG8(TCNT0) REG8(OCR0A) REG8(TIMSK0) REG8(TIFR0) \
+  REG8(TCCR1A) REG8(TCCR1B) REG16(OCR1A) REG16(TCNT1) REG8(TIMSK1) \
+  REG8(TCCR2A) REG8(TCCR2B) REG8(TCNT2) REG8(OCR2A) REG8(TIMSK2) REG8(TIFR2) \
+  REG8(PCICR) REG8(PCMSK0) REG8(PCMSK1) REG8(PCMSK2) \
+  REG8(UCSR0A) REG8(UCSR0B) REG8(UBRR0H) REG8(UBRR0L) REG8(UDR0) \
+  REG8(EECR) REG8(EEDR) REG16(EEAR) REG8(SPMCSR) REG8(SREG)
+
+#define BENCH_EXTERN_REG8(r) extern volatile uint8_t r;
+#define BENCH_EXTERN_REG16(r) extern volatile uint16_t r;
+BENCH_AVR_REGISTERS(BENCH_EXTERN_REG8,BENCH_EXTERN_REG16)
+
+// Register bit positions, as defined by the Atmega328p datasheet.
+#define WGM10 0
+#define WGM11 1
+#define WGM12 3
+#define WGM13 4
+#define COM1B0 4
+#define COM1A0 6
+#define CS00 0
+#define CS01 1
+#define CS02 2
+#define CS10 0
+#define CS21 1
+#define TOIE0 0
+#define TOV0 0
+#define OCIE1A 1
+#define TOIE2 0
+#define OCIE2A 1
+#define PCIE0 0
+#define PCIE1 1
+#define PCIE2 2
+#define U2X0 1
+#define TXEN0 3
+#define RXEN0 4
+#define UDRIE0 5
+#define RXCIE0 7
+#define EERE 0
+#define EEPE 1
+#define EEMPE 2
+#define EERIE 3
+#define SELFPRGEN 0
+#define SREG_I 7
+
+#endif
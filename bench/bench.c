@@ -0,0 +1,392 @@
+/*
+  bench.c - host-native benchmark harness for the g-code parser, planner and stepper algorithm
+  Part of Grbl
+
+  The MIT License (MIT)
+
+  GRBL(tm) - Embedded CNC g-code interpreter and motion-controller
+  Copyright (c) 2009-2011 Simen Svale Skogsrud
+  Copyright (c) 2011-2012 Sungeun K. Jeon
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+/*
+  Feeds recorded g-code programs through the unmodified gc_execute_line(), motion control,
+  planner and stepper segment generator and ISR, compiled natively for the host with the thin
+  shims in bench/ in place of the AVR headers. Built and run on the corpus in bench/gcode by
+  'make host-bench', or run directly as:
+
+    bench/host-bench [-c] [-t] [-r repeats] file.nc [file.nc ...]
+
+  The stepper ISR is simulated by calling it in software whenever the main program waits on the
+  planner, i.e. for a full block buffer, a synchronize, or a dwell. So, the planner always works
+  with a full buffer, like during a continuously streamed job. The simulated machine time is
+  accumulated from the Timer1 compare value and prescaler that the ISR runs at.
+
+  With -c, the programs are run in the g-code check mode of '$C', which locks out the planner and
+  motion, to time the g-code parser and executor on their own. With -t, the programs are run in the
+  cycle time estimate mode of '$T' instead, to compare the estimated to the simulated machine time.
+  This requires ENABLE_CYCLE_TIME_ESTIMATE, e.g. with make HOST_CC="cc -DENABLE_CYCLE_TIME_ESTIMATE".
+
+  The host timings are only meaningful relative to each other, as a measure of whether a change
+  made the parser or planner faster or slower. The ISR iteration and step counts are exact and
+  are the same as on the Arduino for the same settings.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <avr/io.h>
+#include "nuts_bolts.h"
+#include "settings.h"
+#include "planner.h"
+#include "stepper.h"
+#include "gcode.h"
+#include "motion_control.h"
+#include "protocol.h"
+#include "report.h"
+#include "spindle_control.h"
+#include "coolant_control.h"
+#include "limits.h"
+
+// Define the AVR register file variables. See bench/avr/io.h.
+#define BENCH_DEFINE_REG8(r) volatile uint8_t r;
+#define BENCH_DEFINE_REG16(r) volatile uint16_t r;
+BENCH_AVR_REGISTERS(BENCH_DEFINE_REG8,BENCH_DEFINE_REG16)
+
+// Declare system global variable structure and the settings, normally in main.c and settings.c.
+system_t sys;
+settings_t settings;
+
+// Coordinate system data, normally stored in EEPROM.
+static float coord_data[SETTING_INDEX_NCOORD+1][N_AXIS];
+
+// The stepper driver interrupt in stepper.c. Called as a function by the shim ISR() macro.
+void TIMER1_COMPA_vect(void);
+
+typedef struct {
+  uint32_t calls;
+  uint64_t elapsed;     // Total time in section (nsec)
+  uint64_t start;       // Start time of the current call (nsec)
+} profile_t;
+
+typedef struct {
+  profile_t profile[N_PROFILE];
+  uint32_t lines;           // G-code lines executed
+  uint32_t errors;          // Lines returning an error status
+  uint32_t line_number;     // Current line in file. For error messages.
+  uint64_t isr_iterations;  // Stepper ISR calls
+  uint64_t steps;           // Axis steps output by the stepper ISR
+  uint64_t stepper_time;    // Time spent simulating the stepper ISR (nsec)
+  double machine_time;      // Simulated machine time (sec)
+  uint32_t runtime_blocks;  // plan_buffer_line() calls seen by the last runtime call
+  double estimate_time;     // Cycle time estimate of the programs ended so far (sec)
+} bench_t;
+static bench_t bench;
+static uint8_t bench_state = STATE_IDLE; // Idle, or the check or estimate mode the programs run in
+
+static uint64_t bench_clock()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return((uint64_t)ts.tv_sec*1000000000ULL + ts.tv_nsec);
+}
+
+void bench_profile_begin(uint8_t id) { bench.profile[id].start = bench_clock(); }
+
+void bench_profile_end(uint8_t id)
+{
+  bench.profile[id].elapsed += bench_clock()-bench.profile[id].start;
+  bench.profile[id].calls++;
+}
+
+// Loads the default settings of the machine selected in config.h. Mirrors settings_reset().
+static void bench_settings_reset()
+{
+  memset(&settings, 0, sizeof(settings));
+  settings.steps_per_mm[X_AXIS] = DEFAULT_X_STEPS_PER_MM;
+  settings.steps_per_mm[Y_AXIS] = DEFAULT_Y_STEPS_PER_MM;
+  settings.steps_per_mm[Z_AXIS] = DEFAULT_Z_STEPS_PER_MM;
+  settings.pulse_microseconds = DEFAULT_STEP_PULSE_MICROSECONDS;
+  settings.default_feed_rate = DEFAULT_FEEDRATE;
+  settings.default_seek_rate = DEFAULT_RAPID_FEEDRATE;
+  settings.acceleration = DEFAULT_ACCELERATION;
+  settings.max_rate[X_AXIS] = DEFAULT_X_MAX_RATE;
+  settings.max_rate[Y_AXIS] = DEFAULT_Y_MAX_RATE;
+  settings.max_rate[Z_AXIS] = DEFAULT_Z_MAX_RATE;
+  settings.max_acceleration[X_AXIS] = DEFAULT_X_ACCELERATION;
+  settings.max_acceleration[Y_AXIS] = DEFAULT_Y_ACCELERATION;
+  settings.max_acceleration[Z_AXIS] = DEFAULT_Z_ACCELERATION;
+  #if N_AXIS > 3
+    settings.steps_per_mm[A_AXIS] = DEFAULT_A_STEPS_PER_MM;
+    settings.max_rate[A_AXIS] = DEFAULT_A_MAX_RATE;
+    settings.max_acceleration[A_AXIS] = DEFAULT_A_ACCELERATION;
+  #endif
+  #if N_AXIS > 4
+    settings.steps_per_mm[B_AXIS] = DEFAULT_B_STEPS_PER_MM;
+    settings.max_rate[B_AXIS] = DEFAULT_B_MAX_RATE;
+    settings.max_acceleration[B_AXIS] = DEFAULT_B_ACCELERATION;
+  #endif
+  settings.mm_per_arc_segment = DEFAULT_MM_PER_ARC_SEGMENT;
+  settings.invert_mask = DEFAULT_STEPPING_INVERT_MASK;
+  settings.junction_deviation = DEFAULT_JUNCTION_DEVIATION;
+  // The harness always auto-starts cycles. Nothing else would start them.
+  settings.flags = BITFLAG_AUTO_START;
+  if (DEFAULT_REPORT_INCHES) { settings.flags |= BITFLAG_REPORT_INCHES; }
+  settings.homing_dir_mask = DEFAULT_HOMING_DIR_MASK;
+  settings.homing_feed_rate = DEFAULT_HOMING_FEEDRATE;
+  settings.homing_seek_rate = DEFAULT_HOMING_RAPID_FEEDRATE;
+  settings.homing_debounce_delay = DEFAULT_HOMING_DEBOUNCE_DELAY;
+  settings.homing_pulloff = DEFAULT_HOMING_PULLOFF;
+  settings.stepper_idle_lock_time = DEFAULT_STEPPER_IDLE_LOCK_TIME;
+  settings.decimal_places = DEFAULT_DECIMAL_PLACES;
+  settings.n_arc_correction = DEFAULT_N_ARC_CORRECTION;
+  settings.arc_tolerance = DEFAULT_ARC_TOLERANCE;
+  settings.jerk = DEFAULT_JERK;
+  settings.status_report_interval = DEFAULT_STATUS_REPORT_INTERVAL;
+}
+
+void settings_write_coord_data(uint8_t coord_select, float *coord)
+{
+  memcpy(coord_data[coord_select], coord, sizeof(float)*N_AXIS);
+}
+
+uint8_t settings_read_coord_data(uint8_t coord_select, float *coord)
+{
+  memcpy(coord, coord_data[coord_select], sizeof(float)*N_AXIS);
+  return(true);
+}
+
+void report_status_message(uint8_t status_code)
+{
+  if (status_code != STATUS_OK) {
+    bench.errors++;
+    fprintf(stderr, "  line %u: error %u\n", bench.line_number, status_code);
+  }
+}
+
+void limits_go_home() { }
+
+#ifdef ENABLE_CYCLE_TIME_ESTIMATE
+// Returns the cycle time estimate accumulated by the planner since the last reset.
+static double bench_estimate_time()
+{
+  double time = plan_estimate.rapid_time+plan_estimate.dwell_time+plan_estimate.other_time;
+  uint8_t idx;
+  for (idx=0; idx<ESTIMATE_FEED_RATES; idx++) { time += plan_estimate.feed_time[idx]; }
+  return(time);
+}
+
+// Called at a program end in the estimate mode, before the reset clears the planner estimate.
+void report_cycle_time_estimate() { bench.estimate_time += bench_estimate_time(); }
+#endif
+
+// Executes the stepper ISR until the planner releases a block or the steppers go idle. Keeps
+// the segment buffer full in between, as the main program would.
+static void bench_run_stepper()
+{
+  static const uint16_t prescaler[8] = { 0, 1, 8, 64, 256, 1024, 0, 0 };
+  uint64_t start = bench_clock();
+  block_t *block = plan_get_current_block();
+  int32_t position[N_AXIS];
+  uint8_t idx;
+  while ((TIMSK1 & (1<<OCIE1A)) && (block == plan_get_current_block())) {
+    memcpy(position, sys.position, sizeof(position));
+    bench.machine_time += (double)OCR1A*prescaler[TCCR1B & 0x07]/F_CPU;
+    TIMER1_COMPA_vect();
+    bench.isr_iterations++;
+    for (idx=0; idx<N_AXIS; idx++) { bench.steps += labs(sys.position[idx]-position[idx]); }
+    st_prep_buffer();
+  }
+  bench.stepper_time += bench_clock()-start;
+}
+
+// Replaces the runtime protocol of protocol.c. Only the stepper related flags are ever set.
+void protocol_execute_runtime()
+{
+  st_prep_buffer();
+  #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+    if ((sys.state == STATE_ESTIMATE) && plan_check_full_buffer()) { plan_estimate_current_block(); }
+  #endif
+
+  // Only run the steppers when the main program is waiting, i.e. called twice without a new block.
+  uint32_t blocks = bench.profile[PROFILE_PLAN_BUFFER_LINE].calls;
+  if (blocks == bench.runtime_blocks) { bench_run_stepper(); }
+  bench.runtime_blocks = blocks;
+
+  if (sys.execute & EXEC_CYCLE_STOP) {
+    bit_false(sys.execute,EXEC_CYCLE_STOP);
+    st_cycle_reinitialize();
+  }
+}
+
+// Filters a line like protocol_process() does, removing whitespace and comments and capitalizing
+// all letters, so gc_execute_line() sees exactly the same input as in the firmware.
+static uint8_t bench_filter_line(char *dest, const char *src)
+{
+  uint8_t char_counter = 0;
+  uint8_t iscomment = false;
+  char c;
+  while ((c = *src++) != 0) {
+    if (iscomment) {
+      if (c == ')') { iscomment = false; }
+    } else if ((c <= ' ') || (c == '/')) {
+      // Throw away whitepace, control characters and block deletes
+    } else if (c == '(') {
+      iscomment = true;
+    } else if (char_counter >= LINE_BUFFER_SIZE-1) {
+      return(STATUS_OVERFLOW);
+    } else if (c >= 'a' && c <= 'z') {
+      dest[char_counter++] = c-'a'+'A';
+    } else {
+      dest[char_counter++] = c;
+    }
+  }
+  dest[char_counter] = 0;
+  return(STATUS_OK);
+}
+
+static void bench_reset()
+{
+  static bench_t bench_cleared;
+  bench = bench_cleared;
+  memset(&sys, 0, sizeof(sys));
+  memset(coord_data, 0, sizeof(coord_data));
+  bench_settings_reset();
+  plan_init();
+  gc_init();
+  mc_init();
+  st_reset();
+  sys_sync_current_position();
+  sys.feed_override = 100;
+  sys.rapid_override = 100;
+  sys.state = bench_state;
+  sys.auto_start = true;
+}
+
+// Re-initializes the system after a reset, as main() does, e.g. for a program end M2/M30 before
+// the next repeat of a file. The machine position is kept.
+static void bench_soft_reset()
+{
+  plan_init();
+  gc_init();
+  mc_init();
+  st_reset();
+  sys_sync_current_position();
+  sys.abort = false;
+  sys.execute = 0;
+  sys.override = 0;
+  sys.jog_cancel = false;
+  sys.homing_axis_lock = 0;
+  sys.feed_override = 100;
+  sys.rapid_override = 100;
+  sys.state = bench_state;
+  sys.auto_start = true;
+}
+
+static int bench_run_file(const char *filename)
+{
+  FILE *file = fopen(filename, "r");
+  if (file == NULL) {
+    perror(filename);
+    return(false);
+  }
+  char input[256];
+  char line[LINE_BUFFER_SIZE];
+  while (fgets(input, sizeof(input), file) != NULL) {
+    mc_arc_continue(); // As protocol_process() does in between reading serial data.
+    bench.line_number++;
+    uint8_t status_code = bench_filter_line(line, input);
+    if (status_code == STATUS_OK && line[0] != 0) {
+      status_code = gc_execute_line(line);
+      bench.lines++;
+    }
+    report_status_message(status_code);
+    if (sys.execute & EXEC_RESET) { bench_soft_reset(); }
+  }
+  mc_arc_synchronize();
+  mc_line_synchronize();
+  plan_synchronize(); // Finish the program, as the stream would end with an idle machine.
+  fclose(file);
+  return(true);
+}
+
+static void bench_report(const char *filename, uint64_t elapsed, uint32_t repeats)
+{
+  profile_t *pl = &bench.profile[PROFILE_PLAN_BUFFER_LINE];
+  profile_t *pr = &bench.profile[PROFILE_PLANNER_RECALCULATE];
+  uint64_t parse_plan_time = elapsed-bench.stepper_time;
+  printf("%s (x%u)\n", filename, repeats);
+  printf("  gc_execute_line()     %9u lines  %10.3f ms  %8.3f us/line  (%u errors)\n",
+    bench.lines, parse_plan_time*1e-6, bench.lines ? parse_plan_time*1e-3/bench.lines : 0, bench.errors);
+  printf("  plan_buffer_line()    %9u calls  %10.3f ms  %8.3f us/call  %10.0f calls/sec\n",
+    pl->calls, pl->elapsed*1e-6, pl->calls ? pl->elapsed*1e-3/pl->calls : 0,
+    pl->elapsed ? pl->calls*1e9/pl->elapsed : 0);
+  printf("  planner_recalculate() %9u calls  %10.3f ms  %8.3f us/call  %9.1f %% of plan_buffer_line()\n",
+    pr->calls, pr->elapsed*1e-6, pr->calls ? pr->elapsed*1e-3/pr->calls : 0,
+    pl->elapsed ? 100.0*pr->elapsed/pl->elapsed : 0);
+  printf("  stepper ISR           %9llu iter.  %10.3f ms  %8.1f iter./block  %8.3f iter./step\n",
+    (unsigned long long)bench.isr_iterations, bench.stepper_time*1e-6,
+    pl->calls ? (double)bench.isr_iterations/pl->calls : 0,
+    bench.steps ? (double)bench.isr_iterations/bench.steps : 0);
+  printf("  machine time          %12.3f sec  %9llu steps  %8.0f step/sec average\n",
+    bench.machine_time, (unsigned long long)bench.steps,
+    bench.machine_time > 0 ? bench.steps/bench.machine_time : 0);
+  #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+    if (bench_state == STATE_ESTIMATE) {
+      printf("  estimated time        %12.3f sec\n", bench.estimate_time+bench_estimate_time());
+    }
+  #endif
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t repeats = 1;
+  uint32_t n;
+  int i = 1;
+  for (; (i < argc) && (argv[i][0] == '-'); i++) {
+    if (strcmp(argv[i], "-c") == 0) {
+      bench_state = STATE_CHECK_MODE;
+    #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+    } else if (strcmp(argv[i], "-t") == 0) {
+      bench_state = STATE_ESTIMATE;
+    #endif
+    } else if ((strcmp(argv[i], "-r") == 0) && (i+1 < argc)) {
+      repeats = atoi(argv[++i]);
+      if (repeats == 0) { repeats = 1; }
+    } else {
+      break;
+    }
+  }
+  if ((i >= argc) || (argv[i][0] == '-')) {
+    fprintf(stderr, "usage: %s [-c] [-t] [-r repeats] file.nc [file.nc ...]\n", argv[0]);
+    return(1);
+  }
+  for (; i < argc; i++) {
+    bench_reset();
+    uint64_t start = bench_clock();
+    for (n = 0; n < repeats; n++) {
+      if (!bench_run_file(argv[i])) { return(1); }
+      bench.line_number = 0;
+    }
+    bench_report(argv[i], bench_clock()-start, repeats);
+  }
+  return(0);
+}
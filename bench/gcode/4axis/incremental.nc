@@ -0,0 +1,4 @@
+(A axis in incremental mode, moved twice: 200 steps)
+G21 G91 G94
+G1 A10 F1000
+G1 A10
@@ -0,0 +1,4 @@
+(A axis kept by a move without an A word: 2600 steps, A 100 and X 2500)
+G21 G90 G94
+G1 A10 F1000
+G1 X10
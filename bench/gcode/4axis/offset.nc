@@ -0,0 +1,4 @@
+(A axis in the G54 coordinate system offset by 5: 150 steps)
+G21 G90 G94
+G10 L2 P1 A5
+G54 G1 A10 F1000
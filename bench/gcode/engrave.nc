@@ -0,0 +1,1822 @@
+(Grbl benchmark corpus: V-carve engraving, many short strokes in inches)
+G20 G90 G17 G94
+M3
+G0 Z0.100
+G0 X0.0000 Y0.0000
+G1 Z-0.0100 F10
+G1 X0.0044 Y-0.0029 Z-0.0100 F30
+G1 X0.0107 Y-0.0017 Z-0.0142 F30
+G1 X0.0363 Y0.0087 Z-0.0145 F30
+G1 X0.0423 Y0.0069 Z-0.0107 F30
+G1 X0.0513 Y0.0020 Z-0.0062 F30
+G1 X0.0565 Y0.0000 Z-0.0052 F30
+G1 X0.0845 Y-0.0061 Z-0.0086 F30
+G1 X0.1035 Y-0.0042 Z-0.0133 F30
+G1 X0.1147 Y-0.0199 Z-0.0149 F30
+G1 X0.1103 Y-0.0286 Z-0.0121 F30
+G1 X0.1079 Y-0.0356 Z-0.0073 F30
+G0 Z0.100
+G0 X0.2500 Y0.0000
+G1 Z-0.0100 F10
+G1 X0.2620 Y-0.0001 Z-0.0100 F30
+G1 X0.2684 Y0.0058 Z-0.0142 F30
+G1 X0.2805 Y0.0225 Z-0.0145 F30
+G1 X0.2952 Y0.0333 Z-0.0107 F30
+G1 X0.3003 Y0.0311 Z-0.0062 F30
+G1 X0.3097 Y0.0116 Z-0.0052 F30
+G1 X0.3131 Y-0.0001 Z-0.0086 F30
+G1 X0.3204 Y-0.0141 Z-0.0133 F30
+G1 X0.3205 Y-0.0387 Z-0.0149 F30
+G1 X0.3253 Y-0.0479 Z-0.0121 F30
+G1 X0.3361 Y-0.0619 Z-0.0073 F30
+G1 X0.3591 Y-0.0621 Z-0.0050 F30
+G0 Z0.100
+G0 X0.5000 Y0.0000
+G1 Z-0.0100 F10
+G1 X0.4837 Y0.0058 Z-0.0100 F30
+G1 X0.4784 Y0.0175 Z-0.0142 F30
+G1 X0.4635 Y0.0191 Z-0.0145 F30
+G1 X0.4603 Y0.0141 Z-0.0107 F30
+G1 X0.4501 Y-0.0082 Z-0.0062 F30
+G1 X0.4543 Y-0.0204 Z-0.0052 F30
+G1 X0.4539 Y-0.0373 Z-0.0086 F30
+G1 X0.4576 Y-0.0418 Z-0.0133 F30
+G1 X0.4545 Y-0.0523 Z-0.0149 F30
+G1 X0.4555 Y-0.0579 Z-0.0121 F30
+G0 Z0.100
+G0 X0.7500 Y0.0000
+G1 Z-0.0100 F10
+G1 X0.7514 Y-0.0298 Z-0.0100 F30
+G1 X0.7597 Y-0.0376 Z-0.0142 F30
+G1 X0.7708 Y-0.0559 Z-0.0145 F30
+G1 X0.7617 Y-0.0691 Z-0.0107 F30
+G1 X0.7548 Y-0.0703 Z-0.0062 F30
+G1 X0.7396 Y-0.0517 Z-0.0052 F30
+G1 X0.7417 Y-0.0415 Z-0.0086 F30
+G1 X0.7537 Y-0.0177 Z-0.0133 F30
+G1 X0.7693 Y-0.0161 Z-0.0149 F30
+G1 X0.7957 Y-0.0103 Z-0.0121 F30
+G1 X0.8103 Y0.0117 Z-0.0073 F30
+G1 X0.8236 Y0.0181 Z-0.0050 F30
+G1 X0.8505 Y0.0211 Z-0.0073 F30
+G1 X0.8533 Y0.0286 Z-0.0121 F30
+G1 X0.8624 Y0.0328 Z-0.0150 F30
+G1 X0.8786 Y0.0294 Z-0.0133 F30
+G1 X0.8894 Y0.0295 Z-0.0086 F30
+G0 Z0.100
+G0 X1.0000 Y0.0000
+G1 Z-0.0100 F10
+G1 X1.0108 Y0.0167 Z-0.0100 F30
+G1 X1.0169 Y0.0206 Z-0.0142 F30
+G1 X1.0211 Y0.0490 Z-0.0145 F30
+G1 X1.0159 Y0.0716 Z-0.0107 F30
+G1 X1.0127 Y0.0981 Z-0.0062 F30
+G1 X0.9924 Y0.1058 Z-0.0052 F30
+G0 Z0.100
+G0 X1.2500 Y0.0000
+G1 Z-0.0100 F10
+G1 X1.2459 Y0.0053 Z-0.0100 F30
+G1 X1.2413 Y0.0085 Z-0.0142 F30
+G1 X1.2419 Y0.0179 Z-0.0145 F30
+G1 X1.2518 Y0.0261 Z-0.0107 F30
+G1 X1.2555 Y0.0246 Z-0.0062 F30
+G1 X1.2578 Y0.0184 Z-0.0052 F30
+G1 X1.2579 Y0.0138 Z-0.0086 F30
+G1 X1.2739 Y0.0018 Z-0.0133 F30
+G1 X1.2748 Y-0.0088 Z-0.0149 F30
+G1 X1.2710 Y-0.0217 Z-0.0121 F30
+G1 X1.2468 Y-0.0314 Z-0.0073 F30
+G1 X1.2467 Y-0.0475 Z-0.0050 F30
+G1 X1.2465 Y-0.0538 Z-0.0073 F30
+G1 X1.2356 Y-0.0607 Z-0.0121 F30
+G0 Z0.100
+G0 X1.5000 Y0.0000
+G1 Z-0.0100 F10
+G1 X1.4835 Y-0.0056 Z-0.0100 F30
+G1 X1.4568 Y0.0052 Z-0.0142 F30
+G1 X1.4402 Y0.0195 Z-0.0145 F30
+G1 X1.4174 Y0.0130 Z-0.0107 F30
+G1 X1.3972 Y0.0172 Z-0.0062 F30
+G1 X1.3874 Y0.0413 Z-0.0052 F30
+G1 X1.3759 Y0.0664 Z-0.0086 F30
+G1 X1.3751 Y0.0762 Z-0.0133 F30
+G1 X1.3720 Y0.0930 Z-0.0149 F30
+G1 X1.3623 Y0.1104 Z-0.0121 F30
+G0 Z0.100
+G0 X1.7500 Y0.0000
+G1 Z-0.0100 F10
+G1 X1.7683 Y0.0170 Z-0.0100 F30
+G1 X1.7696 Y0.0402 Z-0.0142 F30
+G1 X1.7811 Y0.0534 Z-0.0145 F30
+G1 X1.7852 Y0.0557 Z-0.0107 F30
+G1 X1.7944 Y0.0491 Z-0.0062 F30
+G1 X1.8023 Y0.0286 Z-0.0052 F30
+G1 X1.8179 Y0.0270 Z-0.0086 F30
+G1 X1.8353 Y0.0510 Z-0.0133 F30
+G1 X1.8293 Y0.0630 Z-0.0149 F30
+G1 X1.8313 Y0.0727 Z-0.0121 F30
+G1 X1.8388 Y0.0783 Z-0.0073 F30
+G1 X1.8551 Y0.1003 Z-0.0050 F30
+G1 X1.8521 Y0.1165 Z-0.0073 F30
+G1 X1.8392 Y0.1377 Z-0.0121 F30
+G1 X1.8484 Y0.1568 Z-0.0150 F30
+G1 X1.8360 Y0.1777 Z-0.0133 F30
+G1 X1.8211 Y0.1846 Z-0.0086 F30
+G1 X1.8123 Y0.2075 Z-0.0052 F30
+G0 Z0.100
+G0 X2.0000 Y0.0000
+G1 Z-0.0100 F10
+G1 X1.9990 Y0.0227 Z-0.0100 F30
+G1 X2.0000 Y0.0460 Z-0.0142 F30
+G1 X2.0070 Y0.0502 Z-0.0145 F30
+G1 X2.0063 Y0.0548 Z-0.0107 F30
+G1 X2.0006 Y0.0699 Z-0.0062 F30
+G1 X1.9873 Y0.0846 Z-0.0052 F30
+G1 X1.9738 Y0.0939 Z-0.0086 F30
+G1 X1.9666 Y0.0905 Z-0.0133 F30
+G1 X1.9627 Y0.0880 Z-0.0149 F30
+G1 X1.9561 Y0.0661 Z-0.0121 F30
+G1 X1.9339 Y0.0586 Z-0.0073 F30
+G0 Z0.100
+G0 X2.2500 Y0.0000
+G1 Z-0.0100 F10
+G1 X2.2273 Y-0.0117 Z-0.0100 F30
+G1 X2.2170 Y-0.0094 Z-0.0142 F30
+G1 X2.2093 Y-0.0026 Z-0.0145 F30
+G1 X2.1999 Y0.0026 Z-0.0107 F30
+G1 X2.1943 Y0.0074 Z-0.0062 F30
+G1 X2.1816 Y0.0037 Z-0.0052 F30
+G1 X2.1627 Y0.0003 Z-0.0086 F30
+G1 X2.1567 Y-0.0134 Z-0.0133 F30
+G0 Z0.100
+G0 X2.5000 Y0.0000
+G1 Z-0.0100 F10
+G1 X2.5173 Y-0.0002 Z-0.0100 F30
+G1 X2.5327 Y0.0184 Z-0.0142 F30
+G1 X2.5428 Y0.0404 Z-0.0145 F30
+G1 X2.5501 Y0.0426 Z-0.0107 F30
+G1 X2.5560 Y0.0466 Z-0.0062 F30
+G1 X2.5755 Y0.0368 Z-0.0052 F30
+G1 X2.5907 Y0.0305 Z-0.0086 F30
+G1 X2.6167 Y0.0378 Z-0.0133 F30
+G1 X2.6230 Y0.0314 Z-0.0149 F30
+G1 X2.6210 Y0.0252 Z-0.0121 F30
+G1 X2.6190 Y0.0209 Z-0.0073 F30
+G1 X2.6217 Y0.0159 Z-0.0050 F30
+G1 X2.6245 Y-0.0132 Z-0.0073 F30
+G1 X2.6276 Y-0.0219 Z-0.0121 F30
+G0 Z0.100
+G0 X2.7500 Y0.0000
+G1 Z-0.0100 F10
+G1 X2.7340 Y0.0036 Z-0.0100 F30
+G1 X2.7191 Y-0.0129 Z-0.0142 F30
+G1 X2.7240 Y-0.0410 Z-0.0145 F30
+G1 X2.7167 Y-0.0580 Z-0.0107 F30
+G1 X2.7325 Y-0.0785 Z-0.0062 F30
+G1 X2.7310 Y-0.0855 Z-0.0052 F30
+G1 X2.7290 Y-0.0910 Z-0.0086 F30
+G1 X2.7241 Y-0.0943 Z-0.0133 F30
+G1 X2.7110 Y-0.1149 Z-0.0149 F30
+G1 X2.7140 Y-0.1223 Z-0.0121 F30
+G0 Z0.100
+G0 X3.0000 Y0.0000
+G1 Z-0.0100 F10
+G1 X2.9911 Y-0.0058 Z-0.0100 F30
+G1 X2.9757 Y-0.0011 Z-0.0142 F30
+G1 X2.9695 Y-0.0030 Z-0.0145 F30
+G1 X2.9667 Y-0.0108 Z-0.0107 F30
+G1 X2.9672 Y-0.0206 Z-0.0062 F30
+G1 X2.9829 Y-0.0460 Z-0.0052 F30
+G1 X2.9876 Y-0.0602 Z-0.0086 F30
+G1 X2.9874 Y-0.0666 Z-0.0133 F30
+G1 X2.9831 Y-0.0786 Z-0.0149 F30
+G1 X2.9735 Y-0.0987 Z-0.0121 F30
+G1 X2.9619 Y-0.1118 Z-0.0073 F30
+G1 X2.9348 Y-0.1220 Z-0.0050 F30
+G1 X2.9113 Y-0.1069 Z-0.0073 F30
+G1 X2.9022 Y-0.0817 Z-0.0121 F30
+G1 X2.9089 Y-0.0729 Z-0.0150 F30
+G1 X2.9062 Y-0.0646 Z-0.0133 F30
+G1 X2.8858 Y-0.0496 Z-0.0086 F30
+G0 Z0.100
+G0 X3.2500 Y0.0000
+G1 Z-0.0100 F10
+G1 X3.2488 Y-0.0078 Z-0.0100 F30
+G1 X3.2631 Y-0.0201 Z-0.0142 F30
+G1 X3.2692 Y-0.0216 Z-0.0145 F30
+G1 X3.2752 Y-0.0426 Z-0.0107 F30
+G1 X3.2758 Y-0.0485 Z-0.0062 F30
+G1 X3.2945 Y-0.0569 Z-0.0052 F30
+G1 X3.3004 Y-0.0550 Z-0.0086 F30
+G1 X3.3027 Y-0.0498 Z-0.0133 F30
+G1 X3.2957 Y-0.0356 Z-0.0149 F30
+G1 X3.2944 Y-0.0173 Z-0.0121 F30
+G1 X3.2847 Y-0.0123 Z-0.0073 F30
+G1 X3.2810 Y0.0051 Z-0.0050 F30
+G1 X3.2838 Y0.0113 Z-0.0073 F30
+G1 X3.2889 Y0.0131 Z-0.0121 F30
+G1 X3.3001 Y0.0086 Z-0.0150 F30
+G1 X3.3158 Y-0.0092 Z-0.0133 F30
+G0 Z0.100
+G0 X3.5000 Y0.0000
+G1 Z-0.0100 F10
+G1 X3.4890 Y-0.0008 Z-0.0100 F30
+G1 X3.4682 Y-0.0222 Z-0.0142 F30
+G1 X3.4639 Y-0.0208 Z-0.0145 F30
+G1 X3.4358 Y-0.0122 Z-0.0107 F30
+G1 X3.4258 Y-0.0094 Z-0.0062 F30
+G1 X3.4062 Y-0.0014 Z-0.0052 F30
+G1 X3.3852 Y-0.0007 Z-0.0086 F30
+G1 X3.3582 Y-0.0029 Z-0.0133 F30
+G1 X3.3539 Y-0.0141 Z-0.0149 F30
+G1 X3.3453 Y-0.0191 Z-0.0121 F30
+G0 Z0.100
+G0 X3.7500 Y0.0000
+G1 Z-0.0100 F10
+G1 X3.7674 Y-0.0109 Z-0.0100 F30
+G1 X3.7766 Y-0.0202 Z-0.0142 F30
+G1 X3.7745 Y-0.0272 Z-0.0145 F30
+G1 X3.7520 Y-0.0331 Z-0.0107 F30
+G1 X3.7442 Y-0.0304 Z-0.0062 F30
+G1 X3.7380 Y-0.0052 Z-0.0052 F30
+G1 X3.7187 Y0.0039 Z-0.0086 F30
+G1 X3.7128 Y0.0124 Z-0.0133 F30
+G1 X3.7111 Y0.0283 Z-0.0149 F30
+G0 Z0.100
+G0 X4.0000 Y0.0000
+G1 Z-0.0100 F10
+G1 X4.0118 Y0.0064 Z-0.0100 F30
+G1 X4.0413 Y0.0090 Z-0.0142 F30
+G1 X4.0459 Y0.0074 Z-0.0145 F30
+G1 X4.0540 Y0.0127 Z-0.0107 F30
+G1 X4.0665 Y0.0105 Z-0.0062 F30
+G1 X4.0708 Y0.0001 Z-0.0052 F30
+G1 X4.0781 Y-0.0075 Z-0.0086 F30
+G1 X4.0844 Y-0.0083 Z-0.0133 F30
+G0 Z0.100
+G0 X4.2500 Y0.0000
+G1 Z-0.0100 F10
+G1 X4.2563 Y0.0128 Z-0.0100 F30
+G1 X4.2728 Y0.0248 Z-0.0142 F30
+G1 X4.2997 Y0.0144 Z-0.0145 F30
+G1 X4.3069 Y0.0182 Z-0.0107 F30
+G1 X4.3104 Y0.0423 Z-0.0062 F30
+G1 X4.3084 Y0.0661 Z-0.0052 F30
+G1 X4.2987 Y0.0798 Z-0.0086 F30
+G0 Z0.100
+G0 X4.5000 Y0.0000
+G1 Z-0.0100 F10
+G1 X4.5009 Y-0.0051 Z-0.0100 F30
+G1 X4.5236 Y-0.0201 Z-0.0142 F30
+G1 X4.5457 Y-0.0265 Z-0.0145 F30
+G1 X4.5525 Y-0.0231 Z-0.0107 F30
+G1 X4.5673 Y-0.0145 Z-0.0062 F30
+G1 X4.5733 Y0.0097 Z-0.0052 F30
+G1 X4.5634 Y0.0261 Z-0.0086 F30
+G1 X4.5418 Y0.0280 Z-0.0133 F30
+G1 X4.5325 Y0.0243 Z-0.0149 F30
+G1 X4.5270 Y0.0294 Z-0.0121 F30
+G0 Z0.100
+G0 X4.7500 Y0.0000
+G1 Z-0.0100 F10
+G1 X4.7634 Y-0.0083 Z-0.0100 F30
+G1 X4.7631 Y-0.0128 Z-0.0142 F30
+G1 X4.7633 Y-0.0231 Z-0.0145 F30
+G1 X4.7549 Y-0.0366 Z-0.0107 F30
+G1 X4.7267 Y-0.0363 Z-0.0062 F30
+G1 X4.7229 Y-0.0414 Z-0.0052 F30
+G1 X4.7104 Y-0.0612 Z-0.0086 F30
+G1 X4.6956 Y-0.0814 Z-0.0133 F30
+G1 X4.6976 Y-0.0913 Z-0.0149 F30
+G1 X4.7049 Y-0.0981 Z-0.0121 F30
+G1 X4.7197 Y-0.1043 Z-0.0073 F30
+G0 Z0.100
+G0 X0.0000 Y0.4000
+G1 Z-0.0100 F10
+G1 X0.0012 Y0.4114 Z-0.0100 F30
+G1 X0.0202 Y0.4190 Z-0.0142 F30
+G1 X0.0386 Y0.4124 Z-0.0145 F30
+G1 X0.0540 Y0.3981 Z-0.0107 F30
+G1 X0.0733 Y0.3924 Z-0.0062 F30
+G1 X0.0798 Y0.3772 Z-0.0052 F30
+G1 X0.0904 Y0.3499 Z-0.0086 F30
+G1 X0.0851 Y0.3419 Z-0.0133 F30
+G1 X0.0721 Y0.3236 Z-0.0149 F30
+G1 X0.0576 Y0.3167 Z-0.0121 F30
+G1 X0.0436 Y0.2904 Z-0.0073 F30
+G1 X0.0392 Y0.2791 Z-0.0050 F30
+G0 Z0.100
+G0 X0.2500 Y0.4000
+G1 Z-0.0100 F10
+G1 X0.2501 Y0.3841 Z-0.0100 F30
+G1 X0.2706 Y0.3633 Z-0.0142 F30
+G1 X0.2773 Y0.3546 Z-0.0145 F30
+G1 X0.2761 Y0.3260 Z-0.0107 F30
+G1 X0.2633 Y0.3118 Z-0.0062 F30
+G1 X0.2457 Y0.3122 Z-0.0052 F30
+G1 X0.2421 Y0.3057 Z-0.0086 F30
+G0 Z0.100
+G0 X0.5000 Y0.4000
+G1 Z-0.0100 F10
+G1 X0.4876 Y0.3815 Z-0.0100 F30
+G1 X0.4618 Y0.3724 Z-0.0142 F30
+G1 X0.4574 Y0.3710 Z-0.0145 F30
+G1 X0.4468 Y0.3841 Z-0.0107 F30
+G1 X0.4404 Y0.3941 Z-0.0062 F30
+G1 X0.4442 Y0.4064 Z-0.0052 F30
+G1 X0.4616 Y0.4255 Z-0.0086 F30
+G1 X0.4836 Y0.4172 Z-0.0133 F30
+G1 X0.4900 Y0.4203 Z-0.0149 F30
+G1 X0.4922 Y0.4427 Z-0.0121 F30
+G1 X0.4834 Y0.4502 Z-0.0073 F30
+G1 X0.4759 Y0.4622 Z-0.0050 F30
+G1 X0.4569 Y0.4586 Z-0.0073 F30
+G1 X0.4419 Y0.4609 Z-0.0121 F30
+G1 X0.4379 Y0.4642 Z-0.0150 F30
+G1 X0.4397 Y0.4899 Z-0.0133 F30
+G0 Z0.100
+G0 X0.7500 Y0.4000
+G1 Z-0.0100 F10
+G1 X0.7208 Y0.3999 Z-0.0100 F30
+G1 X0.7087 Y0.4017 Z-0.0142 F30
+G1 X0.6873 Y0.3899 Z-0.0145 F30
+G1 X0.6828 Y0.3883 Z-0.0107 F30
+G1 X0.6746 Y0.3765 Z-0.0062 F30
+G1 X0.6799 Y0.3589 Z-0.0052 F30
+G1 X0.6774 Y0.3533 Z-0.0086 F30
+G1 X0.6859 Y0.3414 Z-0.0133 F30
+G1 X0.6919 Y0.3366 Z-0.0149 F30
+G1 X0.7081 Y0.3401 Z-0.0121 F30
+G0 Z0.100
+G0 X1.0000 Y0.4000
+G1 Z-0.0100 F10
+G1 X1.0096 Y0.4087 Z-0.0100 F30
+G1 X1.0321 Y0.4143 Z-0.0142 F30
+G1 X1.0341 Y0.4249 Z-0.0145 F30
+G1 X1.0318 Y0.4365 Z-0.0107 F30
+G1 X1.0271 Y0.4500 Z-0.0062 F30
+G1 X1.0308 Y0.4573 Z-0.0052 F30
+G1 X1.0562 Y0.4681 Z-0.0086 F30
+G1 X1.0651 Y0.4719 Z-0.0133 F30
+G1 X1.0711 Y0.5012 Z-0.0149 F30
+G1 X1.0735 Y0.5084 Z-0.0121 F30
+G1 X1.0790 Y0.5116 Z-0.0073 F30
+G1 X1.0853 Y0.5124 Z-0.0050 F30
+G1 X1.0948 Y0.5073 Z-0.0073 F30
+G1 X1.1204 Y0.4987 Z-0.0121 F30
+G0 Z0.100
+G0 X1.2500 Y0.4000
+G1 Z-0.0100 F10
+G1 X1.2607 Y0.3792 Z-0.0100 F30
+G1 X1.2582 Y0.3684 Z-0.0142 F30
+G1 X1.2646 Y0.3527 Z-0.0145 F30
+G1 X1.2717 Y0.3414 Z-0.0107 F30
+G1 X1.2867 Y0.3319 Z-0.0062 F30
+G1 X1.3126 Y0.3355 Z-0.0052 F30
+G1 X1.3307 Y0.3151 Z-0.0086 F30
+G1 X1.3398 Y0.2964 Z-0.0133 F30
+G1 X1.3432 Y0.2848 Z-0.0149 F30
+G1 X1.3684 Y0.2700 Z-0.0121 F30
+G1 X1.3706 Y0.2551 Z-0.0073 F30
+G1 X1.3882 Y0.2374 Z-0.0050 F30
+G1 X1.4040 Y0.2429 Z-0.0073 F30
+G1 X1.4257 Y0.2250 Z-0.0121 F30
+G1 X1.4424 Y0.2308 Z-0.0150 F30
+G1 X1.4576 Y0.2349 Z-0.0133 F30
+G1 X1.4634 Y0.2428 Z-0.0086 F30
+G0 Z0.100
+G0 X1.5000 Y0.4000
+G1 Z-0.0100 F10
+G1 X1.4761 Y0.3845 Z-0.0100 F30
+G1 X1.4668 Y0.3659 Z-0.0142 F30
+G1 X1.4695 Y0.3502 Z-0.0145 F30
+G1 X1.4710 Y0.3454 Z-0.0107 F30
+G1 X1.4793 Y0.3397 Z-0.0062 F30
+G1 X1.4984 Y0.3480 Z-0.0052 F30
+G1 X1.5057 Y0.3476 Z-0.0086 F30
+G1 X1.5220 Y0.3351 Z-0.0133 F30
+G0 Z0.100
+G0 X1.7500 Y0.4000
+G1 Z-0.0100 F10
+G1 X1.7409 Y0.3924 Z-0.0100 F30
+G1 X1.7426 Y0.3836 Z-0.0142 F30
+G1 X1.7334 Y0.3609 Z-0.0145 F30
+G1 X1.7154 Y0.3611 Z-0.0107 F30
+G1 X1.7111 Y0.3507 Z-0.0062 F30
+G1 X1.6920 Y0.3333 Z-0.0052 F30
+G1 X1.6744 Y0.3312 Z-0.0086 F30
+G1 X1.6698 Y0.3301 Z-0.0133 F30
+G1 X1.6489 Y0.3297 Z-0.0149 F30
+G1 X1.6444 Y0.3375 Z-0.0121 F30
+G1 X1.6237 Y0.3401 Z-0.0073 F30
+G1 X1.6195 Y0.3490 Z-0.0050 F30
+G1 X1.6159 Y0.3622 Z-0.0073 F30
+G1 X1.6106 Y0.3837 Z-0.0121 F30
+G1 X1.6013 Y0.3933 Z-0.0150 F30
+G1 X1.5992 Y0.3969 Z-0.0133 F30
+G1 X1.5987 Y0.4229 Z-0.0086 F30
+G0 Z0.100
+G0 X2.0000 Y0.4000
+G1 Z-0.0100 F10
+G1 X1.9909 Y0.4080 Z-0.0100 F30
+G1 X1.9809 Y0.4076 Z-0.0142 F30
+G1 X1.9617 Y0.4215 Z-0.0145 F30
+G1 X1.9491 Y0.4474 Z-0.0107 F30
+G1 X1.9453 Y0.4554 Z-0.0062 F30
+G1 X1.9486 Y0.4699 Z-0.0052 F30
+G1 X1.9436 Y0.4981 Z-0.0086 F30
+G0 Z0.100
+G0 X2.2500 Y0.4000
+G1 Z-0.0100 F10
+G1 X2.2500 Y0.3954 Z-0.0100 F30
+G1 X2.2535 Y0.3810 Z-0.0142 F30
+G1 X2.2595 Y0.3745 Z-0.0145 F30
+G1 X2.2726 Y0.3562 Z-0.0107 F30
+G1 X2.2738 Y0.3494 Z-0.0062 F30
+G1 X2.2676 Y0.3438 Z-0.0052 F30
+G1 X2.2467 Y0.3439 Z-0.0086 F30
+G1 X2.2305 Y0.3431 Z-0.0133 F30
+G0 Z0.100
+G0 X2.5000 Y0.4000
+G1 Z-0.0100 F10
+G1 X2.4899 Y0.3908 Z-0.0100 F30
+G1 X2.4819 Y0.3880 Z-0.0142 F30
+G1 X2.4746 Y0.3965 Z-0.0145 F30
+G1 X2.4645 Y0.4235 Z-0.0107 F30
+G1 X2.4796 Y0.4484 Z-0.0062 F30
+G1 X2.4922 Y0.4526 Z-0.0052 F30
+G1 X2.5038 Y0.4751 Z-0.0086 F30
+G1 X2.5069 Y0.4794 Z-0.0133 F30
+G1 X2.5158 Y0.4898 Z-0.0149 F30
+G1 X2.5131 Y0.4984 Z-0.0121 F30
+G0 Z0.100
+G0 X2.7500 Y0.4000
+G1 Z-0.0100 F10
+G1 X2.7471 Y0.3798 Z-0.0100 F30
+G1 X2.7333 Y0.3649 Z-0.0142 F30
+G1 X2.7219 Y0.3572 Z-0.0145 F30
+G1 X2.7002 Y0.3451 Z-0.0107 F30
+G1 X2.6924 Y0.3498 Z-0.0062 F30
+G1 X2.6928 Y0.3695 Z-0.0052 F30
+G1 X2.6972 Y0.3815 Z-0.0086 F30
+G1 X2.6937 Y0.3853 Z-0.0133 F30
+G1 X2.6724 Y0.3905 Z-0.0149 F30
+G1 X2.6641 Y0.3823 Z-0.0121 F30
+G1 X2.6590 Y0.3635 Z-0.0073 F30
+G0 Z0.100
+G0 X3.0000 Y0.4000
+G1 Z-0.0100 F10
+G1 X3.0015 Y0.3956 Z-0.0100 F30
+G1 X2.9966 Y0.3800 Z-0.0142 F30
+G1 X3.0171 Y0.3598 Z-0.0145 F30
+G1 X3.0223 Y0.3506 Z-0.0107 F30
+G1 X3.0280 Y0.3348 Z-0.0062 F30
+G1 X3.0366 Y0.3331 Z-0.0052 F30
+G1 X3.0566 Y0.3449 Z-0.0086 F30
+G1 X3.0629 Y0.3682 Z-0.0133 F30
+G1 X3.0630 Y0.3807 Z-0.0149 F30
+G1 X3.0687 Y0.3928 Z-0.0121 F30
+G1 X3.0672 Y0.3987 Z-0.0073 F30
+G1 X3.0783 Y0.4195 Z-0.0050 F30
+G1 X3.0834 Y0.4221 Z-0.0073 F30
+G1 X3.0981 Y0.4111 Z-0.0121 F30
+G1 X3.1124 Y0.3854 Z-0.0150 F30
+G1 X3.1418 Y0.3812 Z-0.0133 F30
+G1 X3.1466 Y0.3772 Z-0.0086 F30
+G1 X3.1448 Y0.3604 Z-0.0052 F30
+G0 Z0.100
+G0 X3.2500 Y0.4000
+G1 Z-0.0100 F10
+G1 X3.2543 Y0.3939 Z-0.0100 F30
+G1 X3.2676 Y0.3702 Z-0.0142 F30
+G1 X3.2654 Y0.3524 Z-0.0145 F30
+G1 X3.2776 Y0.3319 Z-0.0107 F30
+G1 X3.2884 Y0.3278 Z-0.0062 F30
+G1 X3.2953 Y0.3192 Z-0.0052 F30
+G1 X3.2962 Y0.3085 Z-0.0086 F30
+G1 X3.2957 Y0.2997 Z-0.0133 F30
+G1 X3.2885 Y0.2910 Z-0.0149 F30
+G1 X3.2910 Y0.2825 Z-0.0121 F30
+G1 X3.2837 Y0.2748 Z-0.0073 F30
+G1 X3.2664 Y0.2713 Z-0.0050 F30
+G1 X3.2608 Y0.2678 Z-0.0073 F30
+G1 X3.2564 Y0.2655 Z-0.0121 F30
+G1 X3.2361 Y0.2832 Z-0.0150 F30
+G1 X3.2328 Y0.2985 Z-0.0133 F30
+G1 X3.2352 Y0.3252 Z-0.0086 F30
+G0 Z0.100
+G0 X3.5000 Y0.4000
+G1 Z-0.0100 F10
+G1 X3.5293 Y0.4001 Z-0.0100 F30
+G1 X3.5569 Y0.4058 Z-0.0142 F30
+G1 X3.5833 Y0.4031 Z-0.0145 F30
+G1 X3.5938 Y0.4007 Z-0.0107 F30
+G1 X3.6196 Y0.4129 Z-0.0062 F30
+G1 X3.6367 Y0.4034 Z-0.0052 F30
+G1 X3.6461 Y0.4014 Z-0.0086 F30
+G1 X3.6527 Y0.3975 Z-0.0133 F30
+G1 X3.6562 Y0.3874 Z-0.0149 F30
+G0 Z0.100
+G0 X3.7500 Y0.4000
+G1 Z-0.0100 F10
+G1 X3.7694 Y0.3839 Z-0.0100 F30
+G1 X3.7840 Y0.3850 Z-0.0142 F30
+G1 X3.8036 Y0.3804 Z-0.0145 F30
+G1 X3.8051 Y0.3758 Z-0.0107 F30
+G1 X3.8102 Y0.3600 Z-0.0062 F30
+G1 X3.8125 Y0.3354 Z-0.0052 F30
+G1 X3.8163 Y0.3284 Z-0.0086 F30
+G1 X3.8276 Y0.3107 Z-0.0133 F30
+G1 X3.8311 Y0.3002 Z-0.0149 F30
+G1 X3.8524 Y0.2986 Z-0.0121 F30
+G1 X3.8575 Y0.2971 Z-0.0073 F30
+G1 X3.8832 Y0.3055 Z-0.0050 F30
+G1 X3.8876 Y0.3060 Z-0.0073 F30
+G1 X3.9058 Y0.3229 Z-0.0121 F30
+G1 X3.9123 Y0.3355 Z-0.0150 F30
+G0 Z0.100
+G0 X4.0000 Y0.4000
+G1 Z-0.0100 F10
+G1 X4.0273 Y0.4026 Z-0.0100 F30
+G1 X4.0526 Y0.4003 Z-0.0142 F30
+G1 X4.0782 Y0.3919 Z-0.0145 F30
+G1 X4.0857 Y0.3887 Z-0.0107 F30
+G1 X4.0857 Y0.3703 Z-0.0062 F30
+G1 X4.0948 Y0.3442 Z-0.0052 F30
+G1 X4.0826 Y0.3282 Z-0.0086 F30
+G1 X4.0685 Y0.3184 Z-0.0133 F30
+G1 X4.0575 Y0.3211 Z-0.0149 F30
+G1 X4.0299 Y0.3263 Z-0.0121 F30
+G1 X4.0227 Y0.3415 Z-0.0073 F30
+G1 X3.9959 Y0.3527 Z-0.0050 F30
+G0 Z0.100
+G0 X4.2500 Y0.4000
+G1 Z-0.0100 F10
+G1 X4.2454 Y0.4022 Z-0.0100 F30
+G1 X4.2350 Y0.3958 Z-0.0142 F30
+G1 X4.2208 Y0.3809 Z-0.0145 F30
+G1 X4.1987 Y0.3850 Z-0.0107 F30
+G1 X4.1725 Y0.3777 Z-0.0062 F30
+G1 X4.1509 Y0.3627 Z-0.0052 F30
+G1 X4.1385 Y0.3471 Z-0.0086 F30
+G1 X4.1224 Y0.3444 Z-0.0133 F30
+G1 X4.1176 Y0.3428 Z-0.0149 F30
+G0 Z0.100
+G0 X4.5000 Y0.4000
+G1 Z-0.0100 F10
+G1 X4.5063 Y0.4047 Z-0.0100 F30
+G1 X4.5012 Y0.4294 Z-0.0142 F30
+G1 X4.5149 Y0.4526 Z-0.0145 F30
+G1 X4.5088 Y0.4732 Z-0.0107 F30
+G1 X4.5009 Y0.4828 Z-0.0062 F30
+G1 X4.4944 Y0.4973 Z-0.0052 F30
+G1 X4.4713 Y0.5046 Z-0.0086 F30
+G1 X4.4593 Y0.5040 Z-0.0133 F30
+G1 X4.4472 Y0.5113 Z-0.0149 F30
+G1 X4.4362 Y0.5244 Z-0.0121 F30
+G1 X4.4365 Y0.5285 Z-0.0073 F30
+G1 X4.4222 Y0.5358 Z-0.0050 F30
+G1 X4.4056 Y0.5472 Z-0.0073 F30
+G1 X4.3802 Y0.5430 Z-0.0121 F30
+G0 Z0.100
+G0 X4.7500 Y0.4000
+G1 Z-0.0100 F10
+G1 X4.7468 Y0.4066 Z-0.0100 F30
+G1 X4.7449 Y0.4127 Z-0.0142 F30
+G1 X4.7423 Y0.4298 Z-0.0145 F30
+G1 X4.7590 Y0.4417 Z-0.0107 F30
+G1 X4.7804 Y0.4331 Z-0.0062 F30
+G1 X4.7970 Y0.4380 Z-0.0052 F30
+G1 X4.8091 Y0.4259 Z-0.0086 F30
+G1 X4.8227 Y0.4006 Z-0.0133 F30
+G1 X4.8129 Y0.3762 Z-0.0149 F30
+G1 X4.8296 Y0.3603 Z-0.0121 F30
+G1 X4.8387 Y0.3602 Z-0.0073 F30
+G1 X4.8455 Y0.3756 Z-0.0050 F30
+G1 X4.8281 Y0.3973 Z-0.0073 F30
+G1 X4.8312 Y0.4216 Z-0.0121 F30
+G1 X4.8267 Y0.4251 Z-0.0150 F30
+G1 X4.8144 Y0.4453 Z-0.0133 F30
+G1 X4.8217 Y0.4716 Z-0.0086 F30
+G1 X4.8399 Y0.4890 Z-0.0052 F30
+G0 Z0.100
+G0 X0.0000 Y0.8000
+G1 Z-0.0100 F10
+G1 X-0.0150 Y0.8069 Z-0.0100 F30
+G1 X-0.0345 Y0.8111 Z-0.0142 F30
+G1 X-0.0437 Y0.8213 Z-0.0145 F30
+G1 X-0.0438 Y0.8358 Z-0.0107 F30
+G1 X-0.0475 Y0.8464 Z-0.0062 F30
+G1 X-0.0464 Y0.8601 Z-0.0052 F30
+G1 X-0.0527 Y0.8689 Z-0.0086 F30
+G1 X-0.0578 Y0.8705 Z-0.0133 F30
+G0 Z0.100
+G0 X0.2500 Y0.8000
+G1 Z-0.0100 F10
+G1 X0.2666 Y0.7943 Z-0.0100 F30
+G1 X0.2937 Y0.7977 Z-0.0142 F30
+G1 X0.3097 Y0.7896 Z-0.0145 F30
+G1 X0.3312 Y0.7983 Z-0.0107 F30
+G1 X0.3449 Y0.7994 Z-0.0062 F30
+G1 X0.3525 Y0.7975 Z-0.0052 F30
+G1 X0.3574 Y0.7939 Z-0.0086 F30
+G1 X0.3629 Y0.7746 Z-0.0133 F30
+G1 X0.3744 Y0.7724 Z-0.0149 F30
+G1 X0.3863 Y0.7705 Z-0.0121 F30
+G1 X0.4015 Y0.7924 Z-0.0073 F30
+G0 Z0.100
+G0 X0.5000 Y0.8000
+G1 Z-0.0100 F10
+G1 X0.5233 Y0.7977 Z-0.0100 F30
+G1 X0.5316 Y0.7897 Z-0.0142 F30
+G1 X0.5449 Y0.7830 Z-0.0145 F30
+G1 X0.5486 Y0.7793 Z-0.0107 F30
+G1 X0.5622 Y0.7647 Z-0.0062 F30
+G1 X0.5604 Y0.7596 Z-0.0052 F30
+G1 X0.5583 Y0.7479 Z-0.0086 F30
+G1 X0.5561 Y0.7301 Z-0.0133 F30
+G1 X0.5523 Y0.7190 Z-0.0149 F30
+G1 X0.5396 Y0.7142 Z-0.0121 F30
+G1 X0.5363 Y0.7068 Z-0.0073 F30
+G1 X0.5115 Y0.7072 Z-0.0050 F30
+G1 X0.4975 Y0.6999 Z-0.0073 F30
+G1 X0.4910 Y0.7041 Z-0.0121 F30
+G1 X0.4801 Y0.7059 Z-0.0150 F30
+G1 X0.4557 Y0.6900 Z-0.0133 F30
+G0 Z0.100
+G0 X0.7500 Y0.8000
+G1 Z-0.0100 F10
+G1 X0.7436 Y0.7886 Z-0.0100 F30
+G1 X0.7410 Y0.7732 Z-0.0142 F30
+G1 X0.7589 Y0.7587 Z-0.0145 F30
+G1 X0.7666 Y0.7323 Z-0.0107 F30
+G1 X0.7537 Y0.7200 Z-0.0062 F30
+G1 X0.7449 Y0.7148 Z-0.0052 F30
+G0 Z0.100
+G0 X1.0000 Y0.8000
+G1 Z-0.0100 F10
+G1 X1.0013 Y0.7801 Z-0.0100 F30
+G1 X1.0052 Y0.7719 Z-0.0142 F30
+G1 X1.0092 Y0.7549 Z-0.0145 F30
+G1 X1.0206 Y0.7374 Z-0.0107 F30
+G1 X1.0278 Y0.7188 Z-0.0062 F30
+G1 X1.0300 Y0.7136 Z-0.0052 F30
+G0 Z0.100
+G0 X1.2500 Y0.8000
+G1 Z-0.0100 F10
+G1 X1.2579 Y0.8230 Z-0.0100 F30
+G1 X1.2572 Y0.8271 Z-0.0142 F30
+G1 X1.2374 Y0.8395 Z-0.0145 F30
+G1 X1.2187 Y0.8535 Z-0.0107 F30
+G1 X1.2115 Y0.8602 Z-0.0062 F30
+G1 X1.2129 Y0.8702 Z-0.0052 F30
+G1 X1.2249 Y0.8743 Z-0.0086 F30
+G1 X1.2381 Y0.8920 Z-0.0133 F30
+G1 X1.2339 Y0.9141 Z-0.0149 F30
+G1 X1.2406 Y0.9313 Z-0.0121 F30
+G1 X1.2529 Y0.9524 Z-0.0073 F30
+G1 X1.2579 Y0.9622 Z-0.0050 F30
+G1 X1.2616 Y0.9910 Z-0.0073 F30
+G1 X1.2811 Y1.0095 Z-0.0121 F30
+G1 X1.2910 Y1.0053 Z-0.0150 F30
+G1 X1.3029 Y0.9853 Z-0.0133 F30
+G0 Z0.100
+G0 X1.5000 Y0.8000
+G1 Z-0.0100 F10
+G1 X1.4885 Y0.7757 Z-0.0100 F30
+G1 X1.4808 Y0.7690 Z-0.0142 F30
+G1 X1.4833 Y0.7487 Z-0.0145 F30
+G1 X1.4951 Y0.7310 Z-0.0107 F30
+G1 X1.5111 Y0.7337 Z-0.0062 F30
+G1 X1.5234 Y0.7521 Z-0.0052 F30
+G1 X1.5193 Y0.7669 Z-0.0086 F30
+G1 X1.5057 Y0.7799 Z-0.0133 F30
+G0 Z0.100
+G0 X1.7500 Y0.8000
+G1 Z-0.0100 F10
+G1 X1.7497 Y0.7808 Z-0.0100 F30
+G1 X1.7509 Y0.7724 Z-0.0142 F30
+G1 X1.7451 Y0.7686 Z-0.0145 F30
+G1 X1.7399 Y0.7622 Z-0.0107 F30
+G1 X1.7497 Y0.7423 Z-0.0062 F30
+G1 X1.7450 Y0.7363 Z-0.0052 F30
+G1 X1.7434 Y0.7315 Z-0.0086 F30
+G1 X1.7383 Y0.7304 Z-0.0133 F30
+G1 X1.7268 Y0.7096 Z-0.0149 F30
+G1 X1.6996 Y0.6999 Z-0.0121 F30
+G0 Z0.100
+G0 X2.0000 Y0.8000
+G1 Z-0.0100 F10
+G1 X1.9959 Y0.7738 Z-0.0100 F30
+G1 X2.0171 Y0.7547 Z-0.0142 F30
+G1 X2.0161 Y0.7454 Z-0.0145 F30
+G1 X2.0119 Y0.7429 Z-0.0107 F30
+G1 X2.0068 Y0.7183 Z-0.0062 F30
+G1 X2.0099 Y0.6930 Z-0.0052 F30
+G1 X2.0147 Y0.6826 Z-0.0086 F30
+G1 X2.0114 Y0.6769 Z-0.0133 F30
+G1 X2.0123 Y0.6676 Z-0.0149 F30
+G1 X2.0073 Y0.6535 Z-0.0121 F30
+G1 X1.9967 Y0.6526 Z-0.0073 F30
+G1 X1.9762 Y0.6623 Z-0.0050 F30
+G1 X1.9673 Y0.6708 Z-0.0073 F30
+G1 X1.9512 Y0.6648 Z-0.0121 F30
+G0 Z0.100
+G0 X2.2500 Y0.8000
+G1 Z-0.0100 F10
+G1 X2.2363 Y0.8055 Z-0.0100 F30
+G1 X2.2156 Y0.8179 Z-0.0142 F30
+G1 X2.2018 Y0.8354 Z-0.0145 F30
+G1 X2.1952 Y0.8424 Z-0.0107 F30
+G1 X2.1889 Y0.8421 Z-0.0062 F30
+G1 X2.1831 Y0.8359 Z-0.0052 F30
+G1 X2.1745 Y0.8392 Z-0.0086 F30
+G1 X2.1461 Y0.8318 Z-0.0133 F30
+G1 X2.1361 Y0.8453 Z-0.0149 F30
+G1 X2.1218 Y0.8655 Z-0.0121 F30
+G0 Z0.100
+G0 X2.5000 Y0.8000
+G1 Z-0.0100 F10
+G1 X2.5289 Y0.8004 Z-0.0100 F30
+G1 X2.5479 Y0.8013 Z-0.0142 F30
+G1 X2.5660 Y0.7838 Z-0.0145 F30
+G1 X2.5756 Y0.7866 Z-0.0107 F30
+G1 X2.6003 Y0.7724 Z-0.0062 F30
+G1 X2.6169 Y0.7745 Z-0.0052 F30
+G1 X2.6219 Y0.7924 Z-0.0086 F30
+G1 X2.6336 Y0.7967 Z-0.0133 F30
+G0 Z0.100
+G0 X2.7500 Y0.8000
+G1 Z-0.0100 F10
+G1 X2.7326 Y0.8208 Z-0.0100 F30
+G1 X2.7405 Y0.8467 Z-0.0142 F30
+G1 X2.7498 Y0.8480 Z-0.0145 F30
+G1 X2.7747 Y0.8365 Z-0.0107 F30
+G1 X2.7873 Y0.8307 Z-0.0062 F30
+G1 X2.7962 Y0.8354 Z-0.0052 F30
+G1 X2.8126 Y0.8423 Z-0.0086 F30
+G0 Z0.100
+G0 X3.0000 Y0.8000
+G1 Z-0.0100 F10
+G1 X2.9994 Y0.7952 Z-0.0100 F30
+G1 X3.0005 Y0.7776 Z-0.0142 F30
+G1 X3.0133 Y0.7685 Z-0.0145 F30
+G1 X3.0242 Y0.7626 Z-0.0107 F30
+G1 X3.0425 Y0.7505 Z-0.0062 F30
+G1 X3.0464 Y0.7413 Z-0.0052 F30
+G1 X3.0466 Y0.7206 Z-0.0086 F30
+G1 X3.0545 Y0.7054 Z-0.0133 F30
+G1 X3.0527 Y0.6818 Z-0.0149 F30
+G1 X3.0656 Y0.6665 Z-0.0121 F30
+G1 X3.0934 Y0.6570 Z-0.0073 F30
+G1 X3.1127 Y0.6610 Z-0.0050 F30
+G1 X3.1227 Y0.6595 Z-0.0073 F30
+G1 X3.1290 Y0.6681 Z-0.0121 F30
+G1 X3.1158 Y0.6949 Z-0.0150 F30
+G1 X3.1230 Y0.7147 Z-0.0133 F30
+G1 X3.1300 Y0.7185 Z-0.0086 F30
+G1 X3.1412 Y0.7144 Z-0.0052 F30
+G0 Z0.100
+G0 X3.2500 Y0.8000
+G1 Z-0.0100 F10
+G1 X3.2414 Y0.8187 Z-0.0100 F30
+G1 X3.2460 Y0.8269 Z-0.0142 F30
+G1 X3.2494 Y0.8303 Z-0.0145 F30
+G1 X3.2704 Y0.8431 Z-0.0107 F30
+G1 X3.2794 Y0.8576 Z-0.0062 F30
+G1 X3.2832 Y0.8732 Z-0.0052 F30
+G1 X3.3008 Y0.8821 Z-0.0086 F30
+G1 X3.3234 Y0.8877 Z-0.0133 F30
+G1 X3.3286 Y0.9019 Z-0.0149 F30
+G1 X3.3326 Y0.9251 Z-0.0121 F30
+G0 Z0.100
+G0 X3.5000 Y0.8000
+G1 Z-0.0100 F10
+G1 X3.5177 Y0.7887 Z-0.0100 F30
+G1 X3.5372 Y0.7956 Z-0.0142 F30
+G1 X3.5457 Y0.8007 Z-0.0145 F30
+G1 X3.5528 Y0.7991 Z-0.0107 F30
+G1 X3.5627 Y0.7951 Z-0.0062 F30
+G1 X3.5899 Y0.7976 Z-0.0052 F30
+G1 X3.6023 Y0.7905 Z-0.0086 F30
+G1 X3.6104 Y0.7903 Z-0.0133 F30
+G1 X3.6216 Y0.8025 Z-0.0149 F30
+G1 X3.6466 Y0.7941 Z-0.0121 F30
+G1 X3.6669 Y0.7881 Z-0.0073 F30
+G1 X3.6892 Y0.8038 Z-0.0050 F30
+G0 Z0.100
+G0 X3.7500 Y0.8000
+G1 Z-0.0100 F10
+G1 X3.7485 Y0.7833 Z-0.0100 F30
+G1 X3.7528 Y0.7808 Z-0.0142 F30
+G1 X3.7602 Y0.7775 Z-0.0145 F30
+G1 X3.7878 Y0.7847 Z-0.0107 F30
+G1 X3.7941 Y0.7867 Z-0.0062 F30
+G1 X3.8101 Y0.7950 Z-0.0052 F30
+G1 X3.8194 Y0.8096 Z-0.0086 F30
+G1 X3.8254 Y0.8345 Z-0.0133 F30
+G1 X3.8280 Y0.8489 Z-0.0149 F30
+G1 X3.8206 Y0.8549 Z-0.0121 F30
+G1 X3.8068 Y0.8582 Z-0.0073 F30
+G0 Z0.100
+G0 X4.0000 Y0.8000
+G1 Z-0.0100 F10
+G1 X4.0198 Y0.8025 Z-0.0100 F30
+G1 X4.0293 Y0.8071 Z-0.0142 F30
+G1 X4.0348 Y0.8081 Z-0.0145 F30
+G1 X4.0532 Y0.7872 Z-0.0107 F30
+G1 X4.0717 Y0.7761 Z-0.0062 F30
+G1 X4.0781 Y0.7738 Z-0.0052 F30
+G1 X4.0879 Y0.7632 Z-0.0086 F30
+G1 X4.1161 Y0.7710 Z-0.0133 F30
+G1 X4.1195 Y0.7998 Z-0.0149 F30
+G1 X4.1212 Y0.8079 Z-0.0121 F30
+G1 X4.1169 Y0.8118 Z-0.0073 F30
+G1 X4.1079 Y0.8121 Z-0.0050 F30
+G1 X4.0863 Y0.8052 Z-0.0073 F30
+G1 X4.0825 Y0.7983 Z-0.0121 F30
+G1 X4.0798 Y0.7729 Z-0.0150 F30
+G1 X4.0881 Y0.7607 Z-0.0133 F30
+G1 X4.1113 Y0.7660 Z-0.0086 F30
+G1 X4.1316 Y0.7793 Z-0.0052 F30
+G0 Z0.100
+G0 X4.2500 Y0.8000
+G1 Z-0.0100 F10
+G1 X4.2391 Y0.8008 Z-0.0100 F30
+G1 X4.2292 Y0.8046 Z-0.0142 F30
+G1 X4.2217 Y0.8092 Z-0.0145 F30
+G1 X4.2255 Y0.8316 Z-0.0107 F30
+G1 X4.2321 Y0.8396 Z-0.0062 F30
+G1 X4.2473 Y0.8460 Z-0.0052 F30
+G1 X4.2673 Y0.8507 Z-0.0086 F30
+G1 X4.2783 Y0.8584 Z-0.0133 F30
+G1 X4.2765 Y0.8846 Z-0.0149 F30
+G1 X4.2979 Y0.8985 Z-0.0121 F30
+G1 X4.2984 Y0.9229 Z-0.0073 F30
+G1 X4.3182 Y0.9391 Z-0.0050 F30
+G1 X4.3205 Y0.9428 Z-0.0073 F30
+G0 Z0.100
+G0 X4.5000 Y0.8000
+G1 Z-0.0100 F10
+G1 X4.5111 Y0.8033 Z-0.0100 F30
+G1 X4.5274 Y0.8133 Z-0.0142 F30
+G1 X4.5289 Y0.8220 Z-0.0145 F30
+G1 X4.5358 Y0.8454 Z-0.0107 F30
+G1 X4.5478 Y0.8534 Z-0.0062 F30
+G1 X4.5634 Y0.8657 Z-0.0052 F30
+G0 Z0.100
+G0 X4.7500 Y0.8000
+G1 Z-0.0100 F10
+G1 X4.7454 Y0.7791 Z-0.0100 F30
+G1 X4.7617 Y0.7608 Z-0.0142 F30
+G1 X4.7708 Y0.7606 Z-0.0145 F30
+G1 X4.7870 Y0.7681 Z-0.0107 F30
+G1 X4.7951 Y0.7811 Z-0.0062 F30
+G1 X4.7886 Y0.7984 Z-0.0052 F30
+G1 X4.7906 Y0.8083 Z-0.0086 F30
+G1 X4.8054 Y0.8164 Z-0.0133 F30
+G1 X4.8191 Y0.8078 Z-0.0149 F30
+G1 X4.8217 Y0.7912 Z-0.0121 F30
+G1 X4.8245 Y0.7734 Z-0.0073 F30
+G1 X4.8281 Y0.7713 Z-0.0050 F30
+G1 X4.8437 Y0.7756 Z-0.0073 F30
+G1 X4.8631 Y0.7844 Z-0.0121 F30
+G1 X4.8675 Y0.7974 Z-0.0150 F30
+G1 X4.8821 Y0.8225 Z-0.0133 F30
+G1 X4.9026 Y0.8230 Z-0.0086 F30
+G0 Z0.100
+G0 X0.0000 Y1.2000
+G1 Z-0.0100 F10
+G1 X-0.0051 Y1.2012 Z-0.0100 F30
+G1 X-0.0334 Y1.1913 Z-0.0142 F30
+G1 X-0.0364 Y1.1857 Z-0.0145 F30
+G1 X-0.0484 Y1.1652 Z-0.0107 F30
+G1 X-0.0578 Y1.1635 Z-0.0062 F30
+G1 X-0.0651 Y1.1636 Z-0.0052 F30
+G1 X-0.0767 Y1.1813 Z-0.0086 F30
+G1 X-0.0815 Y1.2051 Z-0.0133 F30
+G1 X-0.0905 Y1.2313 Z-0.0149 F30
+G1 X-0.0880 Y1.2440 Z-0.0121 F30
+G1 X-0.0842 Y1.2478 Z-0.0073 F30
+G1 X-0.0715 Y1.2514 Z-0.0050 F30
+G1 X-0.0593 Y1.2547 Z-0.0073 F30
+G1 X-0.0554 Y1.2811 Z-0.0121 F30
+G1 X-0.0509 Y1.2892 Z-0.0150 F30
+G1 X-0.0473 Y1.2953 Z-0.0133 F30
+G0 Z0.100
+G0 X0.2500 Y1.2000
+G1 Z-0.0100 F10
+G1 X0.2512 Y1.2192 Z-0.0100 F30
+G1 X0.2449 Y1.2428 Z-0.0142 F30
+G1 X0.2619 Y1.2580 Z-0.0145 F30
+G1 X0.2603 Y1.2761 Z-0.0107 F30
+G1 X0.2702 Y1.2825 Z-0.0062 F30
+G1 X0.2776 Y1.2774 Z-0.0052 F30
+G1 X0.2958 Y1.2851 Z-0.0086 F30
+G1 X0.3133 Y1.3023 Z-0.0133 F30
+G1 X0.3095 Y1.3218 Z-0.0149 F30
+G0 Z0.100
+G0 X0.5000 Y1.2000
+G1 Z-0.0100 F10
+G1 X0.5050 Y1.2213 Z-0.0100 F30
+G1 X0.5012 Y1.2262 Z-0.0142 F30
+G1 X0.5098 Y1.2447 Z-0.0145 F30
+G1 X0.5109 Y1.2532 Z-0.0107 F30
+G1 X0.5040 Y1.2789 Z-0.0062 F30
+G1 X0.5035 Y1.2855 Z-0.0052 F30
+G1 X0.4996 Y1.2874 Z-0.0086 F30
+G1 X0.4927 Y1.2843 Z-0.0133 F30
+G1 X0.4703 Y1.2850 Z-0.0149 F30
+G1 X0.4644 Y1.2784 Z-0.0121 F30
+G1 X0.4600 Y1.2796 Z-0.0073 F30
+G1 X0.4411 Y1.2819 Z-0.0050 F30
+G1 X0.4303 Y1.2689 Z-0.0073 F30
+G1 X0.4150 Y1.2485 Z-0.0121 F30
+G1 X0.4152 Y1.2336 Z-0.0150 F30
+G0 Z0.100
+G0 X0.7500 Y1.2000
+G1 Z-0.0100 F10
+G1 X0.7535 Y1.1974 Z-0.0100 F30
+G1 X0.7653 Y1.1820 Z-0.0142 F30
+G1 X0.7946 Y1.1861 Z-0.0145 F30
+G1 X0.8092 Y1.1872 Z-0.0107 F30
+G1 X0.8225 Y1.1713 Z-0.0062 F30
+G1 X0.8225 Y1.1633 Z-0.0052 F30
+G1 X0.8188 Y1.1617 Z-0.0086 F30
+G1 X0.8140 Y1.1563 Z-0.0133 F30
+G1 X0.8165 Y1.1505 Z-0.0149 F30
+G1 X0.8236 Y1.1484 Z-0.0121 F30
+G1 X0.8265 Y1.1259 Z-0.0073 F30
+G1 X0.8157 Y1.1055 Z-0.0050 F30
+G1 X0.8107 Y1.1038 Z-0.0073 F30
+G1 X0.7983 Y1.0849 Z-0.0121 F30
+G1 X0.8045 Y1.0628 Z-0.0150 F30
+G1 X0.7910 Y1.0476 Z-0.0133 F30
+G1 X0.7875 Y1.0320 Z-0.0086 F30
+G0 Z0.100
+G0 X1.0000 Y1.2000
+G1 Z-0.0100 F10
+G1 X0.9998 Y1.1952 Z-0.0100 F30
+G1 X0.9757 Y1.1830 Z-0.0142 F30
+G1 X0.9634 Y1.1671 Z-0.0145 F30
+G1 X0.9538 Y1.1598 Z-0.0107 F30
+G1 X0.9356 Y1.1374 Z-0.0062 F30
+G1 X0.9380 Y1.1177 Z-0.0052 F30
+G1 X0.9290 Y1.0905 Z-0.0086 F30
+G1 X0.9326 Y1.0747 Z-0.0133 F30
+G1 X0.9168 Y1.0502 Z-0.0149 F30
+G1 X0.8881 Y1.0480 Z-0.0121 F30
+G0 Z0.100
+G0 X1.2500 Y1.2000
+G1 Z-0.0100 F10
+G1 X1.2386 Y1.1919 Z-0.0100 F30
+G1 X1.2310 Y1.1643 Z-0.0142 F30
+G1 X1.2386 Y1.1472 Z-0.0145 F30
+G1 X1.2381 Y1.1416 Z-0.0107 F30
+G1 X1.2575 Y1.1306 Z-0.0062 F30
+G1 X1.2696 Y1.1340 Z-0.0052 F30
+G1 X1.2951 Y1.1487 Z-0.0086 F30
+G1 X1.3000 Y1.1677 Z-0.0133 F30
+G0 Z0.100
+G0 X1.5000 Y1.2000
+G1 Z-0.0100 F10
+G1 X1.5011 Y1.1897 Z-0.0100 F30
+G1 X1.4988 Y1.1761 Z-0.0142 F30
+G1 X1.5035 Y1.1671 Z-0.0145 F30
+G1 X1.5113 Y1.1467 Z-0.0107 F30
+G1 X1.5106 Y1.1357 Z-0.0062 F30
+G1 X1.4890 Y1.1180 Z-0.0052 F30
+G1 X1.4830 Y1.0944 Z-0.0086 F30
+G1 X1.4777 Y1.0889 Z-0.0133 F30
+G1 X1.4830 Y1.0595 Z-0.0149 F30
+G1 X1.4647 Y1.0365 Z-0.0121 F30
+G0 Z0.100
+G0 X1.7500 Y1.2000
+G1 Z-0.0100 F10
+G1 X1.7699 Y1.1806 Z-0.0100 F30
+G1 X1.7725 Y1.1750 Z-0.0142 F30
+G1 X1.7856 Y1.1540 Z-0.0145 F30
+G1 X1.7819 Y1.1308 Z-0.0107 F30
+G1 X1.7897 Y1.1244 Z-0.0062 F30
+G1 X1.8093 Y1.1152 Z-0.0052 F30
+G1 X1.8174 Y1.1106 Z-0.0086 F30
+G1 X1.8279 Y1.0895 Z-0.0133 F30
+G1 X1.8425 Y1.0832 Z-0.0149 F30
+G1 X1.8468 Y1.0586 Z-0.0121 F30
+G1 X1.8542 Y1.0518 Z-0.0073 F30
+G1 X1.8774 Y1.0374 Z-0.0050 F30
+G1 X1.8938 Y1.0437 Z-0.0073 F30
+G1 X1.9122 Y1.0497 Z-0.0121 F30
+G1 X1.9204 Y1.0459 Z-0.0150 F30
+G1 X1.9284 Y1.0252 Z-0.0133 F30
+G1 X1.9292 Y1.0066 Z-0.0086 F30
+G1 X1.9259 Y0.9895 Z-0.0052 F30
+G0 Z0.100
+G0 X2.0000 Y1.2000
+G1 Z-0.0100 F10
+G1 X1.9859 Y1.2092 Z-0.0100 F30
+G1 X1.9729 Y1.2052 Z-0.0142 F30
+G1 X1.9669 Y1.2039 Z-0.0145 F30
+G1 X1.9622 Y1.2050 Z-0.0107 F30
+G1 X1.9479 Y1.2186 Z-0.0062 F30
+G1 X1.9493 Y1.2278 Z-0.0052 F30
+G1 X1.9369 Y1.2418 Z-0.0086 F30
+G1 X1.9292 Y1.2474 Z-0.0133 F30
+G0 Z0.100
+G0 X2.2500 Y1.2000
+G1 Z-0.0100 F10
+G1 X2.2610 Y1.2111 Z-0.0100 F30
+G1 X2.2715 Y1.2279 Z-0.0142 F30
+G1 X2.2972 Y1.2312 Z-0.0145 F30
+G1 X2.3261 Y1.2236 Z-0.0107 F30
+G1 X2.3301 Y1.2211 Z-0.0062 F30
+G1 X2.3288 Y1.2076 Z-0.0052 F30
+G1 X2.3352 Y1.1922 Z-0.0086 F30
+G1 X2.3609 Y1.1830 Z-0.0133 F30
+G1 X2.3787 Y1.1934 Z-0.0149 F30
+G1 X2.3794 Y1.2157 Z-0.0121 F30
+G1 X2.3898 Y1.2222 Z-0.0073 F30
+G1 X2.3962 Y1.2217 Z-0.0050 F30
+G1 X2.4065 Y1.2354 Z-0.0073 F30
+G1 X2.4322 Y1.2396 Z-0.0121 F30
+G1 X2.4422 Y1.2382 Z-0.0150 F30
+G1 X2.4501 Y1.2413 Z-0.0133 F30
+G1 X2.4537 Y1.2696 Z-0.0086 F30
+G1 X2.4707 Y1.2765 Z-0.0052 F30
+G0 Z0.100
+G0 X2.5000 Y1.2000
+G1 Z-0.0100 F10
+G1 X2.4874 Y1.1791 Z-0.0100 F30
+G1 X2.4866 Y1.1583 Z-0.0142 F30
+G1 X2.4915 Y1.1559 Z-0.0145 F30
+G1 X2.4979 Y1.1332 Z-0.0107 F30
+G1 X2.5189 Y1.1280 Z-0.0062 F30
+G1 X2.5334 Y1.1151 Z-0.0052 F30
+G0 Z0.100
+G0 X2.7500 Y1.2000
+G1 Z-0.0100 F10
+G1 X2.7414 Y1.1894 Z-0.0100 F30
+G1 X2.7302 Y1.1814 Z-0.0142 F30
+G1 X2.7156 Y1.1763 Z-0.0145 F30
+G1 X2.7023 Y1.1520 Z-0.0107 F30
+G1 X2.7092 Y1.1374 Z-0.0062 F30
+G1 X2.7337 Y1.1339 Z-0.0052 F30
+G1 X2.7484 Y1.1129 Z-0.0086 F30
+G1 X2.7405 Y1.0944 Z-0.0133 F30
+G1 X2.7252 Y1.0766 Z-0.0149 F30
+G1 X2.7240 Y1.0477 Z-0.0121 F30
+G1 X2.7356 Y1.0399 Z-0.0073 F30
+G1 X2.7346 Y1.0341 Z-0.0050 F30
+G1 X2.7448 Y1.0270 Z-0.0073 F30
+G1 X2.7471 Y1.0204 Z-0.0121 F30
+G1 X2.7472 Y1.0078 Z-0.0150 F30
+G1 X2.7519 Y1.0005 Z-0.0133 F30
+G1 X2.7638 Y0.9761 Z-0.0086 F30
+G1 X2.7662 Y0.9686 Z-0.0052 F30
+G0 Z0.100
+G0 X3.0000 Y1.2000
+G1 Z-0.0100 F10
+G1 X2.9979 Y1.2109 Z-0.0100 F30
+G1 X2.9872 Y1.2177 Z-0.0142 F30
+G1 X2.9838 Y1.2341 Z-0.0145 F30
+G1 X2.9900 Y1.2608 Z-0.0107 F30
+G1 X3.0170 Y1.2727 Z-0.0062 F30
+G1 X3.0387 Y1.2562 Z-0.0052 F30
+G1 X3.0479 Y1.2539 Z-0.0086 F30
+G1 X3.0589 Y1.2505 Z-0.0133 F30
+G1 X3.0648 Y1.2434 Z-0.0149 F30
+G1 X3.0754 Y1.2156 Z-0.0121 F30
+G1 X3.1034 Y1.2153 Z-0.0073 F30
+G1 X3.1099 Y1.2058 Z-0.0050 F30
+G0 Z0.100
+G0 X3.2500 Y1.2000
+G1 Z-0.0100 F10
+G1 X3.2572 Y1.2091 Z-0.0100 F30
+G1 X3.2551 Y1.2131 Z-0.0142 F30
+G1 X3.2431 Y1.2175 Z-0.0145 F30
+G1 X3.2417 Y1.2213 Z-0.0107 F30
+G1 X3.2255 Y1.2285 Z-0.0062 F30
+G1 X3.2195 Y1.2426 Z-0.0052 F30
+G1 X3.2100 Y1.2443 Z-0.0086 F30
+G1 X3.2024 Y1.2444 Z-0.0133 F30
+G0 Z0.100
+G0 X3.5000 Y1.2000
+G1 Z-0.0100 F10
+G1 X3.4925 Y1.2042 Z-0.0100 F30
+G1 X3.4679 Y1.2110 Z-0.0142 F30
+G1 X3.4498 Y1.1969 Z-0.0145 F30
+G1 X3.4474 Y1.1887 Z-0.0107 F30
+G1 X3.4279 Y1.1799 Z-0.0062 F30
+G1 X3.4211 Y1.1740 Z-0.0052 F30
+G1 X3.4170 Y1.1728 Z-0.0086 F30
+G1 X3.4040 Y1.1612 Z-0.0133 F30
+G0 Z0.100
+G0 X3.7500 Y1.2000
+G1 Z-0.0100 F10
+G1 X3.7615 Y1.1939 Z-0.0100 F30
+G1 X3.7725 Y1.1765 Z-0.0142 F30
+G1 X3.7789 Y1.1769 Z-0.0145 F30
+G1 X3.8024 Y1.1732 Z-0.0107 F30
+G1 X3.8133 Y1.1548 Z-0.0062 F30
+G1 X3.8120 Y1.1362 Z-0.0052 F30
+G1 X3.8164 Y1.1340 Z-0.0086 F30
+G1 X3.8353 Y1.1342 Z-0.0133 F30
+G1 X3.8439 Y1.1443 Z-0.0149 F30
+G1 X3.8342 Y1.1719 Z-0.0121 F30
+G1 X3.8427 Y1.1821 Z-0.0073 F30
+G1 X3.8674 Y1.1888 Z-0.0050 F30
+G1 X3.8749 Y1.2119 Z-0.0073 F30
+G1 X3.8647 Y1.2279 Z-0.0121 F30
+G1 X3.8531 Y1.2284 Z-0.0150 F30
+G1 X3.8405 Y1.2476 Z-0.0133 F30
+G1 X3.8384 Y1.2518 Z-0.0086 F30
+G0 Z0.100
+G0 X4.0000 Y1.2000
+G1 Z-0.0100 F10
+G1 X3.9823 Y1.2232 Z-0.0100 F30
+G1 X3.9824 Y1.2319 Z-0.0142 F30
+G1 X3.9910 Y1.2379 Z-0.0145 F30
+G1 X3.9920 Y1.2426 Z-0.0107 F30
+G1 X4.0124 Y1.2512 Z-0.0062 F30
+G1 X4.0166 Y1.2498 Z-0.0052 F30
+G1 X4.0355 Y1.2480 Z-0.0086 F30
+G1 X4.0578 Y1.2471 Z-0.0133 F30
+G1 X4.0723 Y1.2249 Z-0.0149 F30
+G1 X4.0769 Y1.2225 Z-0.0121 F30
+G1 X4.0802 Y1.2060 Z-0.0073 F30
+G1 X4.0824 Y1.1950 Z-0.0050 F30
+G1 X4.0730 Y1.1839 Z-0.0073 F30
+G1 X4.0536 Y1.1841 Z-0.0121 F30
+G1 X4.0484 Y1.1782 Z-0.0150 F30
+G1 X4.0364 Y1.1581 Z-0.0133 F30
+G1 X4.0116 Y1.1524 Z-0.0086 F30
+G1 X4.0075 Y1.1389 Z-0.0052 F30
+G0 Z0.100
+G0 X4.2500 Y1.2000
+G1 Z-0.0100 F10
+G1 X4.2468 Y1.1963 Z-0.0100 F30
+G1 X4.2489 Y1.1914 Z-0.0142 F30
+G1 X4.2501 Y1.1770 Z-0.0145 F30
+G1 X4.2678 Y1.1629 Z-0.0107 F30
+G1 X4.2863 Y1.1657 Z-0.0062 F30
+G1 X4.2894 Y1.1776 Z-0.0052 F30
+G1 X4.2982 Y1.1940 Z-0.0086 F30
+G1 X4.3044 Y1.1988 Z-0.0133 F30
+G1 X4.3105 Y1.2105 Z-0.0149 F30
+G1 X4.3021 Y1.2300 Z-0.0121 F30
+G1 X4.3068 Y1.2349 Z-0.0073 F30
+G1 X4.3192 Y1.2356 Z-0.0050 F30
+G0 Z0.100
+G0 X4.5000 Y1.2000
+G1 Z-0.0100 F10
+G1 X4.4967 Y1.2069 Z-0.0100 F30
+G1 X4.4725 Y1.2067 Z-0.0142 F30
+G1 X4.4624 Y1.1889 Z-0.0145 F30
+G1 X4.4684 Y1.1626 Z-0.0107 F30
+G1 X4.4729 Y1.1606 Z-0.0062 F30
+G1 X4.4838 Y1.1597 Z-0.0052 F30
+G1 X4.4942 Y1.1635 Z-0.0086 F30
+G1 X4.5195 Y1.1756 Z-0.0133 F30
+G1 X4.5273 Y1.1827 Z-0.0149 F30
+G0 Z0.100
+G0 X4.7500 Y1.2000
+G1 Z-0.0100 F10
+G1 X4.7543 Y1.1974 Z-0.0100 F30
+G1 X4.7555 Y1.1844 Z-0.0142 F30
+G1 X4.7519 Y1.1802 Z-0.0145 F30
+G1 X4.7628 Y1.1544 Z-0.0107 F30
+G1 X4.7688 Y1.1531 Z-0.0062 F30
+G1 X4.7971 Y1.1533 Z-0.0052 F30
+G1 X4.8142 Y1.1510 Z-0.0086 F30
+G1 X4.8338 Y1.1707 Z-0.0133 F30
+G1 X4.8401 Y1.1799 Z-0.0149 F30
+G1 X4.8408 Y1.2031 Z-0.0121 F30
+G1 X4.8489 Y1.2167 Z-0.0073 F30
+G1 X4.8497 Y1.2264 Z-0.0050 F30
+G1 X4.8559 Y1.2436 Z-0.0073 F30
+G1 X4.8727 Y1.2650 Z-0.0121 F30
+G0 Z0.100
+G0 X0.0000 Y1.6000
+G1 Z-0.0100 F10
+G1 X-0.0097 Y1.5929 Z-0.0100 F30
+G1 X-0.0195 Y1.5927 Z-0.0142 F30
+G1 X-0.0334 Y1.5921 Z-0.0145 F30
+G1 X-0.0376 Y1.5911 Z-0.0107 F30
+G1 X-0.0639 Y1.5938 Z-0.0062 F30
+G1 X-0.0776 Y1.6062 Z-0.0052 F30
+G1 X-0.0860 Y1.6140 Z-0.0086 F30
+G1 X-0.0966 Y1.6092 Z-0.0133 F30
+G1 X-0.1005 Y1.6021 Z-0.0149 F30
+G1 X-0.1272 Y1.6013 Z-0.0121 F30
+G0 Z0.100
+G0 X0.2500 Y1.6000
+G1 Z-0.0100 F10
+G1 X0.2368 Y1.5780 Z-0.0100 F30
+G1 X0.2182 Y1.5630 Z-0.0142 F30
+G1 X0.1961 Y1.5432 Z-0.0145 F30
+G1 X0.1847 Y1.5173 Z-0.0107 F30
+G1 X0.1724 Y1.4998 Z-0.0062 F30
+G1 X0.1631 Y1.4990 Z-0.0052 F30
+G1 X0.1527 Y1.4950 Z-0.0086 F30
+G1 X0.1501 Y1.4891 Z-0.0133 F30
+G1 X0.1625 Y1.4640 Z-0.0149 F30
+G1 X0.1734 Y1.4648 Z-0.0121 F30
+G1 X0.1923 Y1.4725 Z-0.0073 F30
+G1 X0.2018 Y1.4839 Z-0.0050 F30
+G1 X0.2164 Y1.4828 Z-0.0073 F30
+G0 Z0.100
+G0 X0.5000 Y1.6000
+G1 Z-0.0100 F10
+G1 X0.4750 Y1.5853 Z-0.0100 F30
+G1 X0.4637 Y1.5756 Z-0.0142 F30
+G1 X0.4588 Y1.5494 Z-0.0145 F30
+G1 X0.4598 Y1.5356 Z-0.0107 F30
+G1 X0.4591 Y1.5197 Z-0.0062 F30
+G1 X0.4646 Y1.5094 Z-0.0052 F30
+G1 X0.4688 Y1.4915 Z-0.0086 F30
+G1 X0.4683 Y1.4791 Z-0.0133 F30
+G1 X0.4839 Y1.4583 Z-0.0149 F30
+G1 X0.4932 Y1.4458 Z-0.0121 F30
+G1 X0.4918 Y1.4340 Z-0.0073 F30
+G1 X0.4762 Y1.4232 Z-0.0050 F30
+G1 X0.4718 Y1.4187 Z-0.0073 F30
+G1 X0.4747 Y1.4066 Z-0.0121 F30
+G0 Z0.100
+G0 X0.7500 Y1.6000
+G1 Z-0.0100 F10
+G1 X0.7593 Y1.6008 Z-0.0100 F30
+G1 X0.7868 Y1.5981 Z-0.0142 F30
+G1 X0.7884 Y1.5931 Z-0.0145 F30
+G1 X0.7959 Y1.5779 Z-0.0107 F30
+G1 X0.8198 Y1.5754 Z-0.0062 F30
+G1 X0.8498 Y1.5750 Z-0.0052 F30
+G1 X0.8672 Y1.5756 Z-0.0086 F30
+G1 X0.8798 Y1.5820 Z-0.0133 F30
+G1 X0.8991 Y1.5846 Z-0.0149 F30
+G1 X0.9270 Y1.5782 Z-0.0121 F30
+G1 X0.9443 Y1.5817 Z-0.0073 F30
+G1 X0.9542 Y1.5722 Z-0.0050 F30
+G1 X0.9643 Y1.5565 Z-0.0073 F30
+G1 X0.9825 Y1.5368 Z-0.0121 F30
+G1 X0.9985 Y1.5416 Z-0.0150 F30
+G0 Z0.100
+G0 X1.0000 Y1.6000
+G1 Z-0.0100 F10
+G1 X1.0169 Y1.5907 Z-0.0100 F30
+G1 X1.0402 Y1.5896 Z-0.0142 F30
+G1 X1.0472 Y1.5781 Z-0.0145 F30
+G1 X1.0485 Y1.5723 Z-0.0107 F30
+G1 X1.0466 Y1.5639 Z-0.0062 F30
+G1 X1.0483 Y1.5524 Z-0.0052 F30
+G1 X1.0418 Y1.5248 Z-0.0086 F30
+G1 X1.0357 Y1.4962 Z-0.0133 F30
+G1 X1.0376 Y1.4787 Z-0.0149 F30
+G1 X1.0447 Y1.4726 Z-0.0121 F30
+G1 X1.0590 Y1.4760 Z-0.0073 F30
+G1 X1.0718 Y1.4624 Z-0.0050 F30
+G1 X1.0682 Y1.4439 Z-0.0073 F30
+G0 Z0.100
+G0 X1.2500 Y1.6000
+G1 Z-0.0100 F10
+G1 X1.2357 Y1.6035 Z-0.0100 F30
+G1 X1.2249 Y1.5983 Z-0.0142 F30
+G1 X1.2224 Y1.5951 Z-0.0145 F30
+G1 X1.1989 Y1.5842 Z-0.0107 F30
+G1 X1.1818 Y1.5714 Z-0.0062 F30
+G1 X1.1649 Y1.5728 Z-0.0052 F30
+G1 X1.1540 Y1.5724 Z-0.0086 F30
+G1 X1.1376 Y1.5655 Z-0.0133 F30
+G1 X1.1379 Y1.5466 Z-0.0149 F30
+G1 X1.1365 Y1.5395 Z-0.0121 F30
+G1 X1.1163 Y1.5271 Z-0.0073 F30
+G1 X1.1102 Y1.5296 Z-0.0050 F30
+G1 X1.1036 Y1.5459 Z-0.0073 F30
+G1 X1.0853 Y1.5538 Z-0.0121 F30
+G1 X1.0799 Y1.5520 Z-0.0150 F30
+G1 X1.0639 Y1.5700 Z-0.0133 F30
+G0 Z0.100
+G0 X1.5000 Y1.6000
+G1 Z-0.0100 F10
+G1 X1.5107 Y1.6030 Z-0.0100 F30
+G1 X1.5242 Y1.5878 Z-0.0142 F30
+G1 X1.5529 Y1.5883 Z-0.0145 F30
+G1 X1.5575 Y1.5806 Z-0.0107 F30
+G1 X1.5608 Y1.5776 Z-0.0062 F30
+G1 X1.5632 Y1.5635 Z-0.0052 F30
+G1 X1.5669 Y1.5599 Z-0.0086 F30
+G1 X1.5641 Y1.5501 Z-0.0133 F30
+G1 X1.5576 Y1.5452 Z-0.0149 F30
+G1 X1.5519 Y1.5389 Z-0.0121 F30
+G1 X1.5269 Y1.5477 Z-0.0073 F30
+G0 Z0.100
+G0 X1.7500 Y1.6000
+G1 Z-0.0100 F10
+G1 X1.7341 Y1.6242 Z-0.0100 F30
+G1 X1.7185 Y1.6483 Z-0.0142 F30
+G1 X1.7192 Y1.6624 Z-0.0145 F30
+G1 X1.7147 Y1.6711 Z-0.0107 F30
+G1 X1.7141 Y1.6978 Z-0.0062 F30
+G1 X1.7145 Y1.7225 Z-0.0052 F30
+G1 X1.7196 Y1.7293 Z-0.0086 F30
+G1 X1.7269 Y1.7343 Z-0.0133 F30
+G1 X1.7250 Y1.7457 Z-0.0149 F30
+G1 X1.7229 Y1.7524 Z-0.0121 F30
+G1 X1.7176 Y1.7654 Z-0.0073 F30
+G1 X1.7167 Y1.7710 Z-0.0050 F30
+G1 X1.7340 Y1.7897 Z-0.0073 F30
+G0 Z0.100
+G0 X2.0000 Y1.6000
+G1 Z-0.0100 F10
+G1 X1.9839 Y1.5989 Z-0.0100 F30
+G1 X1.9693 Y1.6036 Z-0.0142 F30
+G1 X1.9662 Y1.6070 Z-0.0145 F30
+G1 X1.9559 Y1.6081 Z-0.0107 F30
+G1 X1.9510 Y1.6157 Z-0.0062 F30
+G1 X1.9355 Y1.6347 Z-0.0052 F30
+G1 X1.9237 Y1.6457 Z-0.0086 F30
+G1 X1.9135 Y1.6462 Z-0.0133 F30
+G1 X1.9045 Y1.6496 Z-0.0149 F30
+G1 X1.8876 Y1.6610 Z-0.0121 F30
+G1 X1.8768 Y1.6655 Z-0.0073 F30
+G0 Z0.100
+G0 X2.2500 Y1.6000
+G1 Z-0.0100 F10
+G1 X2.2372 Y1.6092 Z-0.0100 F30
+G1 X2.2359 Y1.6316 Z-0.0142 F30
+G1 X2.2494 Y1.6554 Z-0.0145 F30
+G1 X2.2535 Y1.6683 Z-0.0107 F30
+G1 X2.2691 Y1.6804 Z-0.0062 F30
+G1 X2.2958 Y1.6796 Z-0.0052 F30
+G1 X2.3061 Y1.6656 Z-0.0086 F30
+G1 X2.3135 Y1.6574 Z-0.0133 F30
+G1 X2.3272 Y1.6548 Z-0.0149 F30
+G1 X2.3456 Y1.6585 Z-0.0121 F30
+G1 X2.3593 Y1.6548 Z-0.0073 F30
+G1 X2.3620 Y1.6467 Z-0.0050 F30
+G1 X2.3733 Y1.6417 Z-0.0073 F30
+G0 Z0.100
+G0 X2.5000 Y1.6000
+G1 Z-0.0100 F10
+G1 X2.4958 Y1.5726 Z-0.0100 F30
+G1 X2.5088 Y1.5527 Z-0.0142 F30
+G1 X2.5053 Y1.5303 Z-0.0145 F30
+G1 X2.4948 Y1.5256 Z-0.0107 F30
+G1 X2.4894 Y1.5122 Z-0.0062 F30
+G1 X2.4721 Y1.4929 Z-0.0052 F30
+G1 X2.4573 Y1.4790 Z-0.0086 F30
+G1 X2.4445 Y1.4559 Z-0.0133 F30
+G1 X2.4489 Y1.4485 Z-0.0149 F30
+G1 X2.4543 Y1.4243 Z-0.0121 F30
+G1 X2.4715 Y1.4031 Z-0.0073 F30
+G1 X2.4615 Y1.3831 Z-0.0050 F30
+G1 X2.4459 Y1.3575 Z-0.0073 F30
+G1 X2.4263 Y1.3381 Z-0.0121 F30
+G1 X2.4149 Y1.3402 Z-0.0150 F30
+G1 X2.4002 Y1.3535 Z-0.0133 F30
+G0 Z0.100
+G0 X2.7500 Y1.6000
+G1 Z-0.0100 F10
+G1 X2.7451 Y1.5988 Z-0.0100 F30
+G1 X2.7374 Y1.6039 Z-0.0142 F30
+G1 X2.7306 Y1.6159 Z-0.0145 F30
+G1 X2.7373 Y1.6260 Z-0.0107 F30
+G1 X2.7395 Y1.6344 Z-0.0062 F30
+G1 X2.7295 Y1.6504 Z-0.0052 F30
+G1 X2.7201 Y1.6554 Z-0.0086 F30
+G1 X2.7028 Y1.6685 Z-0.0133 F30
+G1 X2.7006 Y1.6720 Z-0.0149 F30
+G0 Z0.100
+G0 X3.0000 Y1.6000
+G1 Z-0.0100 F10
+G1 X2.9983 Y1.5952 Z-0.0100 F30
+G1 X3.0078 Y1.5778 Z-0.0142 F30
+G1 X3.0020 Y1.5692 Z-0.0145 F30
+G1 X2.9775 Y1.5679 Z-0.0107 F30
+G1 X2.9553 Y1.5846 Z-0.0062 F30
+G1 X2.9490 Y1.5849 Z-0.0052 F30
+G1 X2.9361 Y1.5790 Z-0.0086 F30
+G1 X2.9226 Y1.5573 Z-0.0133 F30
+G1 X2.9170 Y1.5543 Z-0.0149 F30
+G1 X2.9169 Y1.5393 Z-0.0121 F30
+G1 X2.9357 Y1.5279 Z-0.0073 F30
+G1 X2.9613 Y1.5285 Z-0.0050 F30
+G1 X2.9762 Y1.5337 Z-0.0073 F30
+G1 X2.9926 Y1.5188 Z-0.0121 F30
+G1 X3.0032 Y1.5052 Z-0.0150 F30
+G1 X3.0105 Y1.5061 Z-0.0133 F30
+G1 X3.0143 Y1.5096 Z-0.0086 F30
+G1 X3.0225 Y1.5331 Z-0.0052 F30
+G0 Z0.100
+G0 X3.2500 Y1.6000
+G1 Z-0.0100 F10
+G1 X3.2733 Y1.6069 Z-0.0100 F30
+G1 X3.2834 Y1.6033 Z-0.0142 F30
+G1 X3.2894 Y1.6091 Z-0.0145 F30
+G1 X3.2953 Y1.6116 Z-0.0107 F30
+G1 X3.3010 Y1.6166 Z-0.0062 F30
+G1 X3.3074 Y1.6320 Z-0.0052 F30
+G1 X3.3168 Y1.6523 Z-0.0086 F30
+G1 X3.3388 Y1.6511 Z-0.0133 F30
+G1 X3.3511 Y1.6345 Z-0.0149 F30
+G1 X3.3578 Y1.6313 Z-0.0121 F30
+G0 Z0.100
+G0 X3.5000 Y1.6000
+G1 Z-0.0100 F10
+G1 X3.5064 Y1.6109 Z-0.0100 F30
+G1 X3.5022 Y1.6287 Z-0.0142 F30
+G1 X3.4959 Y1.6342 Z-0.0145 F30
+G1 X3.4773 Y1.6403 Z-0.0107 F30
+G1 X3.4554 Y1.6499 Z-0.0062 F30
+G1 X3.4489 Y1.6473 Z-0.0052 F30
+G1 X3.4356 Y1.6489 Z-0.0086 F30
+G1 X3.4319 Y1.6530 Z-0.0133 F30
+G1 X3.4299 Y1.6619 Z-0.0149 F30
+G1 X3.4197 Y1.6738 Z-0.0121 F30
+G1 X3.4225 Y1.6859 Z-0.0073 F30
+G1 X3.4265 Y1.6988 Z-0.0050 F30
+G1 X3.4317 Y1.7014 Z-0.0073 F30
+G1 X3.4545 Y1.6822 Z-0.0121 F30
+G1 X3.4607 Y1.6816 Z-0.0150 F30
+G1 X3.4876 Y1.6937 Z-0.0133 F30
+G1 X3.4933 Y1.6974 Z-0.0086 F30
+G0 Z0.100
+G0 X3.7500 Y1.6000
+G1 Z-0.0100 F10
+G1 X3.7733 Y1.5927 Z-0.0100 F30
+G1 X3.7832 Y1.5838 Z-0.0142 F30
+G1 X3.7816 Y1.5725 Z-0.0145 F30
+G1 X3.7846 Y1.5497 Z-0.0107 F30
+G1 X3.7966 Y1.5325 Z-0.0062 F30
+G1 X3.7874 Y1.5109 Z-0.0052 F30
+G1 X3.7731 Y1.5105 Z-0.0086 F30
+G1 X3.7639 Y1.5205 Z-0.0133 F30
+G1 X3.7470 Y1.5155 Z-0.0149 F30
+G1 X3.7398 Y1.4950 Z-0.0121 F30
+G1 X3.7180 Y1.4887 Z-0.0073 F30
+G1 X3.6983 Y1.4922 Z-0.0050 F30
+G1 X3.6796 Y1.5016 Z-0.0073 F30
+G0 Z0.100
+G0 X4.0000 Y1.6000
+G1 Z-0.0100 F10
+G1 X3.9977 Y1.6182 Z-0.0100 F30
+G1 X4.0026 Y1.6433 Z-0.0142 F30
+G1 X4.0062 Y1.6468 Z-0.0145 F30
+G1 X4.0186 Y1.6630 Z-0.0107 F30
+G1 X4.0161 Y1.6852 Z-0.0062 F30
+G1 X3.9908 Y1.6985 Z-0.0052 F30
+G1 X3.9759 Y1.7066 Z-0.0086 F30
+G1 X3.9730 Y1.7180 Z-0.0133 F30
+G1 X3.9704 Y1.7235 Z-0.0149 F30
+G1 X3.9639 Y1.7287 Z-0.0121 F30
+G1 X3.9438 Y1.7499 Z-0.0073 F30
+G0 Z0.100
+G0 X4.2500 Y1.6000
+G1 Z-0.0100 F10
+G1 X4.2625 Y1.6107 Z-0.0100 F30
+G1 X4.2762 Y1.6111 Z-0.0142 F30
+G1 X4.2853 Y1.5935 Z-0.0145 F30
+G1 X4.3019 Y1.5885 Z-0.0107 F30
+G1 X4.3043 Y1.5831 Z-0.0062 F30
+G1 X4.2908 Y1.5652 Z-0.0052 F30
+G1 X4.2924 Y1.5598 Z-0.0086 F30
+G0 Z0.100
+G0 X4.5000 Y1.6000
+G1 Z-0.0100 F10
+G1 X4.5069 Y1.5734 Z-0.0100 F30
+G1 X4.5008 Y1.5634 Z-0.0142 F30
+G1 X4.4889 Y1.5490 Z-0.0145 F30
+G1 X4.4810 Y1.5445 Z-0.0107 F30
+G1 X4.4700 Y1.5502 Z-0.0062 F30
+G1 X4.4454 Y1.5661 Z-0.0052 F30
+G0 Z0.100
+G0 X4.7500 Y1.6000
+G1 Z-0.0100 F10
+G1 X4.7778 Y1.6083 Z-0.0100 F30
+G1 X4.7988 Y1.6220 Z-0.0142 F30
+G1 X4.8180 Y1.6121 Z-0.0145 F30
+G1 X4.8294 Y1.6096 Z-0.0107 F30
+G1 X4.8582 Y1.6082 Z-0.0062 F30
+G1 X4.8789 Y1.6063 Z-0.0052 F30
+G1 X4.8898 Y1.5993 Z-0.0086 F30
+G1 X4.8942 Y1.6009 Z-0.0133 F30
+G1 X4.9142 Y1.5926 Z-0.0149 F30
+G1 X4.9196 Y1.5895 Z-0.0121 F30
+G1 X4.9331 Y1.5876 Z-0.0073 F30
+G1 X4.9479 Y1.5885 Z-0.0050 F30
+G1 X4.9664 Y1.5909 Z-0.0073 F30
+G1 X4.9734 Y1.5900 Z-0.0121 F30
+G1 X4.9905 Y1.5690 Z-0.0150 F30
+G1 X4.9955 Y1.5642 Z-0.0133 F30
+G0 Z0.100
+G0 X0.0000 Y2.0000
+G1 Z-0.0100 F10
+G1 X-0.0210 Y1.9960 Z-0.0100 F30
+G1 X-0.0287 Y1.9897 Z-0.0142 F30
+G1 X-0.0437 Y1.9796 Z-0.0145 F30
+G1 X-0.0550 Y1.9594 Z-0.0107 F30
+G1 X-0.0464 Y1.9428 Z-0.0062 F30
+G1 X-0.0254 Y1.9373 Z-0.0052 F30
+G1 X-0.0188 Y1.9407 Z-0.0086 F30
+G1 X-0.0035 Y1.9485 Z-0.0133 F30
+G1 X0.0045 Y1.9761 Z-0.0149 F30
+G1 X0.0040 Y2.0050 Z-0.0121 F30
+G0 Z0.100
+G0 X0.2500 Y2.0000
+G1 Z-0.0100 F10
+G1 X0.2519 Y2.0141 Z-0.0100 F30
+G1 X0.2751 Y2.0315 Z-0.0142 F30
+G1 X0.2920 Y2.0487 Z-0.0145 F30
+G1 X0.3161 Y2.0469 Z-0.0107 F30
+G1 X0.3204 Y2.0377 Z-0.0062 F30
+G1 X0.3209 Y2.0333 Z-0.0052 F30
+G1 X0.3242 Y2.0244 Z-0.0086 F30
+G1 X0.3214 Y2.0021 Z-0.0133 F30
+G1 X0.3132 Y1.9763 Z-0.0149 F30
+G1 X0.3129 Y1.9496 Z-0.0121 F30
+G1 X0.3167 Y1.9220 Z-0.0073 F30
+G1 X0.3239 Y1.9177 Z-0.0050 F30
+G1 X0.3367 Y1.9183 Z-0.0073 F30
+G1 X0.3536 Y1.9319 Z-0.0121 F30
+G0 Z0.100
+G0 X0.5000 Y2.0000
+G1 Z-0.0100 F10
+G1 X0.5207 Y2.0104 Z-0.0100 F30
+G1 X0.5214 Y2.0332 Z-0.0142 F30
+G1 X0.5391 Y2.0417 Z-0.0145 F30
+G1 X0.5550 Y2.0327 Z-0.0107 F30
+G1 X0.5618 Y2.0341 Z-0.0062 F30
+G1 X0.5690 Y2.0544 Z-0.0052 F30
+G1 X0.5762 Y2.0599 Z-0.0086 F30
+G1 X0.5986 Y2.0726 Z-0.0133 F30
+G1 X0.6039 Y2.0771 Z-0.0149 F30
+G1 X0.6101 Y2.0742 Z-0.0121 F30
+G0 Z0.100
+G0 X0.7500 Y2.0000
+G1 Z-0.0100 F10
+G1 X0.7700 Y2.0199 Z-0.0100 F30
+G1 X0.7676 Y2.0412 Z-0.0142 F30
+G1 X0.7523 Y2.0529 Z-0.0145 F30
+G1 X0.7430 Y2.0814 Z-0.0107 F30
+G1 X0.7341 Y2.0878 Z-0.0062 F30
+G1 X0.7307 Y2.0910 Z-0.0052 F30
+G1 X0.7156 Y2.0841 Z-0.0086 F30
+G1 X0.7111 Y2.0823 Z-0.0133 F30
+G1 X0.7089 Y2.0768 Z-0.0149 F30
+G1 X0.7072 Y2.0561 Z-0.0121 F30
+G1 X0.7112 Y2.0305 Z-0.0073 F30
+G1 X0.7322 Y2.0241 Z-0.0050 F30
+G1 X0.7414 Y2.0201 Z-0.0073 F30
+G1 X0.7549 Y2.0311 Z-0.0121 F30
+G1 X0.7716 Y2.0371 Z-0.0150 F30
+G1 X0.7789 Y2.0363 Z-0.0133 F30
+G1 X0.7882 Y2.0382 Z-0.0086 F30
+G1 X0.8014 Y2.0570 Z-0.0052 F30
+G0 Z0.100
+G0 X1.0000 Y2.0000
+G1 Z-0.0100 F10
+G1 X0.9871 Y1.9972 Z-0.0100 F30
+G1 X0.9764 Y2.0130 Z-0.0142 F30
+G1 X0.9755 Y2.0174 Z-0.0145 F30
+G1 X0.9725 Y2.0469 Z-0.0107 F30
+G1 X0.9790 Y2.0512 Z-0.0062 F30
+G1 X0.9850 Y2.0605 Z-0.0052 F30
+G1 X1.0004 Y2.0678 Z-0.0086 F30
+G1 X1.0190 Y2.0655 Z-0.0133 F30
+G1 X1.0478 Y2.0639 Z-0.0149 F30
+G1 X1.0499 Y2.0683 Z-0.0121 F30
+G1 X1.0570 Y2.0913 Z-0.0073 F30
+G0 Z0.100
+G0 X1.2500 Y2.0000
+G1 Z-0.0100 F10
+G1 X1.2593 Y1.9817 Z-0.0100 F30
+G1 X1.2609 Y1.9705 Z-0.0142 F30
+G1 X1.2809 Y1.9529 Z-0.0145 F30
+G1 X1.3014 Y1.9599 Z-0.0107 F30
+G1 X1.3251 Y1.9566 Z-0.0062 F30
+G1 X1.3407 Y1.9639 Z-0.0052 F30
+G1 X1.3502 Y1.9729 Z-0.0086 F30
+G1 X1.3594 Y1.9842 Z-0.0133 F30
+G1 X1.3720 Y1.9820 Z-0.0149 F30
+G0 Z0.100
+G0 X1.5000 Y2.0000
+G1 Z-0.0100 F10
+G1 X1.5171 Y1.9990 Z-0.0100 F30
+G1 X1.5328 Y2.0185 Z-0.0142 F30
+G1 X1.5289 Y2.0254 Z-0.0145 F30
+G1 X1.5342 Y2.0520 Z-0.0107 F30
+G1 X1.5311 Y2.0662 Z-0.0062 F30
+G1 X1.5319 Y2.0903 Z-0.0052 F30
+G1 X1.5157 Y2.1007 Z-0.0086 F30
+G1 X1.5125 Y2.1232 Z-0.0133 F30
+G1 X1.5208 Y2.1402 Z-0.0149 F30
+G1 X1.5228 Y2.1692 Z-0.0121 F30
+G1 X1.5308 Y2.1733 Z-0.0073 F30
+G0 Z0.100
+G0 X1.7500 Y2.0000
+G1 Z-0.0100 F10
+G1 X1.7368 Y1.9992 Z-0.0100 F30
+G1 X1.7076 Y1.9996 Z-0.0142 F30
+G1 X1.6870 Y1.9899 Z-0.0145 F30
+G1 X1.6840 Y1.9643 Z-0.0107 F30
+G1 X1.6796 Y1.9570 Z-0.0062 F30
+G1 X1.6867 Y1.9402 Z-0.0052 F30
+G1 X1.7040 Y1.9297 Z-0.0086 F30
+G0 Z0.100
+G0 X2.0000 Y2.0000
+G1 Z-0.0100 F10
+G1 X1.9882 Y1.9918 Z-0.0100 F30
+G1 X1.9686 Y1.9940 Z-0.0142 F30
+G1 X1.9535 Y1.9797 Z-0.0145 F30
+G1 X1.9304 Y1.9789 Z-0.0107 F30
+G1 X1.9223 Y1.9610 Z-0.0062 F30
+G1 X1.8975 Y1.9577 Z-0.0052 F30
+G1 X1.8909 Y1.9466 Z-0.0086 F30
+G1 X1.8822 Y1.9452 Z-0.0133 F30
+G1 X1.8563 Y1.9385 Z-0.0149 F30
+G0 Z0.100
+G0 X2.2500 Y2.0000
+G1 Z-0.0100 F10
+G1 X2.2577 Y2.0096 Z-0.0100 F30
+G1 X2.2568 Y2.0142 Z-0.0142 F30
+G1 X2.2534 Y2.0338 Z-0.0145 F30
+G1 X2.2467 Y2.0391 Z-0.0107 F30
+G1 X2.2225 Y2.0344 Z-0.0062 F30
+G1 X2.2085 Y2.0486 Z-0.0052 F30
+G1 X2.1791 Y2.0526 Z-0.0086 F30
+G1 X2.1526 Y2.0630 Z-0.0133 F30
+G1 X2.1486 Y2.0606 Z-0.0149 F30
+G1 X2.1276 Y2.0589 Z-0.0121 F30
+G1 X2.1138 Y2.0642 Z-0.0073 F30
+G1 X2.0884 Y2.0607 Z-0.0050 F30
+G1 X2.0849 Y2.0635 Z-0.0073 F30
+G1 X2.0815 Y2.0809 Z-0.0121 F30
+G1 X2.0703 Y2.0880 Z-0.0150 F30
+G1 X2.0622 Y2.0981 Z-0.0133 F30
+G0 Z0.100
+G0 X2.5000 Y2.0000
+G1 Z-0.0100 F10
+G1 X2.4837 Y1.9866 Z-0.0100 F30
+G1 X2.4761 Y1.9765 Z-0.0142 F30
+G1 X2.4755 Y1.9659 Z-0.0145 F30
+G1 X2.4857 Y1.9443 Z-0.0107 F30
+G1 X2.4965 Y1.9390 Z-0.0062 F30
+G1 X2.5254 Y1.9445 Z-0.0052 F30
+G1 X2.5366 Y1.9454 Z-0.0086 F30
+G1 X2.5648 Y1.9492 Z-0.0133 F30
+G1 X2.5679 Y1.9463 Z-0.0149 F30
+G1 X2.5825 Y1.9311 Z-0.0121 F30
+G1 X2.5957 Y1.9292 Z-0.0073 F30
+G1 X2.6009 Y1.9376 Z-0.0050 F30
+G1 X2.6004 Y1.9440 Z-0.0073 F30
+G1 X2.6070 Y1.9476 Z-0.0121 F30
+G1 X2.6215 Y1.9387 Z-0.0150 F30
+G1 X2.6295 Y1.9352 Z-0.0133 F30
+G0 Z0.100
+G0 X2.7500 Y2.0000
+G1 Z-0.0100 F10
+G1 X2.7510 Y2.0086 Z-0.0100 F30
+G1 X2.7387 Y2.0337 Z-0.0142 F30
+G1 X2.7404 Y2.0381 Z-0.0145 F30
+G1 X2.7372 Y2.0479 Z-0.0107 F30
+G1 X2.7204 Y2.0497 Z-0.0062 F30
+G1 X2.7077 Y2.0468 Z-0.0052 F30
+G1 X2.6984 Y2.0339 Z-0.0086 F30
+G1 X2.6746 Y2.0201 Z-0.0133 F30
+G1 X2.6535 Y2.0295 Z-0.0149 F30
+G1 X2.6512 Y2.0502 Z-0.0121 F30
+G1 X2.6546 Y2.0764 Z-0.0073 F30
+G1 X2.6718 Y2.0835 Z-0.0050 F30
+G1 X2.6993 Y2.0883 Z-0.0073 F30
+G1 X2.7059 Y2.1075 Z-0.0121 F30
+G1 X2.7148 Y2.1133 Z-0.0150 F30
+G0 Z0.100
+G0 X3.0000 Y2.0000
+G1 Z-0.0100 F10
+G1 X2.9898 Y1.9916 Z-0.0100 F30
+G1 X2.9753 Y1.9875 Z-0.0142 F30
+G1 X2.9493 Y1.9943 Z-0.0145 F30
+G1 X2.9208 Y2.0018 Z-0.0107 F30
+G1 X2.9060 Y1.9948 Z-0.0062 F30
+G1 X2.9038 Y1.9709 Z-0.0052 F30
+G1 X2.9101 Y1.9669 Z-0.0086 F30
+G1 X2.9133 Y1.9614 Z-0.0133 F30
+G1 X2.8967 Y1.9405 Z-0.0149 F30
+G1 X2.8849 Y1.9369 Z-0.0121 F30
+G0 Z0.100
+G0 X3.2500 Y2.0000
+G1 Z-0.0100 F10
+G1 X3.2333 Y1.9909 Z-0.0100 F30
+G1 X3.2318 Y1.9815 Z-0.0142 F30
+G1 X3.2411 Y1.9719 Z-0.0145 F30
+G1 X3.2673 Y1.9684 Z-0.0107 F30
+G1 X3.2839 Y1.9478 Z-0.0062 F30
+G1 X3.2951 Y1.9512 Z-0.0052 F30
+G1 X3.2997 Y1.9460 Z-0.0086 F30
+G1 X3.3037 Y1.9472 Z-0.0133 F30
+G1 X3.3060 Y1.9548 Z-0.0149 F30
+G1 X3.3043 Y1.9611 Z-0.0121 F30
+G1 X3.3151 Y1.9800 Z-0.0073 F30
+G1 X3.3279 Y1.9808 Z-0.0050 F30
+G1 X3.3388 Y2.0007 Z-0.0073 F30
+G1 X3.3268 Y2.0276 Z-0.0121 F30
+G1 X3.3334 Y2.0353 Z-0.0150 F30
+G0 Z0.100
+G0 X3.5000 Y2.0000
+G1 Z-0.0100 F10
+G1 X3.4930 Y2.0027 Z-0.0100 F30
+G1 X3.4742 Y2.0053 Z-0.0142 F30
+G1 X3.4526 Y1.9976 Z-0.0145 F30
+G1 X3.4326 Y2.0161 Z-0.0107 F30
+G1 X3.4340 Y2.0228 Z-0.0062 F30
+G1 X3.4115 Y2.0414 Z-0.0052 F30
+G1 X3.4083 Y2.0438 Z-0.0086 F30
+G1 X3.4033 Y2.0612 Z-0.0133 F30
+G1 X3.3931 Y2.0762 Z-0.0149 F30
+G1 X3.3757 Y2.0725 Z-0.0121 F30
+G1 X3.3607 Y2.0479 Z-0.0073 F30
+G1 X3.3315 Y2.0475 Z-0.0050 F30
+G1 X3.3123 Y2.0254 Z-0.0073 F30
+G1 X3.3066 Y2.0243 Z-0.0121 F30
+G1 X3.3032 Y2.0215 Z-0.0150 F30
+G1 X3.2743 Y2.0177 Z-0.0133 F30
+G1 X3.2700 Y2.0207 Z-0.0086 F30
+G1 X3.2413 Y2.0179 Z-0.0052 F30
+G0 Z0.100
+G0 X3.7500 Y2.0000
+G1 Z-0.0100 F10
+G1 X3.7682 Y2.0104 Z-0.0100 F30
+G1 X3.7831 Y2.0211 Z-0.0142 F30
+G1 X3.7970 Y2.0471 Z-0.0145 F30
+G1 X3.7880 Y2.0679 Z-0.0107 F30
+G1 X3.7860 Y2.0800 Z-0.0062 F30
+G1 X3.7868 Y2.1093 Z-0.0052 F30
+G1 X3.7909 Y2.1227 Z-0.0086 F30
+G1 X3.7948 Y2.1294 Z-0.0133 F30
+G1 X3.7922 Y2.1326 Z-0.0149 F30
+G1 X3.7695 Y2.1492 Z-0.0121 F30
+G0 Z0.100
+G0 X4.0000 Y2.0000
+G1 Z-0.0100 F10
+G1 X4.0058 Y1.9708 Z-0.0100 F30
+G1 X4.0234 Y1.9589 Z-0.0142 F30
+G1 X4.0231 Y1.9388 Z-0.0145 F30
+G1 X4.0026 Y1.9292 Z-0.0107 F30
+G1 X3.9845 Y1.9253 Z-0.0062 F30
+G1 X3.9722 Y1.9159 Z-0.0052 F30
+G1 X3.9644 Y1.9021 Z-0.0086 F30
+G1 X3.9592 Y1.8866 Z-0.0133 F30
+G1 X3.9596 Y1.8704 Z-0.0149 F30
+G1 X3.9534 Y1.8533 Z-0.0121 F30
+G0 Z0.100
+G0 X4.2500 Y2.0000
+G1 Z-0.0100 F10
+G1 X4.2451 Y2.0228 Z-0.0100 F30
+G1 X4.2469 Y2.0452 Z-0.0142 F30
+G1 X4.2526 Y2.0620 Z-0.0145 F30
+G1 X4.2540 Y2.0835 Z-0.0107 F30
+G1 X4.2636 Y2.1015 Z-0.0062 F30
+G1 X4.2673 Y2.1106 Z-0.0052 F30
+G1 X4.2686 Y2.1214 Z-0.0086 F30
+G1 X4.2562 Y2.1320 Z-0.0133 F30
+G1 X4.2389 Y2.1350 Z-0.0149 F30
+G1 X4.2294 Y2.1372 Z-0.0121 F30
+G1 X4.2164 Y2.1622 Z-0.0073 F30
+G1 X4.2072 Y2.1772 Z-0.0050 F30
+G0 Z0.100
+G0 X4.5000 Y2.0000
+G1 Z-0.0100 F10
+G1 X4.5159 Y2.0145 Z-0.0100 F30
+G1 X4.5370 Y2.0125 Z-0.0142 F30
+G1 X4.5555 Y1.9907 Z-0.0145 F30
+G1 X4.5765 Y1.9904 Z-0.0107 F30
+G1 X4.5834 Y2.0006 Z-0.0062 F30
+G1 X4.6047 Y2.0164 Z-0.0052 F30
+G1 X4.6178 Y2.0230 Z-0.0086 F30
+G1 X4.6257 Y2.0342 Z-0.0133 F30
+G1 X4.6429 Y2.0467 Z-0.0149 F30
+G1 X4.6521 Y2.0542 Z-0.0121 F30
+G1 X4.6574 Y2.0640 Z-0.0073 F30
+G1 X4.6706 Y2.0724 Z-0.0050 F30
+G1 X4.6897 Y2.0652 Z-0.0073 F30
+G1 X4.6981 Y2.0668 Z-0.0121 F30
+G0 Z0.100
+G0 X4.7500 Y2.0000
+G1 Z-0.0100 F10
+G1 X4.7527 Y2.0133 Z-0.0100 F30
+G1 X4.7541 Y2.0233 Z-0.0142 F30
+G1 X4.7598 Y2.0349 Z-0.0145 F30
+G1 X4.7628 Y2.0382 Z-0.0107 F30
+G1 X4.7816 Y2.0402 Z-0.0062 F30
+G1 X4.7866 Y2.0332 Z-0.0052 F30
+G1 X4.7967 Y2.0286 Z-0.0086 F30
+G1 X4.8035 Y2.0208 Z-0.0133 F30
+G1 X4.8099 Y2.0205 Z-0.0149 F30
+G1 X4.8352 Y2.0278 Z-0.0121 F30
+G1 X4.8488 Y2.0214 Z-0.0073 F30
+G1 X4.8681 Y2.0266 Z-0.0050 F30
+G1 X4.8733 Y2.0264 Z-0.0073 F30
+G1 X4.8866 Y2.0240 Z-0.0121 F30
+G0 Z0.100
+G0 X0 Y0
+M5
+M2
@@ -0,0 +1,150 @@
+(Grbl benchmark corpus: 2.5D circular pocket and rounded contours)
+G21 G90 G17 G94
+M3
+M8
+G0 Z2.000
+G0 X30.000 Y30.000
+G1 Z0.000 F300
+G91
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G2 X0 Y0 I-2.000 J0 Z-0.250 F600
+G90
+G1 Z-2.000 F300
+G1 X31.000 Y30.000 F900
+G3 X29.000 Y30.000 I-1.000 J0.000
+G3 X31.000 Y30.000 I1.000 J0.000
+G1 X32.500 Y30.000 F900
+G3 X27.500 Y30.000 I-2.500 J0.000
+G3 X32.500 Y30.000 I2.500 J0.000
+G1 X34.000 Y30.000 F900
+G3 X26.000 Y30.000 I-4.000 J0.000
+G3 X34.000 Y30.000 I4.000 J0.000
+G1 X35.500 Y30.000 F900
+G3 X24.500 Y30.000 I-5.500 J0.000
+G3 X35.500 Y30.000 I5.500 J0.000
+G1 X37.000 Y30.000 F900
+G3 X23.000 Y30.000 I-7.000 J0.000
+G3 X37.000 Y30.000 I7.000 J0.000
+G1 X38.500 Y30.000 F900
+G3 X21.500 Y30.000 I-8.500 J0.000
+G3 X38.500 Y30.000 I8.500 J0.000
+G1 X40.000 Y30.000 F900
+G3 X20.000 Y30.000 I-10.000 J0.000
+G3 X40.000 Y30.000 I10.000 J0.000
+G1 X41.500 Y30.000 F900
+G3 X18.500 Y30.000 I-11.500 J0.000
+G3 X41.500 Y30.000 I11.500 J0.000
+G1 X43.000 Y30.000 F900
+G3 X17.000 Y30.000 I-13.000 J0.000
+G3 X43.000 Y30.000 I13.000 J0.000
+G1 X44.500 Y30.000 F900
+G3 X15.500 Y30.000 I-14.500 J0.000
+G3 X44.500 Y30.000 I14.500 J0.000
+G1 X46.000 Y30.000 F900
+G3 X14.000 Y30.000 I-16.000 J0.000
+G3 X46.000 Y30.000 I16.000 J0.000
+G1 X47.500 Y30.000 F900
+G3 X12.500 Y30.000 I-17.500 J0.000
+G3 X47.500 Y30.000 I17.500 J0.000
+G1 X9.000 Y5.000
+G1 X51.000 Y5.000
+G3 X55.000 Y9.000 R4.000
+G1 X55.000 Y51.000
+G3 X51.000 Y55.000 R4.000
+G1 X9.000 Y55.000
+G3 X5.000 Y51.000 R4.000
+G1 X5.000 Y9.000
+G3 X9.000 Y5.000 R4.000
+G1 X8.500 Y4.500
+G1 X51.500 Y4.500
+G3 X55.500 Y8.500 R4.000
+G1 X55.500 Y51.500
+G3 X51.500 Y55.500 R4.000
+G1 X8.500 Y55.500
+G3 X4.500 Y51.500 R4.000
+G1 X4.500 Y8.500
+G3 X8.500 Y4.500 R4.000
+G1 X8.000 Y4.000
+G1 X52.000 Y4.000
+G3 X56.000 Y8.000 R4.000
+G1 X56.000 Y52.000
+G3 X52.000 Y56.000 R4.000
+G1 X8.000 Y56.000
+G3 X4.000 Y52.000 R4.000
+G1 X4.000 Y8.000
+G3 X8.000 Y4.000 R4.000
+G1 Z-4.000 F300
+G1 X31.000 Y30.000 F900
+G3 X29.000 Y30.000 I-1.000 J0.000
+G3 X31.000 Y30.000 I1.000 J0.000
+G1 X32.500 Y30.000 F900
+G3 X27.500 Y30.000 I-2.500 J0.000
+G3 X32.500 Y30.000 I2.500 J0.000
+G1 X34.000 Y30.000 F900
+G3 X26.000 Y30.000 I-4.000 J0.000
+G3 X34.000 Y30.000 I4.000 J0.000
+G1 X35.500 Y30.000 F900
+G3 X24.500 Y30.000 I-5.500 J0.000
+G3 X35.500 Y30.000 I5.500 J0.000
+G1 X37.000 Y30.000 F900
+G3 X23.000 Y30.000 I-7.000 J0.000
+G3 X37.000 Y30.000 I7.000 J0.000
+G1 X38.500 Y30.000 F900
+G3 X21.500 Y30.000 I-8.500 J0.000
+G3 X38.500 Y30.000 I8.500 J0.000
+G1 X40.000 Y30.000 F900
+G3 X20.000 Y30.000 I-10.000 J0.000
+G3 X40.000 Y30.000 I10.000 J0.000
+G1 X41.500 Y30.000 F900
+G3 X18.500 Y30.000 I-11.500 J0.000
+G3 X41.500 Y30.000 I11.500 J0.000
+G1 X43.000 Y30.000 F900
+G3 X17.000 Y30.000 I-13.000 J0.000
+G3 X43.000 Y30.000 I13.000 J0.000
+G1 X44.500 Y30.000 F900
+G3 X15.500 Y30.000 I-14.500 J0.000
+G3 X44.500 Y30.000 I14.500 J0.000
+G1 X46.000 Y30.000 F900
+G3 X14.000 Y30.000 I-16.000 J0.000
+G3 X46.000 Y30.000 I16.000 J0.000
+G1 X47.500 Y30.000 F900
+G3 X12.500 Y30.000 I-17.500 J0.000
+G3 X47.500 Y30.000 I17.500 J0.000
+G1 X9.000 Y5.000
+G1 X51.000 Y5.000
+G3 X55.000 Y9.000 R4.000
+G1 X55.000 Y51.000
+G3 X51.000 Y55.000 R4.000
+G1 X9.000 Y55.000
+G3 X5.000 Y51.000 R4.000
+G1 X5.000 Y9.000
+G3 X9.000 Y5.000 R4.000
+G1 X8.500 Y4.500
+G1 X51.500 Y4.500
+G3 X55.500 Y8.500 R4.000
+G1 X55.500 Y51.500
+G3 X51.500 Y55.500 R4.000
+G1 X8.500 Y55.500
+G3 X4.500 Y51.500 R4.000
+G1 X4.500 Y8.500
+G3 X8.500 Y4.500 R4.000
+G1 X8.000 Y4.000
+G1 X52.000 Y4.000
+G3 X56.000 Y8.000 R4.000
+G1 X56.000 Y52.000
+G3 X52.000 Y56.000 R4.000
+G1 X8.000 Y56.000
+G3 X4.000 Y52.000 R4.000
+G1 X4.000 Y8.000
+G3 X8.000 Y4.000 R4.000
+G0 Z5.000
+M9
+M5
+G0 X0 Y0
+M30
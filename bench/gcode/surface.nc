@@ -0,0 +1,3060 @@
+(Grbl benchmark corpus: 3D surface finishing raster, ball end mill)
+(Short linear segments as emitted by CAM for a sculpted surface)
+G21 G90 G17 G94
+G54
+M3
+G0 Z5.000
+G0 X0.000 Y0.000
+G1 Z-1.000 F400
+G1 X0.000 Y0.000 Z-1.000 F1500
+X0.400 Y0.000 Z-0.890
+X0.800 Y0.000 Z-0.788
+X1.200 Y0.000 Z-0.704
+X1.600 Y0.000 Z-0.644
+X2.000 Y0.000 Z-0.609
+X2.400 Y0.000 Z-0.600
+X2.800 Y0.000 Z-0.614
+X3.200 Y0.000 Z-0.643
+X3.600 Y0.000 Z-0.681
+X4.000 Y0.000 Z-0.717
+X4.400 Y0.000 Z-0.744
+X4.800 Y0.000 Z-0.754
+X5.200 Y0.000 Z-0.743
+X5.600 Y0.000 Z-0.707
+X6.000 Y0.000 Z-0.650
+X6.400 Y0.000 Z-0.575
+X6.800 Y0.000 Z-0.489
+X7.200 Y0.000 Z-0.402
+X7.600 Y0.000 Z-0.322
+X8.000 Y0.000 Z-0.258
+X8.400 Y0.000 Z-0.217
+X8.800 Y0.000 Z-0.204
+X9.200 Y0.000 Z-0.218
+X9.600 Y0.000 Z-0.259
+X10.000 Y0.000 Z-0.320
+X10.400 Y0.000 Z-0.395
+X10.800 Y0.000 Z-0.474
+X11.200 Y0.000 Z-0.548
+X11.600 Y0.000 Z-0.609
+X12.000 Y0.000 Z-0.651
+X12.400 Y0.000 Z-0.670
+X12.800 Y0.000 Z-0.666
+X13.200 Y0.000 Z-0.642
+X13.600 Y0.000 Z-0.604
+X14.000 Y0.000 Z-0.559
+X14.400 Y0.000 Z-0.518
+X14.800 Y0.000 Z-0.488
+X15.200 Y0.000 Z-0.478
+X15.600 Y0.000 Z-0.492
+X16.000 Y0.000 Z-0.533
+X16.400 Y0.000 Z-0.599
+X16.800 Y0.000 Z-0.688
+X17.200 Y0.000 Z-0.792
+X17.600 Y0.000 Z-0.902
+X18.000 Y0.000 Z-1.010
+X18.400 Y0.000 Z-1.106
+X18.800 Y0.000 Z-1.182
+X19.200 Y0.000 Z-1.235
+X19.600 Y0.000 Z-1.262
+X20.000 Y0.000 Z-1.265
+X20.400 Y0.000 Z-1.247
+X20.800 Y0.000 Z-1.217
+X21.200 Y0.000 Z-1.183
+X21.600 Y0.000 Z-1.154
+X22.000 Y0.000 Z-1.138
+X22.400 Y0.000 Z-1.141
+X22.800 Y0.000 Z-1.168
+X23.200 Y0.000 Z-1.219
+X23.600 Y0.000 Z-1.290
+X24.000 Y0.000 Z-1.378
+X24.400 Y0.000 Z-1.473
+X24.800 Y0.000 Z-1.567
+X25.200 Y0.000 Z-1.650
+X25.600 Y0.000 Z-1.715
+X26.000 Y0.000 Z-1.755
+X26.400 Y0.000 Z-1.767
+X26.800 Y0.000 Z-1.752
+X27.200 Y0.000 Z-1.712
+X27.600 Y0.000 Z-1.654
+X28.000 Y0.000 Z-1.586
+X28.400 Y0.000 Z-1.517
+X28.800 Y0.000 Z-1.456
+X29.200 Y0.000 Z-1.411
+X29.600 Y0.000 Z-1.386
+X30.000 Y0.000 Z-1.384
+X30.400 Y0.000 Z-1.404
+X30.800 Y0.000 Z-1.442
+X31.200 Y0.000 Z-1.491
+X31.600 Y0.000 Z-1.543
+X32.000 Y0.000 Z-1.588
+X32.400 Y0.000 Z-1.619
+X32.800 Y0.000 Z-1.627
+X33.200 Y0.000 Z-1.609
+X33.600 Y0.000 Z-1.563
+X34.000 Y0.000 Z-1.493
+X34.400 Y0.000 Z-1.402
+X34.800 Y0.000 Z-1.298
+X35.200 Y0.000 Z-1.191
+X35.600 Y0.000 Z-1.089
+X36.000 Y0.000 Z-1.001
+X36.400 Y0.000 Z-0.934
+X36.800 Y0.000 Z-0.891
+X37.200 Y0.000 Z-0.874
+X37.600 Y0.000 Z-0.878
+X38.000 Y0.000 Z-0.900
+X38.400 Y0.000 Z-0.931
+X38.800 Y0.000 Z-0.961
+X39.200 Y0.000 Z-0.984
+X39.600 Y0.000 Z-0.990
+X40.000 Y0.000 Z-0.974
+X40.400 Y0.000 Z-0.934
+X40.800 Y0.000 Z-0.870
+X41.200 Y0.000 Z-0.786
+X41.600 Y0.000 Z-0.688
+X42.000 Y0.000 Z-0.586
+X42.400 Y0.000 Z-0.488
+X42.800 Y0.000 Z-0.403
+X43.200 Y0.000 Z-0.339
+X43.600 Y0.000 Z-0.301
+X44.000 Y0.000 Z-0.290
+X44.400 Y0.000 Z-0.307
+X44.800 Y0.000 Z-0.345
+X45.200 Y0.000 Z-0.399
+X45.600 Y0.000 Z-0.459
+X46.000 Y0.000 Z-0.517
+X46.400 Y0.000 Z-0.563
+X46.800 Y0.000 Z-0.592
+X47.200 Y0.000 Z-0.600
+X47.600 Y0.000 Z-0.584
+X48.000 Y0.000 Z-0.547
+X48.400 Y0.000 Z-0.495
+X48.800 Y0.000 Z-0.436
+X49.200 Y0.000 Z-0.377
+X49.600 Y0.000 Z-0.328
+X50.000 Y0.000 Z-0.297
+G1 Y0.500
+X50.000 Y0.500 Z-0.271
+X49.600 Y0.500 Z-0.270
+X49.200 Y0.500 Z-0.295
+X48.800 Y0.500 Z-0.341
+X48.400 Y0.500 Z-0.401
+X48.000 Y0.500 Z-0.465
+X47.600 Y0.500 Z-0.525
+X47.200 Y0.500 Z-0.572
+X46.800 Y0.500 Z-0.600
+X46.400 Y0.500 Z-0.605
+X46.000 Y0.500 Z-0.588
+X45.600 Y0.500 Z-0.551
+X45.200 Y0.500 Z-0.500
+X44.800 Y0.500 Z-0.443
+X44.400 Y0.500 Z-0.389
+X44.000 Y0.500 Z-0.347
+X43.600 Y0.500 Z-0.325
+X43.200 Y0.500 Z-0.327
+X42.800 Y0.500 Z-0.358
+X42.400 Y0.500 Z-0.415
+X42.000 Y0.500 Z-0.495
+X41.600 Y0.500 Z-0.591
+X41.200 Y0.500 Z-0.695
+X40.800 Y0.500 Z-0.797
+X40.400 Y0.500 Z-0.889
+X40.000 Y0.500 Z-0.963
+X39.600 Y0.500 Z-1.014
+X39.200 Y0.500 Z-1.040
+X38.800 Y0.500 Z-1.043
+X38.400 Y0.500 Z-1.027
+X38.000 Y0.500 Z-0.998
+X37.600 Y0.500 Z-0.967
+X37.200 Y0.500 Z-0.940
+X36.800 Y0.500 Z-0.928
+X36.400 Y0.500 Z-0.936
+X36.000 Y0.500 Z-0.968
+X35.600 Y0.500 Z-1.024
+X35.200 Y0.500 Z-1.103
+X34.800 Y0.500 Z-1.199
+X34.400 Y0.500 Z-1.303
+X34.000 Y0.500 Z-1.407
+X33.600 Y0.500 Z-1.502
+X33.200 Y0.500 Z-1.579
+X32.800 Y0.500 Z-1.632
+X32.400 Y0.500 Z-1.658
+X32.000 Y0.500 Z-1.657
+X31.600 Y0.500 Z-1.631
+X31.200 Y0.500 Z-1.588
+X30.800 Y0.500 Z-1.534
+X30.400 Y0.500 Z-1.479
+X30.000 Y0.500 Z-1.433
+X29.600 Y0.500 Z-1.401
+X29.200 Y0.500 Z-1.390
+X28.800 Y0.500 Z-1.403
+X28.400 Y0.500 Z-1.437
+X28.000 Y0.500 Z-1.489
+X27.600 Y0.500 Z-1.552
+X27.200 Y0.500 Z-1.618
+X26.800 Y0.500 Z-1.677
+X26.400 Y0.500 Z-1.721
+X26.000 Y0.500 Z-1.743
+X25.600 Y0.500 Z-1.739
+X25.200 Y0.500 Z-1.706
+X24.800 Y0.500 Z-1.647
+X24.400 Y0.500 Z-1.567
+X24.000 Y0.500 Z-1.474
+X23.600 Y0.500 Z-1.375
+X23.200 Y0.500 Z-1.281
+X22.800 Y0.500 Z-1.200
+X22.400 Y0.500 Z-1.139
+X22.000 Y0.500 Z-1.101
+X21.600 Y0.500 Z-1.087
+X21.200 Y0.500 Z-1.094
+X20.800 Y0.500 Z-1.118
+X20.400 Y0.500 Z-1.150
+X20.000 Y0.500 Z-1.182
+X19.600 Y0.500 Z-1.205
+X19.200 Y0.500 Z-1.210
+X18.800 Y0.500 Z-1.193
+X18.400 Y0.500 Z-1.151
+X18.000 Y0.500 Z-1.083
+X17.600 Y0.500 Z-0.995
+X17.200 Y0.500 Z-0.892
+X16.800 Y0.500 Z-0.782
+X16.400 Y0.500 Z-0.676
+X16.000 Y0.500 Z-0.582
+X15.600 Y0.500 Z-0.508
+X15.200 Y0.500 Z-0.459
+X14.800 Y0.500 Z-0.437
+X14.400 Y0.500 Z-0.441
+X14.000 Y0.500 Z-0.467
+X13.600 Y0.500 Z-0.507
+X13.200 Y0.500 Z-0.554
+X12.800 Y0.500 Z-0.599
+X12.400 Y0.500 Z-0.632
+X12.000 Y0.500 Z-0.648
+X11.600 Y0.500 Z-0.641
+X11.200 Y0.500 Z-0.612
+X10.800 Y0.500 Z-0.561
+X10.400 Y0.500 Z-0.495
+X10.000 Y0.500 Z-0.421
+X9.600 Y0.500 Z-0.347
+X9.200 Y0.500 Z-0.283
+X8.800 Y0.500 Z-0.237
+X8.400 Y0.500 Z-0.216
+X8.000 Y0.500 Z-0.222
+X7.600 Y0.500 Z-0.256
+X7.200 Y0.500 Z-0.315
+X6.800 Y0.500 Z-0.393
+X6.400 Y0.500 Z-0.482
+X6.000 Y0.500 Z-0.572
+X5.600 Y0.500 Z-0.656
+X5.200 Y0.500 Z-0.724
+X4.800 Y0.500 Z-0.771
+X4.400 Y0.500 Z-0.794
+X4.000 Y0.500 Z-0.794
+X3.600 Y0.500 Z-0.776
+X3.200 Y0.500 Z-0.744
+X2.800 Y0.500 Z-0.707
+X2.400 Y0.500 Z-0.675
+X2.000 Y0.500 Z-0.656
+X1.600 Y0.500 Z-0.656
+X1.200 Y0.500 Z-0.681
+X0.800 Y0.500 Z-0.733
+X0.400 Y0.500 Z-0.809
+X0.000 Y0.500 Z-0.904
+G1 Y1.000
+X0.000 Y1.000 Z-0.832
+X0.400 Y1.000 Z-0.765
+X0.800 Y1.000 Z-0.724
+X1.200 Y1.000 Z-0.709
+X1.600 Y1.000 Z-0.716
+X2.000 Y1.000 Z-0.741
+X2.400 Y1.000 Z-0.775
+X2.800 Y1.000 Z-0.809
+X3.200 Y1.000 Z-0.836
+X3.600 Y1.000 Z-0.846
+X4.000 Y1.000 Z-0.835
+X4.400 Y1.000 Z-0.800
+X4.800 Y1.000 Z-0.742
+X5.200 Y1.000 Z-0.665
+X5.600 Y1.000 Z-0.576
+X6.000 Y1.000 Z-0.482
+X6.400 Y1.000 Z-0.393
+X6.800 Y1.000 Z-0.319
+X7.200 Y1.000 Z-0.266
+X7.600 Y1.000 Z-0.239
+X8.000 Y1.000 Z-0.240
+X8.400 Y1.000 Z-0.268
+X8.800 Y1.000 Z-0.318
+X9.200 Y1.000 Z-0.384
+X9.600 Y1.000 Z-0.455
+X10.000 Y1.000 Z-0.523
+X10.400 Y1.000 Z-0.581
+X10.800 Y1.000 Z-0.620
+X11.200 Y1.000 Z-0.637
+X11.600 Y1.000 Z-0.631
+X12.000 Y1.000 Z-0.604
+X12.400 Y1.000 Z-0.562
+X12.800 Y1.000 Z-0.512
+X13.200 Y1.000 Z-0.463
+X13.600 Y1.000 Z-0.424
+X14.000 Y1.000 Z-0.403
+X14.400 Y1.000 Z-0.406
+X14.800 Y1.000 Z-0.436
+X15.200 Y1.000 Z-0.493
+X15.600 Y1.000 Z-0.573
+X16.000 Y1.000 Z-0.670
+X16.400 Y1.000 Z-0.777
+X16.800 Y1.000 Z-0.883
+X17.200 Y1.000 Z-0.980
+X17.600 Y1.000 Z-1.059
+X18.000 Y1.000 Z-1.116
+X18.400 Y1.000 Z-1.148
+X18.800 Y1.000 Z-1.155
+X19.200 Y1.000 Z-1.142
+X19.600 Y1.000 Z-1.115
+X20.000 Y1.000 Z-1.082
+X20.400 Y1.000 Z-1.053
+X20.800 Y1.000 Z-1.035
+X21.200 Y1.000 Z-1.036
+X21.600 Y1.000 Z-1.060
+X22.000 Y1.000 Z-1.109
+X22.400 Y1.000 Z-1.180
+X22.800 Y1.000 Z-1.269
+X23.200 Y1.000 Z-1.368
+X23.600 Y1.000 Z-1.468
+X24.000 Y1.000 Z-1.559
+X24.400 Y1.000 Z-1.634
+X24.800 Y1.000 Z-1.686
+X25.200 Y1.000 Z-1.711
+X25.600 Y1.000 Z-1.708
+X26.000 Y1.000 Z-1.680
+X26.400 Y1.000 Z-1.632
+X26.800 Y1.000 Z-1.573
+X27.200 Y1.000 Z-1.511
+X27.600 Y1.000 Z-1.454
+X28.000 Y1.000 Z-1.412
+X28.400 Y1.000 Z-1.390
+X28.800 Y1.000 Z-1.390
+X29.200 Y1.000 Z-1.413
+X29.600 Y1.000 Z-1.455
+X30.000 Y1.000 Z-1.510
+X30.400 Y1.000 Z-1.569
+X30.800 Y1.000 Z-1.623
+X31.200 Y1.000 Z-1.664
+X31.600 Y1.000 Z-1.684
+X32.000 Y1.000 Z-1.678
+X32.400 Y1.000 Z-1.645
+X32.800 Y1.000 Z-1.585
+X33.200 Y1.000 Z-1.503
+X33.600 Y1.000 Z-1.406
+X34.000 Y1.000 Z-1.303
+X34.400 Y1.000 Z-1.204
+X34.800 Y1.000 Z-1.116
+X35.200 Y1.000 Z-1.047
+X35.600 Y1.000 Z-1.002
+X36.000 Y1.000 Z-0.981
+X36.400 Y1.000 Z-0.983
+X36.800 Y1.000 Z-1.003
+X37.200 Y1.000 Z-1.033
+X37.600 Y1.000 Z-1.065
+X38.000 Y1.000 Z-1.090
+X38.400 Y1.000 Z-1.100
+X38.800 Y1.000 Z-1.088
+X39.200 Y1.000 Z-1.052
+X39.600 Y1.000 Z-0.991
+X40.000 Y1.000 Z-0.909
+X40.400 Y1.000 Z-0.811
+X40.800 Y1.000 Z-0.705
+X41.200 Y1.000 Z-0.602
+X41.600 Y1.000 Z-0.509
+X42.000 Y1.000 Z-0.435
+X42.400 Y1.000 Z-0.386
+X42.800 Y1.000 Z-0.364
+X43.200 Y1.000 Z-0.369
+X43.600 Y1.000 Z-0.397
+X44.000 Y1.000 Z-0.442
+X44.400 Y1.000 Z-0.495
+X44.800 Y1.000 Z-0.548
+X45.200 Y1.000 Z-0.591
+X45.600 Y1.000 Z-0.617
+X46.000 Y1.000 Z-0.622
+X46.400 Y1.000 Z-0.604
+X46.800 Y1.000 Z-0.565
+X47.200 Y1.000 Z-0.508
+X47.600 Y1.000 Z-0.442
+X48.000 Y1.000 Z-0.375
+X48.400 Y1.000 Z-0.316
+X48.800 Y1.000 Z-0.274
+X49.200 Y1.000 Z-0.254
+X49.600 Y1.000 Z-0.262
+X50.000 Y1.000 Z-0.298
+G1 Y1.500
+X50.000 Y1.500 Z-0.375
+X49.600 Y1.500 Z-0.308
+X49.200 Y1.500 Z-0.266
+X48.800 Y1.500 Z-0.251
+X48.400 Y1.500 Z-0.264
+X48.000 Y1.500 Z-0.301
+X47.600 Y1.500 Z-0.359
+X47.200 Y1.500 Z-0.427
+X46.800 Y1.500 Z-0.499
+X46.400 Y1.500 Z-0.563
+X46.000 Y1.500 Z-0.613
+X45.600 Y1.500 Z-0.644
+X45.200 Y1.500 Z-0.651
+X44.800 Y1.500 Z-0.635
+X44.400 Y1.500 Z-0.601
+X44.000 Y1.500 Z-0.554
+X43.600 Y1.500 Z-0.503
+X43.200 Y1.500 Z-0.456
+X42.800 Y1.500 Z-0.423
+X42.400 Y1.500 Z-0.410
+X42.000 Y1.500 Z-0.424
+X41.600 Y1.500 Z-0.464
+X41.200 Y1.500 Z-0.530
+X40.800 Y1.500 Z-0.617
+X40.400 Y1.500 Z-0.719
+X40.000 Y1.500 Z-0.825
+X39.600 Y1.500 Z-0.928
+X39.200 Y1.500 Z-1.017
+X38.800 Y1.500 Z-1.087
+X38.400 Y1.500 Z-1.133
+X38.000 Y1.500 Z-1.153
+X37.600 Y1.500 Z-1.150
+X37.200 Y1.500 Z-1.130
+X36.800 Y1.500 Z-1.098
+X36.400 Y1.500 Z-1.065
+X36.000 Y1.500 Z-1.038
+X35.600 Y1.500 Z-1.026
+X35.200 Y1.500 Z-1.036
+X34.800 Y1.500 Z-1.069
+X34.400 Y1.500 Z-1.127
+X34.000 Y1.500 Z-1.205
+X33.600 Y1.500 Z-1.298
+X33.200 Y1.500 Z-1.398
+X32.800 Y1.500 Z-1.495
+X32.400 Y1.500 Z-1.580
+X32.000 Y1.500 Z-1.646
+X31.600 Y1.500 Z-1.686
+X31.200 Y1.500 Z-1.699
+X30.800 Y1.500 Z-1.685
+X30.400 Y1.500 Z-1.648
+X30.000 Y1.500 Z-1.594
+X29.600 Y1.500 Z-1.532
+X29.200 Y1.500 Z-1.472
+X28.800 Y1.500 Z-1.420
+X28.400 Y1.500 Z-1.386
+X28.000 Y1.500 Z-1.373
+X27.600 Y1.500 Z-1.383
+X27.200 Y1.500 Z-1.414
+X26.800 Y1.500 Z-1.462
+X26.400 Y1.500 Z-1.520
+X26.000 Y1.500 Z-1.579
+X25.600 Y1.500 Z-1.629
+X25.200 Y1.500 Z-1.663
+X24.800 Y1.500 Z-1.673
+X24.400 Y1.500 Z-1.657
+X24.000 Y1.500 Z-1.613
+X23.600 Y1.500 Z-1.544
+X23.200 Y1.500 Z-1.456
+X22.800 Y1.500 Z-1.356
+X22.400 Y1.500 Z-1.255
+X22.000 Y1.500 Z-1.160
+X21.600 Y1.500 Z-1.080
+X21.200 Y1.500 Z-1.021
+X20.800 Y1.500 Z-0.987
+X20.400 Y1.500 Z-0.977
+X20.000 Y1.500 Z-0.988
+X19.600 Y1.500 Z-1.014
+X19.200 Y1.500 Z-1.047
+X18.800 Y1.500 Z-1.079
+X18.400 Y1.500 Z-1.099
+X18.000 Y1.500 Z-1.102
+X17.600 Y1.500 Z-1.081
+X17.200 Y1.500 Z-1.036
+X16.800 Y1.500 Z-0.966
+X16.400 Y1.500 Z-0.877
+X16.000 Y1.500 Z-0.776
+X15.600 Y1.500 Z-0.671
+X15.200 Y1.500 Z-0.572
+X14.800 Y1.500 Z-0.487
+X14.400 Y1.500 Z-0.423
+X14.000 Y1.500 Z-0.386
+X13.600 Y1.500 Z-0.376
+X13.200 Y1.500 Z-0.391
+X12.800 Y1.500 Z-0.427
+X12.400 Y1.500 Z-0.477
+X12.000 Y1.500 Z-0.531
+X11.600 Y1.500 Z-0.581
+X11.200 Y1.500 Z-0.619
+X10.800 Y1.500 Z-0.637
+X10.400 Y1.500 Z-0.633
+X10.000 Y1.500 Z-0.605
+X9.600 Y1.500 Z-0.558
+X9.200 Y1.500 Z-0.497
+X8.800 Y1.500 Z-0.429
+X8.400 Y1.500 Z-0.364
+X8.000 Y1.500 Z-0.310
+X7.600 Y1.500 Z-0.276
+X7.200 Y1.500 Z-0.267
+X6.800 Y1.500 Z-0.286
+X6.400 Y1.500 Z-0.332
+X6.000 Y1.500 Z-0.402
+X5.600 Y1.500 Z-0.489
+X5.200 Y1.500 Z-0.584
+X4.800 Y1.500 Z-0.678
+X4.400 Y1.500 Z-0.763
+X4.000 Y1.500 Z-0.831
+X3.600 Y1.500 Z-0.876
+X3.200 Y1.500 Z-0.898
+X2.800 Y1.500 Z-0.896
+X2.400 Y1.500 Z-0.876
+X2.000 Y1.500 Z-0.844
+X1.600 Y1.500 Z-0.809
+X1.200 Y1.500 Z-0.780
+X0.800 Y1.500 Z-0.764
+X0.400 Y1.500 Z-0.770
+X0.000 Y1.500 Z-0.801
+G1 Y2.000
+X0.000 Y2.000 Z-0.818
+X0.400 Y2.000 Z-0.822
+X0.800 Y2.000 Z-0.845
+X1.200 Y2.000 Z-0.878
+X1.600 Y2.000 Z-0.913
+X2.000 Y2.000 Z-0.942
+X2.400 Y2.000 Z-0.955
+X2.800 Y2.000 Z-0.948
+X3.200 Y2.000 Z-0.916
+X3.600 Y2.000 Z-0.861
+X4.000 Y2.000 Z-0.785
+X4.400 Y2.000 Z-0.694
+X4.800 Y2.000 Z-0.596
+X5.200 Y2.000 Z-0.501
+X5.600 Y2.000 Z-0.419
+X6.000 Y2.000 Z-0.355
+X6.400 Y2.000 Z-0.317
+X6.800 Y2.000 Z-0.306
+X7.200 Y2.000 Z-0.323
+X7.600 Y2.000 Z-0.362
+X8.000 Y2.000 Z-0.418
+X8.400 Y2.000 Z-0.482
+X8.800 Y2.000 Z-0.545
+X9.200 Y2.000 Z-0.599
+X9.600 Y2.000 Z-0.635
+X10.000 Y2.000 Z-0.650
+X10.400 Y2.000 Z-0.642
+X10.800 Y2.000 Z-0.612
+X11.200 Y2.000 Z-0.565
+X11.600 Y2.000 Z-0.508
+X12.000 Y2.000 Z-0.451
+X12.400 Y2.000 Z-0.402
+X12.800 Y2.000 Z-0.369
+X13.200 Y2.000 Z-0.360
+X13.600 Y2.000 Z-0.377
+X14.000 Y2.000 Z-0.421
+X14.400 Y2.000 Z-0.491
+X14.800 Y2.000 Z-0.579
+X15.200 Y2.000 Z-0.679
+X15.600 Y2.000 Z-0.780
+X16.000 Y2.000 Z-0.875
+X16.400 Y2.000 Z-0.954
+X16.800 Y2.000 Z-1.012
+X17.200 Y2.000 Z-1.046
+X17.600 Y2.000 Z-1.055
+X18.000 Y2.000 Z-1.043
+X18.400 Y2.000 Z-1.016
+X18.800 Y2.000 Z-0.981
+X19.200 Y2.000 Z-0.949
+X19.600 Y2.000 Z-0.927
+X20.000 Y2.000 Z-0.923
+X20.400 Y2.000 Z-0.942
+X20.800 Y2.000 Z-0.985
+X21.200 Y2.000 Z-1.053
+X21.600 Y2.000 Z-1.140
+X22.000 Y2.000 Z-1.239
+X22.400 Y2.000 Z-1.342
+X22.800 Y2.000 Z-1.439
+X23.200 Y2.000 Z-1.522
+X23.600 Y2.000 Z-1.583
+X24.000 Y2.000 Z-1.618
+X24.400 Y2.000 Z-1.626
+X24.800 Y2.000 Z-1.608
+X25.200 Y2.000 Z-1.569
+X25.600 Y2.000 Z-1.517
+X26.000 Y2.000 Z-1.461
+X26.400 Y2.000 Z-1.409
+X26.800 Y2.000 Z-1.369
+X27.200 Y2.000 Z-1.349
+X27.600 Y2.000 Z-1.351
+X28.000 Y2.000 Z-1.376
+X28.400 Y2.000 Z-1.421
+X28.800 Y2.000 Z-1.481
+X29.200 Y2.000 Z-1.547
+X29.600 Y2.000 Z-1.611
+X30.000 Y2.000 Z-1.663
+X30.400 Y2.000 Z-1.695
+X30.800 Y2.000 Z-1.703
+X31.200 Y2.000 Z-1.683
+X31.600 Y2.000 Z-1.636
+X32.000 Y2.000 Z-1.565
+X32.400 Y2.000 Z-1.478
+X32.800 Y2.000 Z-1.382
+X33.200 Y2.000 Z-1.287
+X33.600 Y2.000 Z-1.202
+X34.000 Y2.000 Z-1.134
+X34.400 Y2.000 Z-1.089
+X34.800 Y2.000 Z-1.068
+X35.200 Y2.000 Z-1.070
+X35.600 Y2.000 Z-1.090
+X36.000 Y2.000 Z-1.123
+X36.400 Y2.000 Z-1.159
+X36.800 Y2.000 Z-1.189
+X37.200 Y2.000 Z-1.205
+X37.600 Y2.000 Z-1.201
+X38.000 Y2.000 Z-1.172
+X38.400 Y2.000 Z-1.117
+X38.800 Y2.000 Z-1.040
+X39.200 Y2.000 Z-0.945
+X39.600 Y2.000 Z-0.840
+X40.000 Y2.000 Z-0.734
+X40.400 Y2.000 Z-0.637
+X40.800 Y2.000 Z-0.556
+X41.200 Y2.000 Z-0.499
+X41.600 Y2.000 Z-0.468
+X42.000 Y2.000 Z-0.464
+X42.400 Y2.000 Z-0.484
+X42.800 Y2.000 Z-0.522
+X43.200 Y2.000 Z-0.569
+X43.600 Y2.000 Z-0.618
+X44.000 Y2.000 Z-0.658
+X44.400 Y2.000 Z-0.683
+X44.800 Y2.000 Z-0.687
+X45.200 Y2.000 Z-0.668
+X45.600 Y2.000 Z-0.627
+X46.000 Y2.000 Z-0.567
+X46.400 Y2.000 Z-0.495
+X46.800 Y2.000 Z-0.421
+X47.200 Y2.000 Z-0.352
+X47.600 Y2.000 Z-0.298
+X48.000 Y2.000 Z-0.266
+X48.400 Y2.000 Z-0.260
+X48.800 Y2.000 Z-0.282
+X49.200 Y2.000 Z-0.331
+X49.600 Y2.000 Z-0.401
+X50.000 Y2.000 Z-0.485
+G1 Y2.500
+X50.000 Y2.500 Z-0.606
+X49.600 Y2.500 Z-0.521
+X49.200 Y2.500 Z-0.437
+X48.800 Y2.500 Z-0.364
+X48.400 Y2.500 Z-0.310
+X48.000 Y2.500 Z-0.281
+X47.600 Y2.500 Z-0.280
+X47.200 Y2.500 Z-0.305
+X46.800 Y2.500 Z-0.355
+X46.400 Y2.500 Z-0.422
+X46.000 Y2.500 Z-0.499
+X45.600 Y2.500 Z-0.576
+X45.200 Y2.500 Z-0.644
+X44.800 Y2.500 Z-0.696
+X44.400 Y2.500 Z-0.727
+X44.000 Y2.500 Z-0.734
+X43.600 Y2.500 Z-0.718
+X43.200 Y2.500 Z-0.685
+X42.800 Y2.500 Z-0.640
+X42.400 Y2.500 Z-0.592
+X42.000 Y2.500 Z-0.551
+X41.600 Y2.500 Z-0.525
+X41.200 Y2.500 Z-0.519
+X40.800 Y2.500 Z-0.540
+X40.400 Y2.500 Z-0.587
+X40.000 Y2.500 Z-0.659
+X39.600 Y2.500 Z-0.751
+X39.200 Y2.500 Z-0.853
+X38.800 Y2.500 Z-0.959
+X38.400 Y2.500 Z-1.058
+X38.000 Y2.500 Z-1.142
+X37.600 Y2.500 Z-1.204
+X37.200 Y2.500 Z-1.242
+X36.800 Y2.500 Z-1.253
+X36.400 Y2.500 Z-1.242
+X36.000 Y2.500 Z-1.214
+X35.600 Y2.500 Z-1.177
+X35.200 Y2.500 Z-1.139
+X34.800 Y2.500 Z-1.110
+X34.400 Y2.500 Z-1.097
+X34.000 Y2.500 Z-1.106
+X33.600 Y2.500 Z-1.138
+X33.200 Y2.500 Z-1.195
+X32.800 Y2.500 Z-1.270
+X32.400 Y2.500 Z-1.359
+X32.000 Y2.500 Z-1.451
+X31.600 Y2.500 Z-1.539
+X31.200 Y2.500 Z-1.614
+X30.800 Y2.500 Z-1.667
+X30.400 Y2.500 Z-1.694
+X30.000 Y2.500 Z-1.693
+X29.600 Y2.500 Z-1.666
+X29.200 Y2.500 Z-1.617
+X28.800 Y2.500 Z-1.554
+X28.400 Y2.500 Z-1.484
+X28.000 Y2.500 Z-1.417
+X27.600 Y2.500 Z-1.362
+X27.200 Y2.500 Z-1.326
+X26.800 Y2.500 Z-1.311
+X26.400 Y2.500 Z-1.320
+X26.000 Y2.500 Z-1.350
+X25.600 Y2.500 Z-1.396
+X25.200 Y2.500 Z-1.449
+X24.800 Y2.500 Z-1.502
+X24.400 Y2.500 Z-1.545
+X24.000 Y2.500 Z-1.570
+X23.600 Y2.500 Z-1.572
+X23.200 Y2.500 Z-1.546
+X22.800 Y2.500 Z-1.494
+X22.400 Y2.500 Z-1.418
+X22.000 Y2.500 Z-1.325
+X21.600 Y2.500 Z-1.223
+X21.200 Y2.500 Z-1.121
+X20.800 Y2.500 Z-1.029
+X20.400 Y2.500 Z-0.954
+X20.000 Y2.500 Z-0.901
+X19.600 Y2.500 Z-0.873
+X19.200 Y2.500 Z-0.870
+X18.800 Y2.500 Z-0.888
+X18.400 Y2.500 Z-0.919
+X18.000 Y2.500 Z-0.955
+X17.600 Y2.500 Z-0.989
+X17.200 Y2.500 Z-1.010
+X16.800 Y2.500 Z-1.012
+X16.400 Y2.500 Z-0.991
+X16.000 Y2.500 Z-0.945
+X15.600 Y2.500 Z-0.876
+X15.200 Y2.500 Z-0.790
+X14.800 Y2.500 Z-0.693
+X14.400 Y2.500 Z-0.595
+X14.000 Y2.500 Z-0.505
+X13.600 Y2.500 Z-0.431
+X13.200 Y2.500 Z-0.380
+X12.800 Y2.500 Z-0.356
+X12.400 Y2.500 Z-0.359
+X12.000 Y2.500 Z-0.387
+X11.600 Y2.500 Z-0.435
+X11.200 Y2.500 Z-0.494
+X10.800 Y2.500 Z-0.555
+X10.400 Y2.500 Z-0.610
+X10.000 Y2.500 Z-0.651
+X9.600 Y2.500 Z-0.672
+X9.200 Y2.500 Z-0.669
+X8.800 Y2.500 Z-0.644
+X8.400 Y2.500 Z-0.600
+X8.000 Y2.500 Z-0.543
+X7.600 Y2.500 Z-0.481
+X7.200 Y2.500 Z-0.423
+X6.800 Y2.500 Z-0.379
+X6.400 Y2.500 Z-0.355
+X6.000 Y2.500 Z-0.357
+X5.600 Y2.500 Z-0.387
+X5.200 Y2.500 Z-0.442
+X4.800 Y2.500 Z-0.520
+X4.400 Y2.500 Z-0.612
+X4.000 Y2.500 Z-0.711
+X3.600 Y2.500 Z-0.806
+X3.200 Y2.500 Z-0.889
+X2.800 Y2.500 Z-0.954
+X2.400 Y2.500 Z-0.995
+X2.000 Y2.500 Z-1.011
+X1.600 Y2.500 Z-1.004
+X1.200 Y2.500 Z-0.980
+X0.800 Y2.500 Z-0.946
+X0.400 Y2.500 Z-0.909
+X0.000 Y2.500 Z-0.880
+G1 Y3.000
+X0.000 Y3.000 Z-0.972
+X0.400 Y3.000 Z-1.010
+X0.800 Y3.000 Z-1.044
+X1.200 Y3.000 Z-1.063
+X1.600 Y3.000 Z-1.062
+X2.000 Y3.000 Z-1.037
+X2.400 Y3.000 Z-0.987
+X2.800 Y3.000 Z-0.915
+X3.200 Y3.000 Z-0.827
+X3.600 Y3.000 Z-0.729
+X4.000 Y3.000 Z-0.631
+X4.400 Y3.000 Z-0.543
+X4.800 Y3.000 Z-0.473
+X5.200 Y3.000 Z-0.426
+X5.600 Y3.000 Z-0.406
+X6.000 Y3.000 Z-0.412
+X6.400 Y3.000 Z-0.443
+X6.800 Y3.000 Z-0.491
+X7.200 Y3.000 Z-0.549
+X7.600 Y3.000 Z-0.608
+X8.000 Y3.000 Z-0.659
+X8.400 Y3.000 Z-0.693
+X8.800 Y3.000 Z-0.707
+X9.200 Y3.000 Z-0.697
+X9.600 Y3.000 Z-0.665
+X10.000 Y3.000 Z-0.614
+X10.400 Y3.000 Z-0.552
+X10.800 Y3.000 Z-0.487
+X11.200 Y3.000 Z-0.428
+X11.600 Y3.000 Z-0.384
+X12.000 Y3.000 Z-0.361
+X12.400 Y3.000 Z-0.364
+X12.800 Y3.000 Z-0.396
+X13.200 Y3.000 Z-0.452
+X13.600 Y3.000 Z-0.530
+X14.000 Y3.000 Z-0.620
+X14.400 Y3.000 Z-0.715
+X14.800 Y3.000 Z-0.805
+X15.200 Y3.000 Z-0.882
+X15.600 Y3.000 Z-0.939
+X16.000 Y3.000 Z-0.972
+X16.400 Y3.000 Z-0.981
+X16.800 Y3.000 Z-0.967
+X17.200 Y3.000 Z-0.938
+X17.600 Y3.000 Z-0.900
+X18.000 Y3.000 Z-0.861
+X18.400 Y3.000 Z-0.832
+X18.800 Y3.000 Z-0.820
+X19.200 Y3.000 Z-0.831
+X19.600 Y3.000 Z-0.867
+X20.000 Y3.000 Z-0.927
+X20.400 Y3.000 Z-1.009
+X20.800 Y3.000 Z-1.105
+X21.200 Y3.000 Z-1.207
+X21.600 Y3.000 Z-1.306
+X22.000 Y3.000 Z-1.393
+X22.400 Y3.000 Z-1.460
+X22.800 Y3.000 Z-1.503
+X23.200 Y3.000 Z-1.518
+X23.600 Y3.000 Z-1.508
+X24.000 Y3.000 Z-1.476
+X24.400 Y3.000 Z-1.430
+X24.800 Y3.000 Z-1.377
+X25.200 Y3.000 Z-1.328
+X25.600 Y3.000 Z-1.289
+X26.000 Y3.000 Z-1.269
+X26.400 Y3.000 Z-1.272
+X26.800 Y3.000 Z-1.297
+X27.200 Y3.000 Z-1.345
+X27.600 Y3.000 Z-1.408
+X28.000 Y3.000 Z-1.480
+X28.400 Y3.000 Z-1.551
+X28.800 Y3.000 Z-1.614
+X29.200 Y3.000 Z-1.658
+X29.600 Y3.000 Z-1.679
+X30.000 Y3.000 Z-1.672
+X30.400 Y3.000 Z-1.639
+X30.800 Y3.000 Z-1.580
+X31.200 Y3.000 Z-1.503
+X31.600 Y3.000 Z-1.416
+X32.000 Y3.000 Z-1.328
+X32.400 Y3.000 Z-1.247
+X32.800 Y3.000 Z-1.182
+X33.200 Y3.000 Z-1.139
+X33.600 Y3.000 Z-1.119
+X34.000 Y3.000 Z-1.123
+X34.400 Y3.000 Z-1.146
+X34.800 Y3.000 Z-1.183
+X35.200 Y3.000 Z-1.225
+X35.600 Y3.000 Z-1.263
+X36.000 Y3.000 Z-1.288
+X36.400 Y3.000 Z-1.293
+X36.800 Y3.000 Z-1.274
+X37.200 Y3.000 Z-1.229
+X37.600 Y3.000 Z-1.160
+X38.000 Y3.000 Z-1.071
+X38.400 Y3.000 Z-0.970
+X38.800 Y3.000 Z-0.866
+X39.200 Y3.000 Z-0.768
+X39.600 Y3.000 Z-0.684
+X40.000 Y3.000 Z-0.622
+X40.400 Y3.000 Z-0.585
+X40.800 Y3.000 Z-0.575
+X41.200 Y3.000 Z-0.589
+X41.600 Y3.000 Z-0.622
+X42.000 Y3.000 Z-0.667
+X42.400 Y3.000 Z-0.713
+X42.800 Y3.000 Z-0.754
+X43.200 Y3.000 Z-0.779
+X43.600 Y3.000 Z-0.785
+X44.000 Y3.000 Z-0.767
+X44.400 Y3.000 Z-0.726
+X44.800 Y3.000 Z-0.664
+X45.200 Y3.000 Z-0.590
+X45.600 Y3.000 Z-0.509
+X46.000 Y3.000 Z-0.432
+X46.400 Y3.000 Z-0.368
+X46.800 Y3.000 Z-0.324
+X47.200 Y3.000 Z-0.305
+X47.600 Y3.000 Z-0.315
+X48.000 Y3.000 Z-0.350
+X48.400 Y3.000 Z-0.409
+X48.800 Y3.000 Z-0.483
+X49.200 Y3.000 Z-0.565
+X49.600 Y3.000 Z-0.645
+X50.000 Y3.000 Z-0.714
+G1 Y3.500
+X50.000 Y3.500 Z-0.789
+X49.600 Y3.500 Z-0.750
+X49.200 Y3.500 Z-0.690
+X48.800 Y3.500 Z-0.617
+X48.400 Y3.500 Z-0.539
+X48.000 Y3.500 Z-0.464
+X47.600 Y3.500 Z-0.401
+X47.200 Y3.500 Z-0.359
+X46.800 Y3.500 Z-0.342
+X46.400 Y3.500 Z-0.353
+X46.000 Y3.500 Z-0.390
+X45.600 Y3.500 Z-0.450
+X45.200 Y3.500 Z-0.525
+X44.800 Y3.500 Z-0.607
+X44.400 Y3.500 Z-0.687
+X44.000 Y3.500 Z-0.756
+X43.600 Y3.500 Z-0.807
+X43.200 Y3.500 Z-0.836
+X42.800 Y3.500 Z-0.840
+X42.400 Y3.500 Z-0.822
+X42.000 Y3.500 Z-0.787
+X41.600 Y3.500 Z-0.742
+X41.200 Y3.500 Z-0.696
+X40.800 Y3.500 Z-0.657
+X40.400 Y3.500 Z-0.634
+X40.000 Y3.500 Z-0.634
+X39.600 Y3.500 Z-0.659
+X39.200 Y3.500 Z-0.710
+X38.800 Y3.500 Z-0.784
+X38.400 Y3.500 Z-0.876
+X38.000 Y3.500 Z-0.977
+X37.600 Y3.500 Z-1.078
+X37.200 Y3.500 Z-1.170
+X36.800 Y3.500 Z-1.245
+X36.400 Y3.500 Z-1.297
+X36.000 Y3.500 Z-1.323
+X35.600 Y3.500 Z-1.324
+X35.200 Y3.500 Z-1.302
+X34.800 Y3.500 Z-1.265
+X34.400 Y3.500 Z-1.220
+X34.000 Y3.500 Z-1.177
+X33.600 Y3.500 Z-1.144
+X33.200 Y3.500 Z-1.128
+X32.800 Y3.500 Z-1.135
+X32.400 Y3.500 Z-1.165
+X32.000 Y3.500 Z-1.219
+X31.600 Y3.500 Z-1.290
+X31.200 Y3.500 Z-1.373
+X30.800 Y3.500 Z-1.458
+X30.400 Y3.500 Z-1.536
+X30.000 Y3.500 Z-1.599
+X29.600 Y3.500 Z-1.639
+X29.200 Y3.500 Z-1.653
+X28.800 Y3.500 Z-1.639
+X28.400 Y3.500 Z-1.600
+X28.000 Y3.500 Z-1.541
+X27.600 Y3.500 Z-1.469
+X27.200 Y3.500 Z-1.394
+X26.800 Y3.500 Z-1.323
+X26.400 Y3.500 Z-1.267
+X26.000 Y3.500 Z-1.230
+X25.600 Y3.500 Z-1.217
+X25.200 Y3.500 Z-1.227
+X24.800 Y3.500 Z-1.257
+X24.400 Y3.500 Z-1.302
+X24.000 Y3.500 Z-1.354
+X23.600 Y3.500 Z-1.403
+X23.200 Y3.500 Z-1.441
+X22.800 Y3.500 Z-1.460
+X22.400 Y3.500 Z-1.455
+X22.000 Y3.500 Z-1.423
+X21.600 Y3.500 Z-1.366
+X21.200 Y3.500 Z-1.286
+X20.800 Y3.500 Z-1.192
+X20.400 Y3.500 Z-1.091
+X20.000 Y3.500 Z-0.993
+X19.600 Y3.500 Z-0.907
+X19.200 Y3.500 Z-0.840
+X18.800 Y3.500 Z-0.796
+X18.400 Y3.500 Z-0.778
+X18.000 Y3.500 Z-0.785
+X17.600 Y3.500 Z-0.811
+X17.200 Y3.500 Z-0.849
+X16.800 Y3.500 Z-0.892
+X16.400 Y3.500 Z-0.929
+X16.000 Y3.500 Z-0.953
+X15.600 Y3.500 Z-0.957
+X15.200 Y3.500 Z-0.937
+X14.800 Y3.500 Z-0.893
+X14.400 Y3.500 Z-0.827
+X14.000 Y3.500 Z-0.745
+X13.600 Y3.500 Z-0.654
+X13.200 Y3.500 Z-0.565
+X12.800 Y3.500 Z-0.485
+X12.400 Y3.500 Z-0.423
+X12.000 Y3.500 Z-0.385
+X11.600 Y3.500 Z-0.375
+X11.200 Y3.500 Z-0.391
+X10.800 Y3.500 Z-0.431
+X10.400 Y3.500 Z-0.489
+X10.000 Y3.500 Z-0.556
+X9.600 Y3.500 Z-0.624
+X9.200 Y3.500 Z-0.683
+X8.800 Y3.500 Z-0.726
+X8.400 Y3.500 Z-0.747
+X8.000 Y3.500 Z-0.745
+X7.600 Y3.500 Z-0.721
+X7.200 Y3.500 Z-0.678
+X6.800 Y3.500 Z-0.623
+X6.400 Y3.500 Z-0.565
+X6.000 Y3.500 Z-0.514
+X5.600 Y3.500 Z-0.476
+X5.200 Y3.500 Z-0.461
+X4.800 Y3.500 Z-0.471
+X4.400 Y3.500 Z-0.508
+X4.000 Y3.500 Z-0.570
+X3.600 Y3.500 Z-0.653
+X3.200 Y3.500 Z-0.747
+X2.800 Y3.500 Z-0.846
+X2.400 Y3.500 Z-0.938
+X2.000 Y3.500 Z-1.016
+X1.600 Y3.500 Z-1.074
+X1.200 Y3.500 Z-1.107
+X0.800 Y3.500 Z-1.115
+X0.400 Y3.500 Z-1.101
+X0.000 Y3.500 Z-1.070
+G1 Y4.000
+X0.000 Y4.000 Z-1.151
+X0.400 Y4.000 Z-1.160
+X0.800 Y4.000 Z-1.144
+X1.200 Y4.000 Z-1.104
+X1.600 Y4.000 Z-1.039
+X2.000 Y4.000 Z-0.956
+X2.400 Y4.000 Z-0.862
+X2.800 Y4.000 Z-0.765
+X3.200 Y4.000 Z-0.675
+X3.600 Y4.000 Z-0.600
+X4.000 Y4.000 Z-0.548
+X4.400 Y4.000 Z-0.521
+X4.800 Y4.000 Z-0.521
+X5.200 Y4.000 Z-0.546
+X5.600 Y4.000 Z-0.589
+X6.000 Y4.000 Z-0.643
+X6.400 Y4.000 Z-0.700
+X6.800 Y4.000 Z-0.749
+X7.200 Y4.000 Z-0.784
+X7.600 Y4.000 Z-0.799
+X8.000 Y4.000 Z-0.790
+X8.400 Y4.000 Z-0.757
+X8.800 Y4.000 Z-0.705
+X9.200 Y4.000 Z-0.639
+X9.600 Y4.000 Z-0.567
+X10.000 Y4.000 Z-0.500
+X10.400 Y4.000 Z-0.445
+X10.800 Y4.000 Z-0.410
+X11.200 Y4.000 Z-0.400
+X11.600 Y4.000 Z-0.418
+X12.000 Y4.000 Z-0.462
+X12.400 Y4.000 Z-0.528
+X12.800 Y4.000 Z-0.609
+X13.200 Y4.000 Z-0.696
+X13.600 Y4.000 Z-0.781
+X14.000 Y4.000 Z-0.853
+X14.400 Y4.000 Z-0.908
+X14.800 Y4.000 Z-0.939
+X15.200 Y4.000 Z-0.945
+X15.600 Y4.000 Z-0.929
+X16.000 Y4.000 Z-0.896
+X16.400 Y4.000 Z-0.852
+X16.800 Y4.000 Z-0.807
+X17.200 Y4.000 Z-0.769
+X17.600 Y4.000 Z-0.746
+X18.000 Y4.000 Z-0.746
+X18.400 Y4.000 Z-0.771
+X18.800 Y4.000 Z-0.821
+X19.200 Y4.000 Z-0.894
+X19.600 Y4.000 Z-0.983
+X20.000 Y4.000 Z-1.081
+X20.400 Y4.000 Z-1.179
+X20.800 Y4.000 Z-1.267
+X21.200 Y4.000 Z-1.337
+X21.600 Y4.000 Z-1.383
+X22.000 Y4.000 Z-1.404
+X22.400 Y4.000 Z-1.398
+X22.800 Y4.000 Z-1.371
+X23.200 Y4.000 Z-1.327
+X23.600 Y4.000 Z-1.276
+X24.000 Y4.000 Z-1.226
+X24.400 Y4.000 Z-1.187
+X24.800 Y4.000 Z-1.164
+X25.200 Y4.000 Z-1.164
+X25.600 Y4.000 Z-1.188
+X26.000 Y4.000 Z-1.235
+X26.400 Y4.000 Z-1.299
+X26.800 Y4.000 Z-1.375
+X27.200 Y4.000 Z-1.452
+X27.600 Y4.000 Z-1.523
+X28.000 Y4.000 Z-1.577
+X28.400 Y4.000 Z-1.610
+X28.800 Y4.000 Z-1.616
+X29.200 Y4.000 Z-1.594
+X29.600 Y4.000 Z-1.548
+X30.000 Y4.000 Z-1.482
+X30.400 Y4.000 Z-1.403
+X30.800 Y4.000 Z-1.322
+X31.200 Y4.000 Z-1.246
+X31.600 Y4.000 Z-1.185
+X32.000 Y4.000 Z-1.143
+X32.400 Y4.000 Z-1.126
+X32.800 Y4.000 Z-1.132
+X33.200 Y4.000 Z-1.160
+X33.600 Y4.000 Z-1.201
+X34.000 Y4.000 Z-1.250
+X34.400 Y4.000 Z-1.297
+X34.800 Y4.000 Z-1.332
+X35.200 Y4.000 Z-1.349
+X35.600 Y4.000 Z-1.343
+X36.000 Y4.000 Z-1.309
+X36.400 Y4.000 Z-1.251
+X36.800 Y4.000 Z-1.172
+X37.200 Y4.000 Z-1.078
+X37.600 Y4.000 Z-0.979
+X38.000 Y4.000 Z-0.883
+X38.400 Y4.000 Z-0.800
+X38.800 Y4.000 Z-0.736
+X39.200 Y4.000 Z-0.697
+X39.600 Y4.000 Z-0.683
+X40.000 Y4.000 Z-0.695
+X40.400 Y4.000 Z-0.726
+X40.800 Y4.000 Z-0.769
+X41.200 Y4.000 Z-0.817
+X41.600 Y4.000 Z-0.860
+X42.000 Y4.000 Z-0.889
+X42.400 Y4.000 Z-0.899
+X42.800 Y4.000 Z-0.885
+X43.200 Y4.000 Z-0.847
+X43.600 Y4.000 Z-0.787
+X44.000 Y4.000 Z-0.712
+X44.400 Y4.000 Z-0.629
+X44.800 Y4.000 Z-0.547
+X45.200 Y4.000 Z-0.475
+X45.600 Y4.000 Z-0.421
+X46.000 Y4.000 Z-0.392
+X46.400 Y4.000 Z-0.389
+X46.800 Y4.000 Z-0.414
+X47.200 Y4.000 Z-0.462
+X47.600 Y4.000 Z-0.527
+X48.000 Y4.000 Z-0.602
+X48.400 Y4.000 Z-0.676
+X48.800 Y4.000 Z-0.741
+X49.200 Y4.000 Z-0.790
+X49.600 Y4.000 Z-0.817
+X50.000 Y4.000 Z-0.820
+G1 Y4.500
+X50.000 Y4.500 Z-0.808
+X49.600 Y4.500 Z-0.839
+X49.200 Y4.500 Z-0.848
+X48.800 Y4.500 Z-0.834
+X48.400 Y4.500 Z-0.796
+X48.000 Y4.500 Z-0.740
+X47.600 Y4.500 Z-0.671
+X47.200 Y4.500 Z-0.598
+X46.800 Y4.500 Z-0.531
+X46.400 Y4.500 Z-0.478
+X46.000 Y4.500 Z-0.445
+X45.600 Y4.500 Z-0.439
+X45.200 Y4.500 Z-0.460
+X44.800 Y4.500 Z-0.506
+X44.400 Y4.500 Z-0.573
+X44.000 Y4.500 Z-0.653
+X43.600 Y4.500 Z-0.738
+X43.200 Y4.500 Z-0.817
+X42.800 Y4.500 Z-0.884
+X42.400 Y4.500 Z-0.931
+X42.000 Y4.500 Z-0.954
+X41.600 Y4.500 Z-0.952
+X41.200 Y4.500 Z-0.929
+X40.800 Y4.500 Z-0.890
+X40.400 Y4.500 Z-0.842
+X40.000 Y4.500 Z-0.794
+X39.600 Y4.500 Z-0.755
+X39.200 Y4.500 Z-0.733
+X38.800 Y4.500 Z-0.734
+X38.400 Y4.500 Z-0.761
+X38.000 Y4.500 Z-0.813
+X37.600 Y4.500 Z-0.887
+X37.200 Y4.500 Z-0.976
+X36.800 Y4.500 Z-1.071
+X36.400 Y4.500 Z-1.165
+X36.000 Y4.500 Z-1.248
+X35.600 Y4.500 Z-1.311
+X35.200 Y4.500 Z-1.351
+X34.800 Y4.500 Z-1.364
+X34.400 Y4.500 Z-1.352
+X34.000 Y4.500 Z-1.319
+X33.600 Y4.500 Z-1.272
+X33.200 Y4.500 Z-1.219
+X32.800 Y4.500 Z-1.169
+X32.400 Y4.500 Z-1.132
+X32.000 Y4.500 Z-1.113
+X31.600 Y4.500 Z-1.117
+X31.200 Y4.500 Z-1.146
+X30.800 Y4.500 Z-1.196
+X30.400 Y4.500 Z-1.264
+X30.000 Y4.500 Z-1.341
+X29.600 Y4.500 Z-1.418
+X29.200 Y4.500 Z-1.487
+X28.800 Y4.500 Z-1.539
+X28.400 Y4.500 Z-1.568
+X28.000 Y4.500 Z-1.570
+X27.600 Y4.500 Z-1.546
+X27.200 Y4.500 Z-1.497
+X26.800 Y4.500 Z-1.430
+X26.400 Y4.500 Z-1.352
+X26.000 Y4.500 Z-1.273
+X25.600 Y4.500 Z-1.203
+X25.200 Y4.500 Z-1.147
+X24.800 Y4.500 Z-1.114
+X24.400 Y4.500 Z-1.104
+X24.000 Y4.500 Z-1.118
+X23.600 Y4.500 Z-1.151
+X23.200 Y4.500 Z-1.198
+X22.800 Y4.500 Z-1.251
+X22.400 Y4.500 Z-1.299
+X22.000 Y4.500 Z-1.335
+X21.600 Y4.500 Z-1.351
+X21.200 Y4.500 Z-1.342
+X20.800 Y4.500 Z-1.308
+X20.400 Y4.500 Z-1.248
+X20.000 Y4.500 Z-1.169
+X19.600 Y4.500 Z-1.076
+X19.200 Y4.500 Z-0.980
+X18.800 Y4.500 Z-0.889
+X18.400 Y4.500 Z-0.812
+X18.000 Y4.500 Z-0.755
+X17.600 Y4.500 Z-0.724
+X17.200 Y4.500 Z-0.718
+X16.800 Y4.500 Z-0.736
+X16.400 Y4.500 Z-0.772
+X16.000 Y4.500 Z-0.819
+X15.600 Y4.500 Z-0.869
+X15.200 Y4.500 Z-0.911
+X14.800 Y4.500 Z-0.938
+X14.400 Y4.500 Z-0.945
+X14.000 Y4.500 Z-0.927
+X13.600 Y4.500 Z-0.885
+X13.200 Y4.500 Z-0.823
+X12.800 Y4.500 Z-0.746
+X12.400 Y4.500 Z-0.662
+X12.000 Y4.500 Z-0.582
+X11.600 Y4.500 Z-0.512
+X11.200 Y4.500 Z-0.463
+X10.800 Y4.500 Z-0.437
+X10.400 Y4.500 Z-0.440
+X10.000 Y4.500 Z-0.468
+X9.600 Y4.500 Z-0.519
+X9.200 Y4.500 Z-0.585
+X8.800 Y4.500 Z-0.658
+X8.400 Y4.500 Z-0.729
+X8.000 Y4.500 Z-0.790
+X7.600 Y4.500 Z-0.832
+X7.200 Y4.500 Z-0.852
+X6.800 Y4.500 Z-0.848
+X6.400 Y4.500 Z-0.822
+X6.000 Y4.500 Z-0.778
+X5.600 Y4.500 Z-0.723
+X5.200 Y4.500 Z-0.667
+X4.800 Y4.500 Z-0.619
+X4.400 Y4.500 Z-0.586
+X4.000 Y4.500 Z-0.575
+X3.600 Y4.500 Z-0.591
+X3.200 Y4.500 Z-0.632
+X2.800 Y4.500 Z-0.698
+X2.400 Y4.500 Z-0.781
+X2.000 Y4.500 Z-0.875
+X1.600 Y4.500 Z-0.969
+X1.200 Y4.500 Z-1.055
+X0.800 Y4.500 Z-1.125
+X0.400 Y4.500 Z-1.173
+X0.000 Y4.500 Z-1.196
+G1 Y5.000
+X0.000 Y5.000 Z-1.192
+X0.400 Y5.000 Z-1.138
+X0.800 Y5.000 Z-1.064
+X1.200 Y5.000 Z-0.976
+X1.600 Y5.000 Z-0.883
+X2.000 Y5.000 Z-0.795
+X2.400 Y5.000 Z-0.720
+X2.800 Y5.000 Z-0.665
+X3.200 Y5.000 Z-0.635
+X3.600 Y5.000 Z-0.632
+X4.000 Y5.000 Z-0.653
+X4.400 Y5.000 Z-0.693
+X4.800 Y5.000 Z-0.747
+X5.200 Y5.000 Z-0.803
+X5.600 Y5.000 Z-0.855
+X6.000 Y5.000 Z-0.893
+X6.400 Y5.000 Z-0.911
+X6.800 Y5.000 Z-0.905
+X7.200 Y5.000 Z-0.875
+X7.600 Y5.000 Z-0.824
+X8.000 Y5.000 Z-0.757
+X8.400 Y5.000 Z-0.682
+X8.800 Y5.000 Z-0.608
+X9.200 Y5.000 Z-0.545
+X9.600 Y5.000 Z-0.500
+X10.000 Y5.000 Z-0.479
+X10.400 Y5.000 Z-0.485
+X10.800 Y5.000 Z-0.517
+X11.200 Y5.000 Z-0.572
+X11.600 Y5.000 Z-0.644
+X12.000 Y5.000 Z-0.724
+X12.400 Y5.000 Z-0.802
+X12.800 Y5.000 Z-0.871
+X13.200 Y5.000 Z-0.922
+X13.600 Y5.000 Z-0.951
+X14.000 Y5.000 Z-0.955
+X14.400 Y5.000 Z-0.936
+X14.800 Y5.000 Z-0.898
+X15.200 Y5.000 Z-0.848
+X15.600 Y5.000 Z-0.795
+X16.000 Y5.000 Z-0.747
+X16.400 Y5.000 Z-0.713
+X16.800 Y5.000 Z-0.700
+X17.200 Y5.000 Z-0.712
+X17.600 Y5.000 Z-0.750
+X18.000 Y5.000 Z-0.812
+X18.400 Y5.000 Z-0.892
+X18.800 Y5.000 Z-0.983
+X19.200 Y5.000 Z-1.076
+X19.600 Y5.000 Z-1.161
+X20.000 Y5.000 Z-1.231
+X20.400 Y5.000 Z-1.279
+X20.800 Y5.000 Z-1.301
+X21.200 Y5.000 Z-1.298
+X21.600 Y5.000 Z-1.271
+X22.000 Y5.000 Z-1.228
+X22.400 Y5.000 Z-1.175
+X22.800 Y5.000 Z-1.123
+X23.200 Y5.000 Z-1.079
+X23.600 Y5.000 Z-1.052
+X24.000 Y5.000 Z-1.046
+X24.400 Y5.000 Z-1.065
+X24.800 Y5.000 Z-1.108
+X25.200 Y5.000 Z-1.171
+X25.600 Y5.000 Z-1.246
+X26.000 Y5.000 Z-1.326
+X26.400 Y5.000 Z-1.402
+X26.800 Y5.000 Z-1.464
+X27.200 Y5.000 Z-1.506
+X27.600 Y5.000 Z-1.522
+X28.000 Y5.000 Z-1.511
+X28.400 Y5.000 Z-1.475
+X28.800 Y5.000 Z-1.418
+X29.200 Y5.000 Z-1.347
+X29.600 Y5.000 Z-1.272
+X30.000 Y5.000 Z-1.201
+X30.400 Y5.000 Z-1.142
+X30.800 Y5.000 Z-1.103
+X31.200 Y5.000 Z-1.087
+X31.600 Y5.000 Z-1.096
+X32.000 Y5.000 Z-1.126
+X32.400 Y5.000 Z-1.173
+X32.800 Y5.000 Z-1.229
+X33.200 Y5.000 Z-1.284
+X33.600 Y5.000 Z-1.331
+X34.000 Y5.000 Z-1.360
+X34.400 Y5.000 Z-1.367
+X34.800 Y5.000 Z-1.347
+X35.200 Y5.000 Z-1.301
+X35.600 Y5.000 Z-1.234
+X36.000 Y5.000 Z-1.150
+X36.400 Y5.000 Z-1.057
+X36.800 Y5.000 Z-0.967
+X37.200 Y5.000 Z-0.886
+X37.600 Y5.000 Z-0.824
+X38.000 Y5.000 Z-0.784
+X38.400 Y5.000 Z-0.771
+X38.800 Y5.000 Z-0.782
+X39.200 Y5.000 Z-0.813
+X39.600 Y5.000 Z-0.859
+X40.000 Y5.000 Z-0.910
+X40.400 Y5.000 Z-0.958
+X40.800 Y5.000 Z-0.994
+X41.200 Y5.000 Z-1.011
+X41.600 Y5.000 Z-1.004
+X42.000 Y5.000 Z-0.972
+X42.400 Y5.000 Z-0.918
+X42.800 Y5.000 Z-0.846
+X43.200 Y5.000 Z-0.763
+X43.600 Y5.000 Z-0.679
+X44.000 Y5.000 Z-0.603
+X44.400 Y5.000 Z-0.543
+X44.800 Y5.000 Z-0.505
+X45.200 Y5.000 Z-0.494
+X45.600 Y5.000 Z-0.509
+X46.000 Y5.000 Z-0.549
+X46.400 Y5.000 Z-0.607
+X46.800 Y5.000 Z-0.676
+X47.200 Y5.000 Z-0.746
+X47.600 Y5.000 Z-0.808
+X48.000 Y5.000 Z-0.855
+X48.400 Y5.000 Z-0.881
+X48.800 Y5.000 Z-0.883
+X49.200 Y5.000 Z-0.862
+X49.600 Y5.000 Z-0.820
+X50.000 Y5.000 Z-0.765
+G1 Y5.500
+X50.000 Y5.500 Z-0.712
+X49.600 Y5.500 Z-0.776
+X49.200 Y5.500 Z-0.837
+X48.800 Y5.500 Z-0.888
+X48.400 Y5.500 Z-0.921
+X48.000 Y5.500 Z-0.931
+X47.600 Y5.500 Z-0.916
+X47.200 Y5.500 Z-0.879
+X46.800 Y5.500 Z-0.823
+X46.400 Y5.500 Z-0.757
+X46.000 Y5.500 Z-0.688
+X45.600 Y5.500 Z-0.626
+X45.200 Y5.500 Z-0.580
+X44.800 Y5.500 Z-0.555
+X44.400 Y5.500 Z-0.556
+X44.000 Y5.500 Z-0.584
+X43.600 Y5.500 Z-0.636
+X43.200 Y5.500 Z-0.707
+X42.800 Y5.500 Z-0.788
+X42.400 Y5.500 Z-0.871
+X42.000 Y5.500 Z-0.947
+X41.600 Y5.500 Z-1.008
+X41.200 Y5.500 Z-1.047
+X40.800 Y5.500 Z-1.062
+X40.400 Y5.500 Z-1.052
+X40.000 Y5.500 Z-1.021
+X39.600 Y5.500 Z-0.974
+X39.200 Y5.500 Z-0.920
+X38.800 Y5.500 Z-0.869
+X38.400 Y5.500 Z-0.828
+X38.000 Y5.500 Z-0.805
+X37.600 Y5.500 Z-0.805
+X37.200 Y5.500 Z-0.831
+X36.800 Y5.500 Z-0.881
+X36.400 Y5.500 Z-0.952
+X36.000 Y5.500 Z-1.036
+X35.600 Y5.500 Z-1.125
+X35.200 Y5.500 Z-1.209
+X34.800 Y5.500 Z-1.280
+X34.400 Y5.500 Z-1.331
+X34.000 Y5.500 Z-1.357
+X33.600 Y5.500 Z-1.357
+X33.200 Y5.500 Z-1.332
+X32.800 Y5.500 Z-1.288
+X32.400 Y5.500 Z-1.231
+X32.000 Y5.500 Z-1.170
+X31.600 Y5.500 Z-1.116
+X31.200 Y5.500 Z-1.075
+X30.800 Y5.500 Z-1.054
+X30.400 Y5.500 Z-1.057
+X30.000 Y5.500 Z-1.084
+X29.600 Y5.500 Z-1.133
+X29.200 Y5.500 Z-1.198
+X28.800 Y5.500 Z-1.270
+X28.400 Y5.500 Z-1.342
+X28.000 Y5.500 Z-1.403
+X27.600 Y5.500 Z-1.446
+X27.200 Y5.500 Z-1.466
+X26.800 Y5.500 Z-1.459
+X26.400 Y5.500 Z-1.426
+X26.000 Y5.500 Z-1.370
+X25.600 Y5.500 Z-1.298
+X25.200 Y5.500 Z-1.218
+X24.800 Y5.500 Z-1.140
+X24.400 Y5.500 Z-1.072
+X24.000 Y5.500 Z-1.021
+X23.600 Y5.500 Z-0.994
+X23.200 Y5.500 Z-0.991
+X22.800 Y5.500 Z-1.011
+X22.400 Y5.500 Z-1.051
+X22.000 Y5.500 Z-1.103
+X21.600 Y5.500 Z-1.159
+X21.200 Y5.500 Z-1.209
+X20.800 Y5.500 Z-1.245
+X20.400 Y5.500 Z-1.261
+X20.000 Y5.500 Z-1.251
+X19.600 Y5.500 Z-1.216
+X19.200 Y5.500 Z-1.158
+X18.800 Y5.500 Z-1.081
+X18.400 Y5.500 Z-0.993
+X18.000 Y5.500 Z-0.904
+X17.600 Y5.500 Z-0.823
+X17.200 Y5.500 Z-0.757
+X16.800 Y5.500 Z-0.713
+X16.400 Y5.500 Z-0.695
+X16.000 Y5.500 Z-0.702
+X15.600 Y5.500 Z-0.732
+X15.200 Y5.500 Z-0.780
+X14.800 Y5.500 Z-0.836
+X14.400 Y5.500 Z-0.892
+X14.000 Y5.500 Z-0.939
+X13.600 Y5.500 Z-0.970
+X13.200 Y5.500 Z-0.979
+X12.800 Y5.500 Z-0.963
+X12.400 Y5.500 Z-0.924
+X12.000 Y5.500 Z-0.864
+X11.600 Y5.500 Z-0.792
+X11.200 Y5.500 Z-0.714
+X10.800 Y5.500 Z-0.641
+X10.400 Y5.500 Z-0.581
+X10.000 Y5.500 Z-0.542
+X9.600 Y5.500 Z-0.528
+X9.200 Y5.500 Z-0.541
+X8.800 Y5.500 Z-0.579
+X8.400 Y5.500 Z-0.637
+X8.000 Y5.500 Z-0.709
+X7.600 Y5.500 Z-0.785
+X7.200 Y5.500 Z-0.857
+X6.800 Y5.500 Z-0.916
+X6.400 Y5.500 Z-0.955
+X6.000 Y5.500 Z-0.970
+X5.600 Y5.500 Z-0.961
+X5.200 Y5.500 Z-0.930
+X4.800 Y5.500 Z-0.882
+X4.400 Y5.500 Z-0.825
+X4.000 Y5.500 Z-0.768
+X3.600 Y5.500 Z-0.720
+X3.200 Y5.500 Z-0.689
+X2.800 Y5.500 Z-0.680
+X2.400 Y5.500 Z-0.698
+X2.000 Y5.500 Z-0.741
+X1.600 Y5.500 Z-0.806
+X1.200 Y5.500 Z-0.887
+X0.800 Y5.500 Z-0.976
+X0.400 Y5.500 Z-1.064
+X0.000 Y5.500 Z-1.141
+G1 Y6.000
+X0.000 Y6.000 Z-1.056
+X0.400 Y6.000 Z-0.970
+X0.800 Y6.000 Z-0.886
+X1.200 Y6.000 Z-0.814
+X1.600 Y6.000 Z-0.760
+X2.000 Y6.000 Z-0.729
+X2.400 Y6.000 Z-0.725
+X2.800 Y6.000 Z-0.745
+X3.200 Y6.000 Z-0.786
+X3.600 Y6.000 Z-0.840
+X4.000 Y6.000 Z-0.900
+X4.400 Y6.000 Z-0.956
+X4.800 Y6.000 Z-1.000
+X5.200 Y6.000 Z-1.024
+X5.600 Y6.000 Z-1.025
+X6.000 Y6.000 Z-1.001
+X6.400 Y6.000 Z-0.954
+X6.800 Y6.000 Z-0.889
+X7.200 Y6.000 Z-0.815
+X7.600 Y6.000 Z-0.739
+X8.000 Y6.000 Z-0.670
+X8.400 Y6.000 Z-0.618
+X8.800 Y6.000 Z-0.588
+X9.200 Y6.000 Z-0.585
+X9.600 Y6.000 Z-0.607
+X10.000 Y6.000 Z-0.654
+X10.400 Y6.000 Z-0.717
+X10.800 Y6.000 Z-0.791
+X11.200 Y6.000 Z-0.865
+X11.600 Y6.000 Z-0.930
+X12.000 Y6.000 Z-0.980
+X12.400 Y6.000 Z-1.007
+X12.800 Y6.000 Z-1.010
+X13.200 Y6.000 Z-0.989
+X13.600 Y6.000 Z-0.948
+X14.000 Y6.000 Z-0.892
+X14.400 Y6.000 Z-0.831
+X14.800 Y6.000 Z-0.773
+X15.200 Y6.000 Z-0.728
+X15.600 Y6.000 Z-0.702
+X16.000 Y6.000 Z-0.701
+X16.400 Y6.000 Z-0.725
+X16.800 Y6.000 Z-0.774
+X17.200 Y6.000 Z-0.843
+X17.600 Y6.000 Z-0.925
+X18.000 Y6.000 Z-1.011
+X18.400 Y6.000 Z-1.091
+X18.800 Y6.000 Z-1.158
+X19.200 Y6.000 Z-1.205
+X19.600 Y6.000 Z-1.227
+X20.000 Y6.000 Z-1.223
+X20.400 Y6.000 Z-1.195
+X20.800 Y6.000 Z-1.150
+X21.200 Y6.000 Z-1.094
+X21.600 Y6.000 Z-1.036
+X22.000 Y6.000 Z-0.985
+X22.400 Y6.000 Z-0.950
+X22.800 Y6.000 Z-0.936
+X23.200 Y6.000 Z-0.947
+X23.600 Y6.000 Z-0.983
+X24.000 Y6.000 Z-1.040
+X24.400 Y6.000 Z-1.112
+X24.800 Y6.000 Z-1.191
+X25.200 Y6.000 Z-1.268
+X25.600 Y6.000 Z-1.335
+X26.000 Y6.000 Z-1.382
+X26.400 Y6.000 Z-1.406
+X26.800 Y6.000 Z-1.403
+X27.200 Y6.000 Z-1.375
+X27.600 Y6.000 Z-1.325
+X28.000 Y6.000 Z-1.260
+X28.400 Y6.000 Z-1.189
+X28.800 Y6.000 Z-1.120
+X29.200 Y6.000 Z-1.063
+X29.600 Y6.000 Z-1.024
+X30.000 Y6.000 Z-1.009
+X30.400 Y6.000 Z-1.018
+X30.800 Y6.000 Z-1.050
+X31.200 Y6.000 Z-1.100
+X31.600 Y6.000 Z-1.161
+X32.000 Y6.000 Z-1.225
+X32.400 Y6.000 Z-1.281
+X32.800 Y6.000 Z-1.323
+X33.200 Y6.000 Z-1.342
+X33.600 Y6.000 Z-1.336
+X34.000 Y6.000 Z-1.304
+X34.400 Y6.000 Z-1.248
+X34.800 Y6.000 Z-1.175
+X35.200 Y6.000 Z-1.092
+X35.600 Y6.000 Z-1.008
+X36.000 Y6.000 Z-0.932
+X36.400 Y6.000 Z-0.872
+X36.800 Y6.000 Z-0.835
+X37.200 Y6.000 Z-0.822
+X37.600 Y6.000 Z-0.835
+X38.000 Y6.000 Z-0.870
+X38.400 Y6.000 Z-0.919
+X38.800 Y6.000 Z-0.976
+X39.200 Y6.000 Z-1.031
+X39.600 Y6.000 Z-1.076
+X40.000 Y6.000 Z-1.102
+X40.400 Y6.000 Z-1.105
+X40.800 Y6.000 Z-1.083
+X41.200 Y6.000 Z-1.037
+X41.600 Y6.000 Z-0.972
+X42.000 Y6.000 Z-0.893
+X42.400 Y6.000 Z-0.811
+X42.800 Y6.000 Z-0.734
+X43.200 Y6.000 Z-0.671
+X43.600 Y6.000 Z-0.629
+X44.000 Y6.000 Z-0.612
+X44.400 Y6.000 Z-0.621
+X44.800 Y6.000 Z-0.655
+X45.200 Y6.000 Z-0.708
+X45.600 Y6.000 Z-0.773
+X46.000 Y6.000 Z-0.841
+X46.400 Y6.000 Z-0.903
+X46.800 Y6.000 Z-0.951
+X47.200 Y6.000 Z-0.978
+X47.600 Y6.000 Z-0.981
+X48.000 Y6.000 Z-0.960
+X48.400 Y6.000 Z-0.917
+X48.800 Y6.000 Z-0.859
+X49.200 Y6.000 Z-0.793
+X49.600 Y6.000 Z-0.728
+X50.000 Y6.000 Z-0.673
+G1 Y6.500
+X50.000 Y6.500 Z-0.669
+X49.600 Y6.500 Z-0.700
+X49.200 Y6.500 Z-0.751
+X48.800 Y6.500 Z-0.815
+X48.400 Y6.500 Z-0.884
+X48.000 Y6.500 Z-0.948
+X47.600 Y6.500 Z-1.000
+X47.200 Y6.500 Z-1.031
+X46.800 Y6.500 Z-1.039
+X46.400 Y6.500 Z-1.022
+X46.000 Y6.500 Z-0.982
+X45.600 Y6.500 Z-0.925
+X45.200 Y6.500 Z-0.859
+X44.800 Y6.500 Z-0.792
+X44.400 Y6.500 Z-0.733
+X44.000 Y6.500 Z-0.690
+X43.600 Y6.500 Z-0.670
+X43.200 Y6.500 Z-0.676
+X42.800 Y6.500 Z-0.707
+X42.400 Y6.500 Z-0.761
+X42.000 Y6.500 Z-0.832
+X41.600 Y6.500 Z-0.911
+X41.200 Y6.500 Z-0.990
+X40.800 Y6.500 Z-1.059
+X40.400 Y6.500 Z-1.110
+X40.000 Y6.500 Z-1.139
+X39.600 Y6.500 Z-1.143
+X39.200 Y6.500 Z-1.122
+X38.800 Y6.500 Z-1.080
+X38.400 Y6.500 Z-1.025
+X38.000 Y6.500 Z-0.964
+X37.600 Y6.500 Z-0.907
+X37.200 Y6.500 Z-0.862
+X36.800 Y6.500 Z-0.836
+X36.400 Y6.500 Z-0.834
+X36.000 Y6.500 Z-0.858
+X35.600 Y6.500 Z-0.906
+X35.200 Y6.500 Z-0.972
+X34.800 Y6.500 Z-1.050
+X34.400 Y6.500 Z-1.131
+X34.000 Y6.500 Z-1.206
+X33.600 Y6.500 Z-1.265
+X33.200 Y6.500 Z-1.303
+X32.800 Y6.500 Z-1.316
+X32.400 Y6.500 Z-1.302
+X32.000 Y6.500 Z-1.266
+X31.600 Y6.500 Z-1.211
+X31.200 Y6.500 Z-1.146
+X30.800 Y6.500 Z-1.080
+X30.400 Y6.500 Z-1.022
+X30.000 Y6.500 Z-0.980
+X29.600 Y6.500 Z-0.959
+X29.200 Y6.500 Z-0.963
+X28.800 Y6.500 Z-0.991
+X28.400 Y6.500 Z-1.040
+X28.000 Y6.500 Z-1.104
+X27.600 Y6.500 Z-1.175
+X27.200 Y6.500 Z-1.242
+X26.800 Y6.500 Z-1.299
+X26.400 Y6.500 Z-1.336
+X26.000 Y6.500 Z-1.349
+X25.600 Y6.500 Z-1.336
+X25.200 Y6.500 Z-1.297
+X24.800 Y6.500 Z-1.238
+X24.400 Y6.500 Z-1.165
+X24.000 Y6.500 Z-1.087
+X23.600 Y6.500 Z-1.012
+X23.200 Y6.500 Z-0.950
+X22.800 Y6.500 Z-0.908
+X22.400 Y6.500 Z-0.890
+X22.000 Y6.500 Z-0.897
+X21.600 Y6.500 Z-0.927
+X21.200 Y6.500 Z-0.975
+X20.800 Y6.500 Z-1.034
+X20.400 Y6.500 Z-1.095
+X20.000 Y6.500 Z-1.149
+X19.600 Y6.500 Z-1.188
+X19.200 Y6.500 Z-1.205
+X18.800 Y6.500 Z-1.197
+X18.400 Y6.500 Z-1.163
+X18.000 Y6.500 Z-1.108
+X17.600 Y6.500 Z-1.035
+X17.200 Y6.500 Z-0.954
+X16.800 Y6.500 Z-0.874
+X16.400 Y6.500 Z-0.803
+X16.000 Y6.500 Z-0.749
+X15.600 Y6.500 Z-0.719
+X15.200 Y6.500 Z-0.714
+X14.800 Y6.500 Z-0.735
+X14.400 Y6.500 Z-0.777
+X14.000 Y6.500 Z-0.834
+X13.600 Y6.500 Z-0.899
+X13.200 Y6.500 Z-0.961
+X12.800 Y6.500 Z-1.012
+X12.400 Y6.500 Z-1.044
+X12.000 Y6.500 Z-1.054
+X11.600 Y6.500 Z-1.039
+X11.200 Y6.500 Z-1.000
+X10.800 Y6.500 Z-0.942
+X10.400 Y6.500 Z-0.872
+X10.000 Y6.500 Z-0.799
+X9.600 Y6.500 Z-0.732
+X9.200 Y6.500 Z-0.680
+X8.800 Y6.500 Z-0.648
+X8.400 Y6.500 Z-0.642
+X8.000 Y6.500 Z-0.663
+X7.600 Y6.500 Z-0.707
+X7.200 Y6.500 Z-0.770
+X6.800 Y6.500 Z-0.844
+X6.400 Y6.500 Z-0.920
+X6.000 Y6.500 Z-0.989
+X5.600 Y6.500 Z-1.042
+X5.200 Y6.500 Z-1.074
+X4.800 Y6.500 Z-1.082
+X4.400 Y6.500 Z-1.065
+X4.000 Y6.500 Z-1.026
+X3.600 Y6.500 Z-0.971
+X3.200 Y6.500 Z-0.909
+X2.800 Y6.500 Z-0.849
+X2.400 Y6.500 Z-0.799
+X2.000 Y6.500 Z-0.767
+X1.600 Y6.500 Z-0.758
+X1.200 Y6.500 Z-0.776
+X0.800 Y6.500 Z-0.818
+X0.400 Y6.500 Z-0.880
+X0.000 Y6.500 Z-0.957
+G1 Y7.000
+X0.000 Y7.000 Z-0.869
+X0.400 Y7.000 Z-0.817
+X0.800 Y7.000 Z-0.788
+X1.200 Y7.000 Z-0.785
+X1.600 Y7.000 Z-0.806
+X2.000 Y7.000 Z-0.850
+X2.400 Y7.000 Z-0.908
+X2.800 Y7.000 Z-0.973
+X3.200 Y7.000 Z-1.036
+X3.600 Y7.000 Z-1.088
+X4.000 Y7.000 Z-1.121
+X4.400 Y7.000 Z-1.132
+X4.800 Y7.000 Z-1.116
+X5.200 Y7.000 Z-1.077
+X5.600 Y7.000 Z-1.019
+X6.000 Y7.000 Z-0.947
+X6.400 Y7.000 Z-0.872
+X6.800 Y7.000 Z-0.802
+X7.200 Y7.000 Z-0.747
+X7.600 Y7.000 Z-0.711
+X8.000 Y7.000 Z-0.701
+X8.400 Y7.000 Z-0.717
+X8.800 Y7.000 Z-0.757
+X9.200 Y7.000 Z-0.815
+X9.600 Y7.000 Z-0.884
+X10.000 Y7.000 Z-0.956
+X10.400 Y7.000 Z-1.021
+X10.800 Y7.000 Z-1.070
+X11.200 Y7.000 Z-1.099
+X11.600 Y7.000 Z-1.102
+X12.000 Y7.000 Z-1.081
+X12.400 Y7.000 Z-1.038
+X12.800 Y7.000 Z-0.978
+X13.200 Y7.000 Z-0.911
+X13.600 Y7.000 Z-0.846
+X14.000 Y7.000 Z-0.790
+X14.400 Y7.000 Z-0.752
+X14.800 Y7.000 Z-0.737
+X15.200 Y7.000 Z-0.748
+X15.600 Y7.000 Z-0.785
+X16.000 Y7.000 Z-0.842
+X16.400 Y7.000 Z-0.914
+X16.800 Y7.000 Z-0.992
+X17.200 Y7.000 Z-1.066
+X17.600 Y7.000 Z-1.129
+X18.000 Y7.000 Z-1.173
+X18.400 Y7.000 Z-1.192
+X18.800 Y7.000 Z-1.186
+X19.200 Y7.000 Z-1.157
+X19.600 Y7.000 Z-1.107
+X20.000 Y7.000 Z-1.046
+X20.400 Y7.000 Z-0.981
+X20.800 Y7.000 Z-0.922
+X21.200 Y7.000 Z-0.877
+X21.600 Y7.000 Z-0.852
+X22.000 Y7.000 Z-0.852
+X22.400 Y7.000 Z-0.877
+X22.800 Y7.000 Z-0.925
+X23.200 Y7.000 Z-0.991
+X23.600 Y7.000 Z-1.066
+X24.000 Y7.000 Z-1.141
+X24.400 Y7.000 Z-1.208
+X24.800 Y7.000 Z-1.258
+X25.200 Y7.000 Z-1.286
+X25.600 Y7.000 Z-1.288
+X26.000 Y7.000 Z-1.265
+X26.400 Y7.000 Z-1.219
+X26.800 Y7.000 Z-1.157
+X27.200 Y7.000 Z-1.088
+X27.600 Y7.000 Z-1.019
+X28.000 Y7.000 Z-0.961
+X28.400 Y7.000 Z-0.920
+X28.800 Y7.000 Z-0.902
+X29.200 Y7.000 Z-0.909
+X29.600 Y7.000 Z-0.941
+X30.000 Y7.000 Z-0.992
+X30.400 Y7.000 Z-1.056
+X30.800 Y7.000 Z-1.125
+X31.200 Y7.000 Z-1.190
+X31.600 Y7.000 Z-1.241
+X32.000 Y7.000 Z-1.272
+X32.400 Y7.000 Z-1.279
+X32.800 Y7.000 Z-1.259
+X33.200 Y7.000 Z-1.216
+X33.600 Y7.000 Z-1.153
+X34.000 Y7.000 Z-1.079
+X34.400 Y7.000 Z-1.002
+X34.800 Y7.000 Z-0.931
+X35.200 Y7.000 Z-0.875
+X35.600 Y7.000 Z-0.840
+X36.000 Y7.000 Z-0.830
+X36.400 Y7.000 Z-0.845
+X36.800 Y7.000 Z-0.883
+X37.200 Y7.000 Z-0.938
+X37.600 Y7.000 Z-1.002
+X38.000 Y7.000 Z-1.065
+X38.400 Y7.000 Z-1.120
+X38.800 Y7.000 Z-1.158
+X39.200 Y7.000 Z-1.173
+X39.600 Y7.000 Z-1.163
+X40.000 Y7.000 Z-1.128
+X40.400 Y7.000 Z-1.072
+X40.800 Y7.000 Z-1.001
+X41.200 Y7.000 Z-0.924
+X41.600 Y7.000 Z-0.850
+X42.000 Y7.000 Z-0.787
+X42.400 Y7.000 Z-0.743
+X42.800 Y7.000 Z-0.723
+X43.200 Y7.000 Z-0.730
+X43.600 Y7.000 Z-0.760
+X44.000 Y7.000 Z-0.811
+X44.400 Y7.000 Z-0.876
+X44.800 Y7.000 Z-0.945
+X45.200 Y7.000 Z-1.009
+X45.600 Y7.000 Z-1.060
+X46.000 Y7.000 Z-1.091
+X46.400 Y7.000 Z-1.098
+X46.800 Y7.000 Z-1.080
+X47.200 Y7.000 Z-1.039
+X47.600 Y7.000 Z-0.981
+X48.000 Y7.000 Z-0.912
+X48.400 Y7.000 Z-0.842
+X48.800 Y7.000 Z-0.780
+X49.200 Y7.000 Z-0.734
+X49.600 Y7.000 Z-0.710
+X50.000 Y7.000 Z-0.712
+G1 Y7.500
+X50.000 Y7.500 Z-0.805
+X49.600 Y7.500 Z-0.770
+X49.200 Y7.500 Z-0.760
+X48.800 Y7.500 Z-0.776
+X48.400 Y7.500 Z-0.816
+X48.000 Y7.500 Z-0.874
+X47.600 Y7.500 Z-0.943
+X47.200 Y7.500 Z-1.014
+X46.800 Y7.500 Z-1.078
+X46.400 Y7.500 Z-1.127
+X46.000 Y7.500 Z-1.154
+X45.600 Y7.500 Z-1.157
+X45.200 Y7.500 Z-1.134
+X44.800 Y7.500 Z-1.089
+X44.400 Y7.500 Z-1.028
+X44.000 Y7.500 Z-0.958
+X43.600 Y7.500 Z-0.890
+X43.200 Y7.500 Z-0.831
+X42.800 Y7.500 Z-0.790
+X42.400 Y7.500 Z-0.771
+X42.000 Y7.500 Z-0.778
+X41.600 Y7.500 Z-0.811
+X41.200 Y7.500 Z-0.864
+X40.800 Y7.500 Z-0.932
+X40.400 Y7.500 Z-1.006
+X40.000 Y7.500 Z-1.077
+X39.600 Y7.500 Z-1.136
+X39.200 Y7.500 Z-1.176
+X38.800 Y7.500 Z-1.192
+X38.400 Y7.500 Z-1.183
+X38.000 Y7.500 Z-1.149
+X37.600 Y7.500 Z-1.096
+X37.200 Y7.500 Z-1.031
+X36.800 Y7.500 Z-0.963
+X36.400 Y7.500 Z-0.899
+X36.000 Y7.500 Z-0.850
+X35.600 Y7.500 Z-0.822
+X35.200 Y7.500 Z-0.818
+X34.800 Y7.500 Z-0.840
+X34.400 Y7.500 Z-0.884
+X34.000 Y7.500 Z-0.946
+X33.600 Y7.500 Z-1.019
+X33.200 Y7.500 Z-1.092
+X32.800 Y7.500 Z-1.157
+X32.400 Y7.500 Z-1.205
+X32.000 Y7.500 Z-1.232
+X31.600 Y7.500 Z-1.233
+X31.200 Y7.500 Z-1.208
+X30.800 Y7.500 Z-1.162
+X30.400 Y7.500 Z-1.099
+X30.000 Y7.500 Z-1.029
+X29.600 Y7.500 Z-0.960
+X29.200 Y7.500 Z-0.902
+X28.800 Y7.500 Z-0.861
+X28.400 Y7.500 Z-0.843
+X28.000 Y7.500 Z-0.851
+X27.600 Y7.500 Z-0.883
+X27.200 Y7.500 Z-0.935
+X26.800 Y7.500 Z-1.001
+X26.400 Y7.500 Z-1.071
+X26.000 Y7.500 Z-1.138
+X25.600 Y7.500 Z-1.192
+X25.200 Y7.500 Z-1.226
+X24.800 Y7.500 Z-1.235
+X24.400 Y7.500 Z-1.219
+X24.000 Y7.500 Z-1.179
+X23.600 Y7.500 Z-1.120
+X23.200 Y7.500 Z-1.049
+X22.800 Y7.500 Z-0.976
+X22.400 Y7.500 Z-0.908
+X22.000 Y7.500 Z-0.856
+X21.600 Y7.500 Z-0.824
+X21.200 Y7.500 Z-0.818
+X20.800 Y7.500 Z-0.836
+X20.400 Y7.500 Z-0.878
+X20.000 Y7.500 Z-0.936
+X19.600 Y7.500 Z-1.004
+X19.200 Y7.500 Z-1.072
+X18.800 Y7.500 Z-1.130
+X18.400 Y7.500 Z-1.173
+X18.000 Y7.500 Z-1.192
+X17.600 Y7.500 Z-1.186
+X17.200 Y7.500 Z-1.156
+X16.800 Y7.500 Z-1.103
+X16.400 Y7.500 Z-1.036
+X16.000 Y7.500 Z-0.962
+X15.600 Y7.500 Z-0.891
+X15.200 Y7.500 Z-0.831
+X14.800 Y7.500 Z-0.789
+X14.400 Y7.500 Z-0.771
+X14.000 Y7.500 Z-0.779
+X13.600 Y7.500 Z-0.812
+X13.200 Y7.500 Z-0.865
+X12.800 Y7.500 Z-0.930
+X12.400 Y7.500 Z-1.000
+X12.000 Y7.500 Z-1.066
+X11.600 Y7.500 Z-1.118
+X11.200 Y7.500 Z-1.150
+X10.800 Y7.500 Z-1.158
+X10.400 Y7.500 Z-1.141
+X10.000 Y7.500 Z-1.100
+X9.600 Y7.500 Z-1.041
+X9.200 Y7.500 Z-0.972
+X8.800 Y7.500 Z-0.901
+X8.400 Y7.500 Z-0.837
+X8.000 Y7.500 Z-0.790
+X7.600 Y7.500 Z-0.764
+X7.200 Y7.500 Z-0.763
+X6.800 Y7.500 Z-0.788
+X6.400 Y7.500 Z-0.835
+X6.000 Y7.500 Z-0.899
+X5.600 Y7.500 Z-0.971
+X5.200 Y7.500 Z-1.043
+X4.800 Y7.500 Z-1.105
+X4.400 Y7.500 Z-1.150
+X4.000 Y7.500 Z-1.173
+X3.600 Y7.500 Z-1.170
+X3.200 Y7.500 Z-1.142
+X2.800 Y7.500 Z-1.093
+X2.400 Y7.500 Z-1.030
+X2.000 Y7.500 Z-0.961
+X1.600 Y7.500 Z-0.896
+X1.200 Y7.500 Z-0.842
+X0.800 Y7.500 Z-0.808
+X0.400 Y7.500 Z-0.797
+X0.000 Y7.500 Z-0.812
+G1 Y8.000
+X0.000 Y8.000 Z-0.802
+X0.400 Y8.000 Z-0.826
+X0.800 Y8.000 Z-0.873
+X1.200 Y8.000 Z-0.936
+X1.600 Y8.000 Z-1.008
+X2.000 Y8.000 Z-1.079
+X2.400 Y8.000 Z-1.141
+X2.800 Y8.000 Z-1.186
+X3.200 Y8.000 Z-1.208
+X3.600 Y8.000 Z-1.204
+X4.000 Y8.000 Z-1.175
+X4.400 Y8.000 Z-1.126
+X4.800 Y8.000 Z-1.061
+X5.200 Y8.000 Z-0.991
+X5.600 Y8.000 Z-0.923
+X6.000 Y8.000 Z-0.867
+X6.400 Y8.000 Z-0.829
+X6.800 Y8.000 Z-0.816
+X7.200 Y8.000 Z-0.828
+X7.600 Y8.000 Z-0.864
+X8.000 Y8.000 Z-0.920
+X8.400 Y8.000 Z-0.988
+X8.800 Y8.000 Z-1.060
+X9.200 Y8.000 Z-1.126
+X9.600 Y8.000 Z-1.178
+X10.000 Y8.000 Z-1.210
+X10.400 Y8.000 Z-1.217
+X10.800 Y8.000 Z-1.198
+X11.200 Y8.000 Z-1.156
+X11.600 Y8.000 Z-1.096
+X12.000 Y8.000 Z-1.026
+X12.400 Y8.000 Z-0.954
+X12.800 Y8.000 Z-0.891
+X13.200 Y8.000 Z-0.843
+X13.600 Y8.000 Z-0.817
+X14.000 Y8.000 Z-0.816
+X14.400 Y8.000 Z-0.840
+X14.800 Y8.000 Z-0.887
+X15.200 Y8.000 Z-0.949
+X15.600 Y8.000 Z-1.019
+X16.000 Y8.000 Z-1.088
+X16.400 Y8.000 Z-1.146
+X16.800 Y8.000 Z-1.187
+X17.200 Y8.000 Z-1.204
+X17.600 Y8.000 Z-1.196
+X18.000 Y8.000 Z-1.163
+X18.400 Y8.000 Z-1.110
+X18.800 Y8.000 Z-1.042
+X19.200 Y8.000 Z-0.970
+X19.600 Y8.000 Z-0.901
+X20.000 Y8.000 Z-0.844
+X20.400 Y8.000 Z-0.807
+X20.800 Y8.000 Z-0.794
+X21.200 Y8.000 Z-0.807
+X21.600 Y8.000 Z-0.844
+X22.000 Y8.000 Z-0.900
+X22.400 Y8.000 Z-0.967
+X22.800 Y8.000 Z-1.038
+X23.200 Y8.000 Z-1.102
+X23.600 Y8.000 Z-1.152
+X24.000 Y8.000 Z-1.181
+X24.400 Y8.000 Z-1.185
+X24.800 Y8.000 Z-1.163
+X25.200 Y8.000 Z-1.119
+X25.600 Y8.000 Z-1.058
+X26.000 Y8.000 Z-0.987
+X26.400 Y8.000 Z-0.916
+X26.800 Y8.000 Z-0.854
+X27.200 Y8.000 Z-0.808
+X27.600 Y8.000 Z-0.785
+X28.000 Y8.000 Z-0.787
+X28.400 Y8.000 Z-0.814
+X28.800 Y8.000 Z-0.864
+X29.200 Y8.000 Z-0.928
+X29.600 Y8.000 Z-0.999
+X30.000 Y8.000 Z-1.069
+X30.400 Y8.000 Z-1.127
+X30.800 Y8.000 Z-1.168
+X31.200 Y8.000 Z-1.184
+X31.600 Y8.000 Z-1.175
+X32.000 Y8.000 Z-1.142
+X32.400 Y8.000 Z-1.089
+X32.800 Y8.000 Z-1.023
+X33.200 Y8.000 Z-0.952
+X33.600 Y8.000 Z-0.886
+X34.000 Y8.000 Z-0.833
+X34.400 Y8.000 Z-0.800
+X34.800 Y8.000 Z-0.792
+X35.200 Y8.000 Z-0.809
+X35.600 Y8.000 Z-0.850
+X36.000 Y8.000 Z-0.910
+X36.400 Y8.000 Z-0.980
+X36.800 Y8.000 Z-1.053
+X37.200 Y8.000 Z-1.118
+X37.600 Y8.000 Z-1.168
+X38.000 Y8.000 Z-1.196
+X38.400 Y8.000 Z-1.200
+X38.800 Y8.000 Z-1.178
+X39.200 Y8.000 Z-1.134
+X39.600 Y8.000 Z-1.073
+X40.000 Y8.000 Z-1.003
+X40.400 Y8.000 Z-0.934
+X40.800 Y8.000 Z-0.874
+X41.200 Y8.000 Z-0.832
+X41.600 Y8.000 Z-0.812
+X42.000 Y8.000 Z-0.818
+X42.400 Y8.000 Z-0.848
+X42.800 Y8.000 Z-0.900
+X43.200 Y8.000 Z-0.966
+X43.600 Y8.000 Z-1.038
+X44.000 Y8.000 Z-1.107
+X44.400 Y8.000 Z-1.164
+X44.800 Y8.000 Z-1.202
+X45.200 Y8.000 Z-1.217
+X45.600 Y8.000 Z-1.205
+X46.000 Y8.000 Z-1.169
+X46.400 Y8.000 Z-1.114
+X46.800 Y8.000 Z-1.046
+X47.200 Y8.000 Z-0.975
+X47.600 Y8.000 Z-0.909
+X48.000 Y8.000 Z-0.856
+X48.400 Y8.000 Z-0.825
+X48.800 Y8.000 Z-0.818
+X49.200 Y8.000 Z-0.836
+X49.600 Y8.000 Z-0.877
+X50.000 Y8.000 Z-0.936
+G1 Y8.500
+X50.000 Y8.500 Z-1.087
+X49.600 Y8.500 Z-1.018
+X49.200 Y8.500 Z-0.955
+X48.800 Y8.500 Z-0.907
+X48.400 Y8.500 Z-0.881
+X48.000 Y8.500 Z-0.878
+X47.600 Y8.500 Z-0.901
+X47.200 Y8.500 Z-0.946
+X46.800 Y8.500 Z-1.008
+X46.400 Y8.500 Z-1.078
+X46.000 Y8.500 Z-1.147
+X45.600 Y8.500 Z-1.208
+X45.200 Y8.500 Z-1.250
+X44.800 Y8.500 Z-1.270
+X44.400 Y8.500 Z-1.264
+X44.000 Y8.500 Z-1.233
+X43.600 Y8.500 Z-1.180
+X43.200 Y8.500 Z-1.112
+X42.800 Y8.500 Z-1.037
+X42.400 Y8.500 Z-0.965
+X42.000 Y8.500 Z-0.904
+X41.600 Y8.500 Z-0.862
+X41.200 Y8.500 Z-0.843
+X40.800 Y8.500 Z-0.849
+X40.400 Y8.500 Z-0.880
+X40.000 Y8.500 Z-0.930
+X39.600 Y8.500 Z-0.993
+X39.200 Y8.500 Z-1.059
+X38.800 Y8.500 Z-1.121
+X38.400 Y8.500 Z-1.168
+X38.000 Y8.500 Z-1.196
+X37.600 Y8.500 Z-1.198
+X37.200 Y8.500 Z-1.175
+X36.800 Y8.500 Z-1.129
+X36.400 Y8.500 Z-1.065
+X36.000 Y8.500 Z-0.990
+X35.600 Y8.500 Z-0.914
+X35.200 Y8.500 Z-0.846
+X34.800 Y8.500 Z-0.794
+X34.400 Y8.500 Z-0.763
+X34.000 Y8.500 Z-0.758
+X33.600 Y8.500 Z-0.779
+X33.200 Y8.500 Z-0.821
+X32.800 Y8.500 Z-0.881
+X32.400 Y8.500 Z-0.948
+X32.000 Y8.500 Z-1.015
+X31.600 Y8.500 Z-1.072
+X31.200 Y8.500 Z-1.112
+X30.800 Y8.500 Z-1.129
+X30.400 Y8.500 Z-1.120
+X30.000 Y8.500 Z-1.088
+X29.600 Y8.500 Z-1.035
+X29.200 Y8.500 Z-0.968
+X28.800 Y8.500 Z-0.896
+X28.400 Y8.500 Z-0.827
+X28.000 Y8.500 Z-0.772
+X27.600 Y8.500 Z-0.736
+X27.200 Y8.500 Z-0.724
+X26.800 Y8.500 Z-0.738
+X26.400 Y8.500 Z-0.777
+X26.000 Y8.500 Z-0.835
+X25.600 Y8.500 Z-0.905
+X25.200 Y8.500 Z-0.979
+X24.800 Y8.500 Z-1.048
+X24.400 Y8.500 Z-1.102
+X24.000 Y8.500 Z-1.135
+X23.600 Y8.500 Z-1.144
+X23.200 Y8.500 Z-1.127
+X22.800 Y8.500 Z-1.088
+X22.400 Y8.500 Z-1.032
+X22.000 Y8.500 Z-0.966
+X21.600 Y8.500 Z-0.900
+X21.200 Y8.500 Z-0.843
+X20.800 Y8.500 Z-0.801
+X20.400 Y8.500 Z-0.783
+X20.000 Y8.500 Z-0.789
+X19.600 Y8.500 Z-0.821
+X19.200 Y8.500 Z-0.875
+X18.800 Y8.500 Z-0.944
+X18.400 Y8.500 Z-1.020
+X18.000 Y8.500 Z-1.095
+X17.600 Y8.500 Z-1.158
+X17.200 Y8.500 Z-1.204
+X16.800 Y8.500 Z-1.226
+X16.400 Y8.500 Z-1.222
+X16.000 Y8.500 Z-1.193
+X15.600 Y8.500 Z-1.144
+X15.200 Y8.500 Z-1.082
+X14.800 Y8.500 Z-1.014
+X14.400 Y8.500 Z-0.951
+X14.000 Y8.500 Z-0.900
+X13.600 Y8.500 Z-0.869
+X13.200 Y8.500 Z-0.863
+X12.800 Y8.500 Z-0.881
+X12.400 Y8.500 Z-0.923
+X12.000 Y8.500 Z-0.983
+X11.600 Y8.500 Z-1.054
+X11.200 Y8.500 Z-1.127
+X10.800 Y8.500 Z-1.193
+X10.400 Y8.500 Z-1.243
+X10.000 Y8.500 Z-1.272
+X9.600 Y8.500 Z-1.275
+X9.200 Y8.500 Z-1.253
+X8.800 Y8.500 Z-1.208
+X8.400 Y8.500 Z-1.145
+X8.000 Y8.500 Z-1.074
+X7.600 Y8.500 Z-1.002
+X7.200 Y8.500 Z-0.939
+X6.800 Y8.500 Z-0.893
+X6.400 Y8.500 Z-0.869
+X6.000 Y8.500 Z-0.871
+X5.600 Y8.500 Z-0.897
+X5.200 Y8.500 Z-0.944
+X4.800 Y8.500 Z-1.005
+X4.400 Y8.500 Z-1.073
+X4.000 Y8.500 Z-1.138
+X3.600 Y8.500 Z-1.191
+X3.200 Y8.500 Z-1.225
+X2.800 Y8.500 Z-1.235
+X2.400 Y8.500 Z-1.219
+X2.000 Y8.500 Z-1.179
+X1.600 Y8.500 Z-1.119
+X1.200 Y8.500 Z-1.046
+X0.800 Y8.500 Z-0.970
+X0.400 Y8.500 Z-0.898
+X0.000 Y8.500 Z-0.840
+G1 Y9.000
+X0.000 Y9.000 Z-0.918
+X0.400 Y9.000 Z-0.996
+X0.800 Y9.000 Z-1.076
+X1.200 Y9.000 Z-1.149
+X1.600 Y9.000 Z-1.206
+X2.000 Y9.000 Z-1.241
+X2.400 Y9.000 Z-1.250
+X2.800 Y9.000 Z-1.234
+X3.200 Y9.000 Z-1.196
+X3.600 Y9.000 Z-1.141
+X4.000 Y9.000 Z-1.078
+X4.400 Y9.000 Z-1.015
+X4.800 Y9.000 Z-0.961
+X5.200 Y9.000 Z-0.924
+X5.600 Y9.000 Z-0.910
+X6.000 Y9.000 Z-0.922
+X6.400 Y9.000 Z-0.957
+X6.800 Y9.000 Z-1.013
+X7.200 Y9.000 Z-1.082
+X7.600 Y9.000 Z-1.156
+X8.000 Y9.000 Z-1.227
+X8.400 Y9.000 Z-1.285
+X8.800 Y9.000 Z-1.323
+X9.200 Y9.000 Z-1.336
+X9.600 Y9.000 Z-1.323
+X10.000 Y9.000 Z-1.286
+X10.400 Y9.000 Z-1.229
+X10.800 Y9.000 Z-1.159
+X11.200 Y9.000 Z-1.085
+X11.600 Y9.000 Z-1.016
+X12.000 Y9.000 Z-0.961
+X12.400 Y9.000 Z-0.927
+X12.800 Y9.000 Z-0.916
+X13.200 Y9.000 Z-0.931
+X13.600 Y9.000 Z-0.968
+X14.000 Y9.000 Z-1.022
+X14.400 Y9.000 Z-1.086
+X14.800 Y9.000 Z-1.150
+X15.200 Y9.000 Z-1.205
+X15.600 Y9.000 Z-1.244
+X16.000 Y9.000 Z-1.260
+X16.400 Y9.000 Z-1.250
+X16.800 Y9.000 Z-1.215
+X17.200 Y9.000 Z-1.158
+X17.600 Y9.000 Z-1.086
+X18.000 Y9.000 Z-1.006
+X18.400 Y9.000 Z-0.927
+X18.800 Y9.000 Z-0.859
+X19.200 Y9.000 Z-0.810
+X19.600 Y9.000 Z-0.783
+X20.000 Y9.000 Z-0.783
+X20.400 Y9.000 Z-0.807
+X20.800 Y9.000 Z-0.851
+X21.200 Y9.000 Z-0.909
+X21.600 Y9.000 Z-0.973
+X22.000 Y9.000 Z-1.032
+X22.400 Y9.000 Z-1.079
+X22.800 Y9.000 Z-1.106
+X23.200 Y9.000 Z-1.109
+X23.600 Y9.000 Z-1.088
+X24.000 Y9.000 Z-1.043
+X24.400 Y9.000 Z-0.979
+X24.800 Y9.000 Z-0.905
+X25.200 Y9.000 Z-0.829
+X25.600 Y9.000 Z-0.760
+X26.000 Y9.000 Z-0.707
+X26.400 Y9.000 Z-0.675
+X26.800 Y9.000 Z-0.670
+X27.200 Y9.000 Z-0.690
+X27.600 Y9.000 Z-0.733
+X28.000 Y9.000 Z-0.794
+X28.400 Y9.000 Z-0.864
+X28.800 Y9.000 Z-0.935
+X29.200 Y9.000 Z-0.998
+X29.600 Y9.000 Z-1.044
+X30.000 Y9.000 Z-1.068
+X30.400 Y9.000 Z-1.067
+X30.800 Y9.000 Z-1.042
+X31.200 Y9.000 Z-0.996
+X31.600 Y9.000 Z-0.935
+X32.000 Y9.000 Z-0.869
+X32.400 Y9.000 Z-0.806
+X32.800 Y9.000 Z-0.754
+X33.200 Y9.000 Z-0.722
+X33.600 Y9.000 Z-0.714
+X34.000 Y9.000 Z-0.732
+X34.400 Y9.000 Z-0.775
+X34.800 Y9.000 Z-0.837
+X35.200 Y9.000 Z-0.913
+X35.600 Y9.000 Z-0.993
+X36.000 Y9.000 Z-1.068
+X36.400 Y9.000 Z-1.130
+X36.800 Y9.000 Z-1.171
+X37.200 Y9.000 Z-1.188
+X37.600 Y9.000 Z-1.180
+X38.000 Y9.000 Z-1.148
+X38.400 Y9.000 Z-1.098
+X38.800 Y9.000 Z-1.037
+X39.200 Y9.000 Z-0.975
+X39.600 Y9.000 Z-0.920
+X40.000 Y9.000 Z-0.881
+X40.400 Y9.000 Z-0.863
+X40.800 Y9.000 Z-0.870
+X41.200 Y9.000 Z-0.902
+X41.600 Y9.000 Z-0.956
+X42.000 Y9.000 Z-1.026
+X42.400 Y9.000 Z-1.103
+X42.800 Y9.000 Z-1.180
+X43.200 Y9.000 Z-1.245
+X43.600 Y9.000 Z-1.293
+X44.000 Y9.000 Z-1.317
+X44.400 Y9.000 Z-1.316
+X44.800 Y9.000 Z-1.288
+X45.200 Y9.000 Z-1.240
+X45.600 Y9.000 Z-1.177
+X46.000 Y9.000 Z-1.107
+X46.400 Y9.000 Z-1.040
+X46.800 Y9.000 Z-0.985
+X47.200 Y9.000 Z-0.949
+X47.600 Y9.000 Z-0.936
+X48.000 Y9.000 Z-0.948
+X48.400 Y9.000 Z-0.983
+X48.800 Y9.000 Z-1.037
+X49.200 Y9.000 Z-1.103
+X49.600 Y9.000 Z-1.171
+X50.000 Y9.000 Z-1.233
+G1 Y9.500
+X50.000 Y9.500 Z-1.350
+X49.600 Y9.500 Z-1.311
+X49.200 Y9.500 Z-1.255
+X48.800 Y9.500 Z-1.189
+X48.400 Y9.500 Z-1.122
+X48.000 Y9.500 Z-1.062
+X47.600 Y9.500 Z-1.018
+X47.200 Y9.500 Z-0.996
+X46.800 Y9.500 Z-0.998
+X46.400 Y9.500 Z-1.025
+X46.000 Y9.500 Z-1.072
+X45.600 Y9.500 Z-1.134
+X45.200 Y9.500 Z-1.201
+X44.800 Y9.500 Z-1.266
+X44.400 Y9.500 Z-1.319
+X44.000 Y9.500 Z-1.352
+X43.600 Y9.500 Z-1.361
+X43.200 Y9.500 Z-1.344
+X42.800 Y9.500 Z-1.302
+X42.400 Y9.500 Z-1.239
+X42.000 Y9.500 Z-1.162
+X41.600 Y9.500 Z-1.081
+X41.200 Y9.500 Z-1.003
+X40.800 Y9.500 Z-0.939
+X40.400 Y9.500 Z-0.894
+X40.000 Y9.500 Z-0.873
+X39.600 Y9.500 Z-0.877
+X39.200 Y9.500 Z-0.905
+X38.800 Y9.500 Z-0.951
+X38.400 Y9.500 Z-1.007
+X38.000 Y9.500 Z-1.065
+X37.600 Y9.500 Z-1.117
+X37.200 Y9.500 Z-1.152
+X36.800 Y9.500 Z-1.167
+X36.400 Y9.500 Z-1.156
+X36.000 Y9.500 Z-1.120
+X35.600 Y9.500 Z-1.062
+X35.200 Y9.500 Z-0.988
+X34.800 Y9.500 Z-0.906
+X34.400 Y9.500 Z-0.824
+X34.000 Y9.500 Z-0.753
+X33.600 Y9.500 Z-0.699
+X33.200 Y9.500 Z-0.669
+X32.800 Y9.500 Z-0.665
+X32.400 Y9.500 Z-0.686
+X32.000 Y9.500 Z-0.729
+X31.600 Y9.500 Z-0.787
+X31.200 Y9.500 Z-0.852
+X30.800 Y9.500 Z-0.915
+X30.400 Y9.500 Z-0.967
+X30.000 Y9.500 Z-1.000
+X29.600 Y9.500 Z-1.011
+X29.200 Y9.500 Z-0.996
+X28.800 Y9.500 Z-0.959
+X28.400 Y9.500 Z-0.902
+X28.000 Y9.500 Z-0.835
+X27.600 Y9.500 Z-0.764
+X27.200 Y9.500 Z-0.700
+X26.800 Y9.500 Z-0.651
+X26.400 Y9.500 Z-0.623
+X26.000 Y9.500 Z-0.621
+X25.600 Y9.500 Z-0.645
+X25.200 Y9.500 Z-0.693
+X24.800 Y9.500 Z-0.759
+X24.400 Y9.500 Z-0.836
+X24.000 Y9.500 Z-0.915
+X23.600 Y9.500 Z-0.987
+X23.200 Y9.500 Z-1.043
+X22.800 Y9.500 Z-1.078
+X22.400 Y9.500 Z-1.088
+X22.000 Y9.500 Z-1.074
+X21.600 Y9.500 Z-1.038
+X21.200 Y9.500 Z-0.986
+X20.800 Y9.500 Z-0.927
+X20.400 Y9.500 Z-0.870
+X20.000 Y9.500 Z-0.823
+X19.600 Y9.500 Z-0.795
+X19.200 Y9.500 Z-0.789
+X18.800 Y9.500 Z-0.810
+X18.400 Y9.500 Z-0.855
+X18.000 Y9.500 Z-0.920
+X17.600 Y9.500 Z-0.999
+X17.200 Y9.500 Z-1.083
+X16.800 Y9.500 Z-1.163
+X16.400 Y9.500 Z-1.230
+X16.000 Y9.500 Z-1.277
+X15.600 Y9.500 Z-1.300
+X15.200 Y9.500 Z-1.296
+X14.800 Y9.500 Z-1.269
+X14.400 Y9.500 Z-1.221
+X14.000 Y9.500 Z-1.162
+X13.600 Y9.500 Z-1.099
+X13.200 Y9.500 Z-1.042
+X12.800 Y9.500 Z-0.999
+X12.400 Y9.500 Z-0.976
+X12.000 Y9.500 Z-0.978
+X11.600 Y9.500 Z-1.004
+X11.200 Y9.500 Z-1.052
+X10.800 Y9.500 Z-1.116
+X10.400 Y9.500 Z-1.189
+X10.000 Y9.500 Z-1.262
+X9.600 Y9.500 Z-1.324
+X9.200 Y9.500 Z-1.369
+X8.800 Y9.500 Z-1.391
+X8.400 Y9.500 Z-1.386
+X8.000 Y9.500 Z-1.356
+X7.600 Y9.500 Z-1.303
+X7.200 Y9.500 Z-1.235
+X6.800 Y9.500 Z-1.158
+X6.400 Y9.500 Z-1.083
+X6.000 Y9.500 Z-1.019
+X5.600 Y9.500 Z-0.972
+X5.200 Y9.500 Z-0.948
+X4.800 Y9.500 Z-0.949
+X4.400 Y9.500 Z-0.974
+X4.000 Y9.500 Z-1.018
+X3.600 Y9.500 Z-1.075
+X3.200 Y9.500 Z-1.136
+X2.800 Y9.500 Z-1.191
+X2.400 Y9.500 Z-1.233
+X2.000 Y9.500 Z-1.254
+X1.600 Y9.500 Z-1.251
+X1.200 Y9.500 Z-1.222
+X0.800 Y9.500 Z-1.169
+X0.400 Y9.500 Z-1.097
+X0.000 Y9.500 Z-1.015
+G1 Y10.000
+X0.000 Y10.000 Z-1.109
+X0.400 Y10.000 Z-1.178
+X0.800 Y10.000 Z-1.226
+X1.200 Y10.000 Z-1.249
+X1.600 Y10.000 Z-1.246
+X2.000 Y10.000 Z-1.220
+X2.400 Y10.000 Z-1.176
+X2.800 Y10.000 Z-1.122
+X3.200 Y10.000 Z-1.065
+X3.600 Y10.000 Z-1.016
+X4.000 Y10.000 Z-0.983
+X4.400 Y10.000 Z-0.970
+X4.800 Y10.000 Z-0.982
+X5.200 Y10.000 Z-1.019
+X5.600 Y10.000 Z-1.077
+X6.000 Y10.000 Z-1.149
+X6.400 Y10.000 Z-1.229
+X6.800 Y10.000 Z-1.306
+X7.200 Y10.000 Z-1.372
+X7.600 Y10.000 Z-1.419
+X8.000 Y10.000 Z-1.442
+X8.400 Y10.000 Z-1.438
+X8.800 Y10.000 Z-1.409
+X9.200 Y10.000 Z-1.357
+X9.600 Y10.000 Z-1.291
+X10.000 Y10.000 Z-1.219
+X10.400 Y10.000 Z-1.149
+X10.800 Y10.000 Z-1.090
+X11.200 Y10.000 Z-1.050
+X11.600 Y10.000 Z-1.033
+X12.000 Y10.000 Z-1.041
+X12.400 Y10.000 Z-1.072
+X12.800 Y10.000 Z-1.120
+X13.200 Y10.000 Z-1.180
+X13.600 Y10.000 Z-1.241
+X14.000 Y10.000 Z-1.295
+X14.400 Y10.000 Z-1.334
+X14.800 Y10.000 Z-1.350
+X15.200 Y10.000 Z-1.341
+X15.600 Y10.000 Z-1.306
+X16.000 Y10.000 Z-1.248
+X16.400 Y10.000 Z-1.172
+X16.800 Y10.000 Z-1.086
+X17.200 Y10.000 Z-1.000
+X17.600 Y10.000 Z-0.922
+X18.000 Y10.000 Z-0.860
+X18.400 Y10.000 Z-0.821
+X18.800 Y10.000 Z-0.807
+X19.200 Y10.000 Z-0.818
+X19.600 Y10.000 Z-0.850
+X20.000 Y10.000 Z-0.898
+X20.400 Y10.000 Z-0.953
+X20.800 Y10.000 Z-1.006
+X21.200 Y10.000 Z-1.049
+X21.600 Y10.000 Z-1.073
+X22.000 Y10.000 Z-1.075
+X22.400 Y10.000 Z-1.051
+X22.800 Y10.000 Z-1.003
+X23.200 Y10.000 Z-0.937
+X23.600 Y10.000 Z-0.857
+X24.000 Y10.000 Z-0.774
+X24.400 Y10.000 Z-0.697
+X24.800 Y10.000 Z-0.634
+X25.200 Y10.000 Z-0.592
+X25.600 Y10.000 Z-0.575
+X26.000 Y10.000 Z-0.585
+X26.400 Y10.000 Z-0.619
+X26.800 Y10.000 Z-0.673
+X27.200 Y10.000 Z-0.739
+X27.600 Y10.000 Z-0.808
+X28.000 Y10.000 Z-0.870
+X28.400 Y10.000 Z-0.919
+X28.800 Y10.000 Z-0.947
+X29.200 Y10.000 Z-0.951
+X29.600 Y10.000 Z-0.931
+X30.000 Y10.000 Z-0.889
+X30.400 Y10.000 Z-0.832
+X30.800 Y10.000 Z-0.768
+X31.200 Y10.000 Z-0.705
+X31.600 Y10.000 Z-0.653
+X32.000 Y10.000 Z-0.619
+X32.400 Y10.000 Z-0.608
+X32.800 Y10.000 Z-0.624
+X33.200 Y10.000 Z-0.666
+X33.600 Y10.000 Z-0.729
+X34.000 Y10.000 Z-0.808
+X34.400 Y10.000 Z-0.893
+X34.800 Y10.000 Z-0.976
+X35.200 Y10.000 Z-1.048
+X35.600 Y10.000 Z-1.101
+X36.000 Y10.000 Z-1.130
+X36.400 Y10.000 Z-1.134
+X36.800 Y10.000 Z-1.115
+X37.200 Y10.000 Z-1.076
+X37.600 Y10.000 Z-1.024
+X38.000 Y10.000 Z-0.969
+X38.400 Y10.000 Z-0.920
+X38.800 Y10.000 Z-0.884
+X39.200 Y10.000 Z-0.869
+X39.600 Y10.000 Z-0.879
+X40.000 Y10.000 Z-0.913
+X40.400 Y10.000 Z-0.970
+X40.800 Y10.000 Z-1.045
+X41.200 Y10.000 Z-1.129
+X41.600 Y10.000 Z-1.213
+X42.000 Y10.000 Z-1.289
+X42.400 Y10.000 Z-1.348
+X42.800 Y10.000 Z-1.385
+X43.200 Y10.000 Z-1.395
+X43.600 Y10.000 Z-1.379
+X44.000 Y10.000 Z-1.340
+X44.400 Y10.000 Z-1.285
+X44.800 Y10.000 Z-1.220
+X45.200 Y10.000 Z-1.156
+X45.600 Y10.000 Z-1.102
+X46.000 Y10.000 Z-1.064
+X46.400 Y10.000 Z-1.048
+X46.800 Y10.000 Z-1.057
+X47.200 Y10.000 Z-1.090
+X47.600 Y10.000 Z-1.141
+X48.000 Y10.000 Z-1.206
+X48.400 Y10.000 Z-1.275
+X48.800 Y10.000 Z-1.338
+X49.200 Y10.000 Z-1.388
+X49.600 Y10.000 Z-1.417
+X50.000 Y10.000 Z-1.421
+G1 Y10.500
+X50.000 Y10.500 Z-1.442
+X49.600 Y10.500 Z-1.475
+X49.200 Y10.500 Z-1.481
+X48.800 Y10.500 Z-1.461
+X48.400 Y10.500 Z-1.418
+X48.000 Y10.500 Z-1.357
+X47.600 Y10.500 Z-1.289
+X47.200 Y10.500 Z-1.220
+X46.800 Y10.500 Z-1.161
+X46.400 Y10.500 Z-1.118
+X46.000 Y10.500 Z-1.098
+X45.600 Y10.500 Z-1.102
+X45.200 Y10.500 Z-1.129
+X44.800 Y10.500 Z-1.175
+X44.400 Y10.500 Z-1.234
+X44.000 Y10.500 Z-1.296
+X43.600 Y10.500 Z-1.352
+X43.200 Y10.500 Z-1.395
+X42.800 Y10.500 Z-1.417
+X42.400 Y10.500 Z-1.414
+X42.000 Y10.500 Z-1.384
+X41.600 Y10.500 Z-1.329
+X41.200 Y10.500 Z-1.255
+X40.800 Y10.500 Z-1.169
+X40.400 Y10.500 Z-1.080
+X40.000 Y10.500 Z-0.996
+X39.600 Y10.500 Z-0.928
+X39.200 Y10.500 Z-0.880
+X38.800 Y10.500 Z-0.857
+X38.400 Y10.500 Z-0.859
+X38.000 Y10.500 Z-0.884
+X37.600 Y10.500 Z-0.925
+X37.200 Y10.500 Z-0.975
+X36.800 Y10.500 Z-1.026
+X36.400 Y10.500 Z-1.067
+X36.000 Y10.500 Z-1.092
+X35.600 Y10.500 Z-1.095
+X35.200 Y10.500 Z-1.072
+X34.800 Y10.500 Z-1.025
+X34.400 Y10.500 Z-0.958
+X34.000 Y10.500 Z-0.876
+X33.600 Y10.500 Z-0.789
+X33.200 Y10.500 Z-0.705
+X32.800 Y10.500 Z-0.633
+X32.400 Y10.500 Z-0.581
+X32.000 Y10.500 Z-0.554
+X31.600 Y10.500 Z-0.553
+X31.200 Y10.500 Z-0.578
+X30.800 Y10.500 Z-0.624
+X30.400 Y10.500 Z-0.684
+X30.000 Y10.500 Z-0.749
+X29.600 Y10.500 Z-0.811
+X29.200 Y10.500 Z-0.860
+X28.800 Y10.500 Z-0.890
+X28.400 Y10.500 Z-0.897
+X28.000 Y10.500 Z-0.879
+X27.600 Y10.500 Z-0.840
+X27.200 Y10.500 Z-0.784
+X26.800 Y10.500 Z-0.719
+X26.400 Y10.500 Z-0.653
+X26.000 Y10.500 Z-0.596
+X25.600 Y10.500 Z-0.557
+X25.200 Y10.500 Z-0.540
+X24.800 Y10.500 Z-0.549
+X24.400 Y10.500 Z-0.585
+X24.000 Y10.500 Z-0.644
+X23.600 Y10.500 Z-0.721
+X23.200 Y10.500 Z-0.806
+X22.800 Y10.500 Z-0.892
+X22.400 Y10.500 Z-0.968
+X22.000 Y10.500 Z-1.028
+X21.600 Y10.500 Z-1.065
+X21.200 Y10.500 Z-1.077
+X20.800 Y10.500 Z-1.065
+X20.400 Y10.500 Z-1.033
+X20.000 Y10.500 Z-0.987
+X19.600 Y10.500 Z-0.935
+X19.200 Y10.500 Z-0.887
+X18.800 Y10.500 Z-0.852
+X18.400 Y10.500 Z-0.835
+X18.000 Y10.500 Z-0.843
+X17.600 Y10.500 Z-0.876
+X17.200 Y10.500 Z-0.932
+X16.800 Y10.500 Z-1.008
+X16.400 Y10.500 Z-1.095
+X16.000 Y10.500 Z-1.185
+X15.600 Y10.500 Z-1.268
+X15.200 Y10.500 Z-1.336
+X14.800 Y10.500 Z-1.383
+X14.400 Y10.500 Z-1.404
+X14.000 Y10.500 Z-1.398
+X13.600 Y10.500 Z-1.369
+X13.200 Y10.500 Z-1.321
+X12.800 Y10.500 Z-1.262
+X12.400 Y10.500 Z-1.201
+X12.000 Y10.500 Z-1.148
+X11.600 Y10.500 Z-1.110
+X11.200 Y10.500 Z-1.092
+X10.800 Y10.500 Z-1.099
+X10.400 Y10.500 Z-1.130
+X10.000 Y10.500 Z-1.180
+X9.600 Y10.500 Z-1.246
+X9.200 Y10.500 Z-1.317
+X8.800 Y10.500 Z-1.385
+X8.400 Y10.500 Z-1.441
+X8.000 Y10.500 Z-1.477
+X7.600 Y10.500 Z-1.489
+X7.200 Y10.500 Z-1.473
+X6.800 Y10.500 Z-1.433
+X6.400 Y10.500 Z-1.370
+X6.000 Y10.500 Z-1.293
+X5.600 Y10.500 Z-1.210
+X5.200 Y10.500 Z-1.130
+X4.800 Y10.500 Z-1.062
+X4.400 Y10.500 Z-1.013
+X4.000 Y10.500 Z-0.987
+X3.600 Y10.500 Z-0.987
+X3.200 Y10.500 Z-1.009
+X2.800 Y10.500 Z-1.049
+X2.400 Y10.500 Z-1.099
+X2.000 Y10.500 Z-1.152
+X1.600 Y10.500 Z-1.197
+X1.200 Y10.500 Z-1.227
+X0.800 Y10.500 Z-1.235
+X0.400 Y10.500 Z-1.218
+X0.000 Y10.500 Z-1.176
+G1 Y11.000
+X0.000 Y11.000 Z-1.200
+X0.400 Y11.000 Z-1.210
+X0.800 Y11.000 Z-1.197
+X1.200 Y11.000 Z-1.164
+X1.600 Y11.000 Z-1.118
+X2.000 Y11.000 Z-1.069
+X2.400 Y11.000 Z-1.026
+X2.800 Y11.000 Z-0.996
+X3.200 Y11.000 Z-0.986
+X3.600 Y11.000 Z-1.000
+X4.000 Y11.000 Z-1.039
+X4.400 Y11.000 Z-1.100
+X4.800 Y11.000 Z-1.178
+X5.200 Y11.000 Z-1.264
+X5.600 Y11.000 Z-1.349
+X6.000 Y11.000 Z-1.425
+X6.400 Y11.000 Z-1.483
+X6.800 Y11.000 Z-1.517
+X7.200 Y11.000 Z-1.525
+X7.600 Y11.000 Z-1.506
+X8.000 Y11.000 Z-1.464
+X8.400 Y11.000 Z-1.405
+X8.800 Y11.000 Z-1.337
+X9.200 Y11.000 Z-1.269
+X9.600 Y11.000 Z-1.211
+X10.000 Y11.000 Z-1.169
+X10.400 Y11.000 Z-1.149
+X10.800 Y11.000 Z-1.153
+X11.200 Y11.000 Z-1.180
+X11.600 Y11.000 Z-1.225
+X12.000 Y11.000 Z-1.283
+X12.400 Y11.000 Z-1.344
+X12.800 Y11.000 Z-1.400
+X13.200 Y11.000 Z-1.441
+X13.600 Y11.000 Z-1.461
+X14.000 Y11.000 Z-1.455
+X14.400 Y11.000 Z-1.423
+X14.800 Y11.000 Z-1.366
+X15.200 Y11.000 Z-1.289
+X15.600 Y11.000 Z-1.201
+X16.000 Y11.000 Z-1.109
+X16.400 Y11.000 Z-1.023
+X16.800 Y11.000 Z-0.951
+X17.200 Y11.000 Z-0.901
+X17.600 Y11.000 Z-0.875
+X18.000 Y11.000 Z-0.874
+X18.400 Y11.000 Z-0.895
+X18.800 Y11.000 Z-0.934
+X19.200 Y11.000 Z-0.981
+X19.600 Y11.000 Z-1.027
+X20.000 Y11.000 Z-1.065
+X20.400 Y11.000 Z-1.087
+X20.800 Y11.000 Z-1.086
+X21.200 Y11.000 Z-1.060
+X21.600 Y11.000 Z-1.009
+X22.000 Y11.000 Z-0.939
+X22.400 Y11.000 Z-0.854
+X22.800 Y11.000 Z-0.763
+X23.200 Y11.000 Z-0.676
+X23.600 Y11.000 Z-0.602
+X24.000 Y11.000 Z-0.548
+X24.400 Y11.000 Z-0.518
+X24.800 Y11.000 Z-0.515
+X25.200 Y11.000 Z-0.538
+X25.600 Y11.000 Z-0.582
+X26.000 Y11.000 Z-0.641
+X26.400 Y11.000 Z-0.704
+X26.800 Y11.000 Z-0.764
+X27.200 Y11.000 Z-0.812
+X27.600 Y11.000 Z-0.841
+X28.000 Y11.000 Z-0.847
+X28.400 Y11.000 Z-0.829
+X28.800 Y11.000 Z-0.789
+X29.200 Y11.000 Z-0.732
+X29.600 Y11.000 Z-0.667
+X30.000 Y11.000 Z-0.602
+X30.400 Y11.000 Z-0.546
+X30.800 Y11.000 Z-0.507
+X31.200 Y11.000 Z-0.492
+X31.600 Y11.000 Z-0.503
+X32.000 Y11.000 Z-0.540
+X32.400 Y11.000 Z-0.601
+X32.800 Y11.000 Z-0.680
+X33.200 Y11.000 Z-0.767
+X33.600 Y11.000 Z-0.855
+X34.000 Y11.000 Z-0.934
+X34.400 Y11.000 Z-0.995
+X34.800 Y11.000 Z-1.035
+X35.200 Y11.000 Z-1.050
+X35.600 Y11.000 Z-1.041
+X36.000 Y11.000 Z-1.011
+X36.400 Y11.000 Z-0.968
+X36.800 Y11.000 Z-0.920
+X37.200 Y11.000 Z-0.875
+X37.600 Y11.000 Z-0.843
+X38.000 Y11.000 Z-0.830
+X38.400 Y11.000 Z-0.841
+X38.800 Y11.000 Z-0.878
+X39.200 Y11.000 Z-0.938
+X39.600 Y11.000 Z-1.017
+X40.000 Y11.000 Z-1.107
+X40.400 Y11.000 Z-1.200
+X40.800 Y11.000 Z-1.287
+X41.200 Y11.000 Z-1.358
+X41.600 Y11.000 Z-1.407
+X42.000 Y11.000 Z-1.431
+X42.400 Y11.000 Z-1.428
+X42.800 Y11.000 Z-1.401
+X43.200 Y11.000 Z-1.355
+X43.600 Y11.000 Z-1.299
+X44.000 Y11.000 Z-1.241
+X44.400 Y11.000 Z-1.189
+X44.800 Y11.000 Z-1.153
+X45.200 Y11.000 Z-1.138
+X45.600 Y11.000 Z-1.146
+X46.000 Y11.000 Z-1.178
+X46.400 Y11.000 Z-1.230
+X46.800 Y11.000 Z-1.296
+X47.200 Y11.000 Z-1.368
+X47.600 Y11.000 Z-1.436
+X48.000 Y11.000 Z-1.492
+X48.400 Y11.000 Z-1.528
+X48.800 Y11.000 Z-1.539
+X49.200 Y11.000 Z-1.523
+X49.600 Y11.000 Z-1.481
+X50.000 Y11.000 Z-1.418
+G1 Y11.500
+X50.000 Y11.500 Z-1.364
+X49.600 Y11.500 Z-1.446
+X49.200 Y11.500 Z-1.515
+X48.800 Y11.500 Z-1.565
+X48.400 Y11.500 Z-1.590
+X48.000 Y11.500 Z-1.588
+X47.600 Y11.500 Z-1.559
+X47.200 Y11.500 Z-1.508
+X46.800 Y11.500 Z-1.441
+X46.400 Y11.500 Z-1.368
+X46.000 Y11.500 Z-1.296
+X45.600 Y11.500 Z-1.234
+X45.200 Y11.500 Z-1.191
+X44.800 Y11.500 Z-1.170
+X44.400 Y11.500 Z-1.173
+X44.000 Y11.500 Z-1.199
+X43.600 Y11.500 Z-1.241
+X43.200 Y11.500 Z-1.294
+X42.800 Y11.500 Z-1.349
+X42.400 Y11.500 Z-1.396
+X42.000 Y11.500 Z-1.427
+X41.600 Y11.500 Z-1.436
+X41.200 Y11.500 Z-1.419
+X40.800 Y11.500 Z-1.375
+X40.400 Y11.500 Z-1.308
+X40.000 Y11.500 Z-1.223
+X39.600 Y11.500 Z-1.128
+X39.200 Y11.500 Z-1.032
+X38.800 Y11.500 Z-0.944
+X38.400 Y11.500 Z-0.872
+X38.000 Y11.500 Z-0.822
+X37.600 Y11.500 Z-0.798
+X37.200 Y11.500 Z-0.799
+X36.800 Y11.500 Z-0.821
+X36.400 Y11.500 Z-0.859
+X36.000 Y11.500 Z-0.905
+X35.600 Y11.500 Z-0.949
+X35.200 Y11.500 Z-0.982
+X34.800 Y11.500 Z-0.998
+X34.400 Y11.500 Z-0.991
+X34.000 Y11.500 Z-0.959
+X33.600 Y11.500 Z-0.904
+X33.200 Y11.500 Z-0.830
+X32.800 Y11.500 Z-0.744
+X32.400 Y11.500 Z-0.655
+X32.000 Y11.500 Z-0.572
+X31.600 Y11.500 Z-0.503
+X31.200 Y11.500 Z-0.456
+X30.800 Y11.500 Z-0.435
+X30.400 Y11.500 Z-0.442
+X30.000 Y11.500 Z-0.473
+X29.600 Y11.500 Z-0.525
+X29.200 Y11.500 Z-0.589
+X28.800 Y11.500 Z-0.657
+X28.400 Y11.500 Z-0.720
+X28.000 Y11.500 Z-0.769
+X27.600 Y11.500 Z-0.798
+X27.200 Y11.500 Z-0.804
+X26.800 Y11.500 Z-0.787
+X26.400 Y11.500 Z-0.749
+X26.000 Y11.500 Z-0.696
+X25.600 Y11.500 Z-0.636
+X25.200 Y11.500 Z-0.578
+X24.800 Y11.500 Z-0.531
+X24.400 Y11.500 Z-0.503
+X24.000 Y11.500 Z-0.499
+X23.600 Y11.500 Z-0.522
+X23.200 Y11.500 Z-0.571
+X22.800 Y11.500 Z-0.642
+X22.400 Y11.500 Z-0.729
+X22.000 Y11.500 Z-0.823
+X21.600 Y11.500 Z-0.915
+X21.200 Y11.500 Z-0.996
+X20.800 Y11.500 Z-1.058
+X20.400 Y11.500 Z-1.098
+X20.000 Y11.500 Z-1.112
+X19.600 Y11.500 Z-1.102
+X19.200 Y11.500 Z-1.074
+X18.800 Y11.500 Z-1.032
+X18.400 Y11.500 Z-0.987
+X18.000 Y11.500 Z-0.948
+X17.600 Y11.500 Z-0.922
+X17.200 Y11.500 Z-0.916
+X16.800 Y11.500 Z-0.935
+X16.400 Y11.500 Z-0.978
+X16.000 Y11.500 Z-1.044
+X15.600 Y11.500 Z-1.127
+X15.200 Y11.500 Z-1.219
+X14.800 Y11.500 Z-1.311
+X14.400 Y11.500 Z-1.395
+X14.000 Y11.500 Z-1.461
+X13.600 Y11.500 Z-1.504
+X13.200 Y11.500 Z-1.520
+X12.800 Y11.500 Z-1.510
+X12.400 Y11.500 Z-1.476
+X12.000 Y11.500 Z-1.424
+X11.600 Y11.500 Z-1.364
+X11.200 Y11.500 Z-1.302
+X10.800 Y11.500 Z-1.250
+X10.400 Y11.500 Z-1.214
+X10.000 Y11.500 Z-1.199
+X9.600 Y11.500 Z-1.207
+X9.200 Y11.500 Z-1.239
+X8.800 Y11.500 Z-1.290
+X8.400 Y11.500 Z-1.352
+X8.000 Y11.500 Z-1.418
+X7.600 Y11.500 Z-1.479
+X7.200 Y11.500 Z-1.525
+X6.800 Y11.500 Z-1.551
+X6.400 Y11.500 Z-1.550
+X6.000 Y11.500 Z-1.522
+X5.600 Y11.500 Z-1.469
+X5.200 Y11.500 Z-1.396
+X4.800 Y11.500 Z-1.309
+X4.400 Y11.500 Z-1.218
+X4.000 Y11.500 Z-1.133
+X3.600 Y11.500 Z-1.061
+X3.200 Y11.500 Z-1.009
+X2.800 Y11.500 Z-0.981
+X2.400 Y11.500 Z-0.978
+X2.000 Y11.500 Z-0.997
+X1.600 Y11.500 Z-1.032
+X1.200 Y11.500 Z-1.077
+X0.800 Y11.500 Z-1.121
+X0.400 Y11.500 Z-1.156
+X0.000 Y11.500 Z-1.175
+G1 Y12.000
+G0 Z5.000
+M5
+G0 X0 Y0
+M30
@@ -39,12 +39,29 @@
 // Default settings. Used when resetting EEPROM. Change to desired name in defaults.h
 #define DEFAULTS_GENERIC
 
-// Serial baud rate
-#define BAUD_RATE 9600
+// Serial baud rate. The UART runs with the baud doubler from 57600 up. At 16MHz, the actual baud
+// rate error is 0.2% for 9600, 19200, and 38400, -0.8% for 57600, and 2.1% for 115200, which are
+// all within the receiver tolerance. 250000, 500000, and 1000000 are exact, but require a host
+// serial driver supporting these non-standard rates. 230400 is off by -3.5% and is not supported.
+// NOTE: The Arduino Uno USB-to-serial chip supports all of these rates.
+#define BAUD_RATE 115200
 
 // Default pin mappings. Grbl officially supports the Arduino Uno only. Other processor types
-// may exist from user-supplied templates or directly user-defined in pin_map.h
-#define PIN_MAP_ARDUINO_UNO
+// may exist from user-supplied templates or directly user-defined in pin_map.h, or be selected on
+// the compiler command line, e.g. -DPIN_MAP_ARDUINO_MEGA_2560 for the 4-axis host bench.
+#if !defined(PIN_MAP_ARDUINO_MEGA_2560) && !defined(PIN_MAP_CUSTOM_PROC)
+  #define PIN_MAP_ARDUINO_UNO
+#endif
+
+// Number of axes, from 3 to 5. The axes beyond X, Y, and Z are A and B, which are driven, planned, 
+// and homed like linear axes in their own units per step setting, e.g. degrees for a rotary axis,
+// which G20 inch mode does not scale. Their settings are $32 and up.
+// The motion core is unrolled for the number of axes at compile time, so a 3-axis build is not 
+// slowed down by support for more. The pin map must define the step, direction, and limit pins
+// of the extra axes. Only the Mega 2560 pin map has room for a 4th axis.
+#ifndef N_AXIS
+  #define N_AXIS 3
+#endif
 
 // Define runtime command special characters. These characters are 'picked-off' directly from the
 // serial read data stream and are not passed to the grbl line execution parser. Select characters
@@ -56,6 +73,31 @@
 #define CMD_FEED_HOLD '!'
 #define CMD_CYCLE_START '~'
 #define CMD_RESET 0x18 // ctrl-x
+#define CMD_JOG_CANCEL 0x85 // Cancels a '$J' jog with a controlled deceleration. Ignored otherwise.
+
+// Define realtime override command characters. Like the above, these are picked off directly from
+// the serial stream and take effect on all motions already in the planner buffer. The feed override
+// scales the programmed feed rate of all feed motions (G1, G2, G3) between MIN_FEED_OVERRIDE and 
+// MAX_FEED_OVERRIDE percent in coarse or fine increments. The rapid override scales the seek rate 
+// of all rapid motions (G0, G28, G30) down to one of three fixed percentages. Both are reset to 100% 
+// upon a system reset. Extended ASCII codes are used, since they can never appear in g-code programs.
+// NOTE: Binary motion stream records must escape these characters. See doc/commands.txt.
+#define CMD_FEED_OVR_RESET 0x90       // Restores feed override value to 100%.
+#define CMD_FEED_OVR_COARSE_PLUS 0x91
+#define CMD_FEED_OVR_COARSE_MINUS 0x92
+#define CMD_FEED_OVR_FINE_PLUS 0x93
+#define CMD_FEED_OVR_FINE_MINUS 0x94
+#define CMD_RAPID_OVR_RESET 0x95      // Restores rapid override value to 100%.
+#define CMD_RAPID_OVR_MEDIUM 0x96
+#define CMD_RAPID_OVR_LOW 0x97
+
+// Feed and rapid override limits and increments, in percent.
+#define MAX_FEED_OVERRIDE 200
+#define MIN_FEED_OVERRIDE 10
+#define FEED_OVERRIDE_COARSE_INCREMENT 10
+#define FEED_OVERRIDE_FINE_INCREMENT 1
+#define RAPID_OVERRIDE_MEDIUM 50
+#define RAPID_OVERRIDE_LOW 25
 
 // The temporal resolution of the acceleration management subsystem. Higher number give smoother
 // acceleration but may impact performance.
@@ -79,13 +121,6 @@
 // never reach its target. This parameter should always be greater than zero.
 #define MINIMUM_STEPS_PER_MINUTE 800 // (steps/min) - Integer value only
 
-// Time delay increments performed during a dwell. The default value is set at 50ms, which provides
-// a maximum time delay of roughly 55 minutes, more than enough for most any application. Increasing
-// this delay will increase the maximum dwell time linearly, but also reduces the responsiveness of 
-// run-time command executions, like status reports, since these are performed between each dwell 
-// time step. Also, keep in mind that the Arduino delay timer is not very accurate for long delays.
-#define DWELL_TIME_STEP 50 // Integer (1-255) (milliseconds)
-
 // If homing is enabled, homing init lock sets Grbl into an alarm state upon power up. This forces
 // the user to perform the homing cycle (or override the locks) before doing anything else. This is
 // mainly a safety feature to remind the user to home, since position is unknown to Grbl.
@@ -112,6 +147,11 @@
 // #define HOMING_SEARCH_CYCLE_2                         // Uncomment and add axes mask to enable
 #define HOMING_LOCATE_CYCLE   ((1<<X_AXIS)|(1<<Y_AXIS)|(1<<Z_AXIS)) // Must contain ALL search axes
 
+// Maximum distance in mm each axis moves in a single homing search or locate motion. If the limit
+// switches are not found within this distance, the homing cycle fails with an alarm. Should be set 
+// somewhat greater than the largest travel of the homed axes.
+#define HOMING_MAX_TRAVEL 2000.0 // mm
+
 // Number of homing cycles performed after when the machine initially jogs to limit switches.
 // This help in preventing overshoot and should improve repeatability. This value should be one or 
 // greater.
@@ -133,6 +173,64 @@
 // up with planning new incoming motions as they are executed. 
 // #define BLOCK_BUFFER_SIZE 18  // Uncomment to override default in planner.h.
 
+// The number of step segments prepped ahead of the stepper interrupt by the main program. Each 
+// segment is a short, constant step rate piece of a planner block trapezoid lasting at most one
+// acceleration tick. The buffer must be deep enough to keep the steppers fed while the main
+// program is busy parsing and planning, but every segment buffered also delays the response to a
+// feed hold by up to one acceleration tick. Each segment uses about 23 bytes of RAM.
+// #define SEGMENT_BUFFER_SIZE 6 // Uncomment to override default in stepper.h.
+
+// The number of parsed line motions that can wait for room in the planner buffer, so the main 
+// program parses ahead of a full planner. One slot is always kept empty. Each takes 4 bytes of RAM
+// per axis plus 5 bytes, which the 328p does not have to spare with a full planner buffer. Suited
+// to the Mega 2560. Without it, the main program waits for room in the planner buffer instead.
+// #define LINE_QUEUE_SIZE 4 // Default disabled. Uncomment to enable.
+
+// Enables Adaptive Multi-Axis Step Smoothing (AMASS). At low step frequencies, the Bresenham line
+// algorithm steps the minor axes in bursts in between the major axis steps, which can cause audible
+// resonance and surface finish artifacts on multi-axis motions. AMASS over-drives the stepper 
+// interrupt by a factor of 2, 4, or 8 below step event frequencies of 8kHz, 4kHz, and 2kHz, 
+// respectively, and scales the Bresenham step counts to match, so each axis is stepped evenly
+// in time. This also keeps the step timer in its high resolution prescaler range. Above 8kHz,
+// the stepper interrupt runs exactly as without AMASS, so high rates are not affected.
+#define ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING // Default enabled. Comment to disable.
+
+// Computes the planner block trapezoids, i.e. the acceleration and deceleration step indices, with
+// fixed-point integer math instead of floats. The AVR has no floating point unit, so each soft-float 
+// multiply, divide, and conversion costs hundreds of cycles, and the trapezoid is recomputed each time
+// the plan of the executing block changes. This shortens the segment preparation of short blocks. The
+// step indices may differ from the floating point result by a step or so, scaled with the length of
+// the acceleration ramps, which the stepper segment generator absorbs.
+#define FIXED_POINT_TRAPEZOID // Default enabled. Comment to disable.
+
+// Carries the g-code axis words, the parser position, and the work coordinate offsets as fixed-point
+// integers of 10 nanometers (0.00001 unit), rather than floats, from reading the number through 
+// the unit conversion and all offsets, down to the planner, which converts the line targets to
+// steps with integer math. Only the arc generator and the path geometry of the planner work in
+// floating point millimeters. This saves several soft-float operations per line, and the parser 
+// position never drifts by single precision round-off, however long the program runs in 
+// incremental mode. Positions are limited to +/-21 meters (845 inches).
+#define FIXED_POINT_COORDINATES // Default enabled. Comment to disable.
+
+// Rounds the acceleration ramps of the block trapezoids into jerk-limited S-curves, which ramp the
+// acceleration up and down at the $38 jerk setting (mm/sec^3) instead of switching it on and off 
+// instantly. This reduces the machine vibration and ringing at the start and end of each ramp. 
+// Neither the acceleration nor the jerk setting is exceeded, so each ramp takes longer than the 
+// linear ramp, by the time to ramp the acceleration up, or more for small speed changes. The planner
+// plans the junction speeds and the trapezoids for the longer S-curves, which the stepper segment
+// generator traces, so the cycle time increases accordingly. A jerk setting of zero disables them.
+// NOTE: Each block is ramped on its own, so a ramp over several short blocks is a series of S-curves.
+// The S-curve planning costs a few more floating point operations per junction.
+// #define JERK_LIMITED_ACCELERATION // Default disabled. Uncomment to enable.
+
+// Merges runs of consecutive, nearly collinear linear motions at the same feed rate into a single
+// planner block, as the short segments of CAM 3D toolpaths often are. No end point of the merged 
+// motions deviates more than this tolerance from the merged line. Longer blocks cost less planner
+// time each and stretch the look-ahead of the planner buffer over a longer distance. Keep this 
+// well below the step resolution of the machine. The merge state takes 12 bytes of RAM per axis,
+// which the 328p does not have to spare with a full planner buffer. Suited to the Mega 2560.
+// #define LINE_MERGE_TOLERANCE 0.002 // (mm) Default disabled. Uncomment to enable.
+
 // Line buffer size from the serial input stream to be executed. Also, governs the size of 
 // each of the startup blocks, as they are each stored as a string of this size. Make sure
 // to account for the available EEPROM at the defined memory address in settings.h and for
@@ -151,6 +249,15 @@
 // messages are sent and Grbl begins to stall, waiting to send the rest of the message.
 // #define RX_BUFFER_SIZE 128 // Uncomment to override defaults in serial.h
 // #define TX_BUFFER_SIZE 64
+
+// EEPROM write-behind queue size. EEPROM writes, i.e. from settings changes, startup line stores,
+// and G10/G28.1/G30.1 coordinate data updates, are queued and programmed in the background by the
+// EEPROM ready interrupt, since each byte takes several milliseconds to program. The main program
+// only stalls when the queue is full. A G10 coordinate update takes 19 bytes of the queue, so the 
+// default holds two. 256 max.
+// NOTE: Queued writes are lost on a power loss. As with a power loss during a write, partially
+// written data then fails its checksum and is reset at the next power-up.
+// #define EEPROM_QUEUE_SIZE 40 // Uncomment to override default in eeprom.h
   
 // Toggles XON/XOFF software flow control for serial communications. Not officially supported
 // due to problems involving the Atmega8U2 USB-to-serial chips on current Arduinos. The firmware
@@ -162,6 +269,12 @@
 // case, please report any successes to grbl administrators!
 // #define ENABLE_XONXOFF // Default disabled. Uncomment to enable.
 
+// Enables the binary motion stream mode, which a host enters with the '$B' command. The host then
+// streams straight line motions as framed, CRC-checked binary records, which are sent directly to
+// the planner without the g-code parser. Grbl still responds with an 'ok' or 'error:' for every
+// record, and the runtime command characters work as usual. See doc/commands.txt for the format.
+#define ENABLE_BINARY_STREAM // Default enabled. Comment to disable.
+
 // Creates a delay between the direction pin setting and corresponding step pulse by creating
 // another interrupt (Timer2 compare) to manage it. The main Grbl interrupt (Timer1 compare) 
 // sets the direction pins, and does not immediately set the stepper pins, as it would in 
@@ -179,12 +292,41 @@
 // successful values for certain setups have ranged from 10 to 20us.
 // #define STEP_PULSE_DELAY 10 // Step pulse delay in microseconds. Default disabled.
 
+// Starts each step pulse with a single write of the stepping port value latched by the previous step
+// interrupt, as the very first operation of the step interrupt, so the step edge follows the step 
+// timer compare match after a fixed number of cycles, regardless of the work the interrupt then does.
+// The direction pins of the next step are set at the end of the previous step pulse, usually most of
+// a step period ahead of the step edge, rather than just before it. The serial receive interrupt 
+// also re-enables interrupts right after reading its byte, so a step interrupt collides with it for
+// less than a microsecond, instead of the whole handler. The step pulse width is still timed by 
+// Timer2 and ended by its interrupt. Cannot be combined with STEP_PULSE_DELAY, which it replaces.
+// #define STEP_PULSE_LATCHED // Default disabled. Uncomment to enable.
+
 // Uncomment the following define if you are using hardware that drives high when your limits
 // are reached. You will need to ensure that you have appropriate pull-down resistors on the
 // limit switch input pins, or that your hardware drives the pins low when they are open (non-
 // triggered).
 // #define LIMIT_SWITCHES_ACTIVE_HIGH
 
+// Enables timing statistics of the main stepper interrupt, printed and cleared by the '$S' command:
+// the worst and average CPU cycles per step interrupt, measured from the step timer compare match
+// by the timer itself, the peak step event rate, the step interrupts skipped because the previous
+// one was still busy, and the step pulses started before Timer2 reset the previous pulse. The cycle
+// counts are only sampled while the step timer runs without a prescaler, i.e. step event rates above
+// F_CPU/65536 (244Hz at 16MHz), which are the rates that approach the interrupt deadline. Useful for
+// sizing the maximum step rates and step pulse width. Costs a little time per step when enabled.
+// #define STEPPER_ISR_STATS // Default disabled. Uncomment to enable.
+
+// Enables the '$T' cycle time estimate mode. Like the '$C' check mode, the g-code program is run
+// without any motion, but the motions are planned by the actual planner, and each block is timed
+// by its trapezoid, as the stepper subsystem would execute it, before being discarded. The total
+// estimated time is reported at the program end (M2/M30), or when '$T' is sent again, broken down
+// by rapids, dwells and the first few feed rates. See ESTIMATE_FEED_RATES in planner.h. Takes
+// about 50 bytes of RAM, which the 328p does not have to spare with a full planner buffer. Suited
+// to the Mega 2560.
+// #define ENABLE_CYCLE_TIME_ESTIMATE // Default disabled. Uncomment to enable.
+// #define ESTIMATE_FEED_RATES 4 // Uncomment to override default in planner.h.
+
 // ---------------------------------------------------------------------------------------
 
 // TODO: Install compile-time option to send numeric status codes rather than strings.
@@ -29,7 +29,7 @@
 #include "coolant_control.h"
 #include "settings.h"
 #include "config.h"
-#include "planner.h"
+#include "motion_control.h"
 
 #include <avr/io.h>
 
@@ -54,20 +54,28 @@ void coolant_stop()
 }
 
 
+// Sets the coolant pins. Called by the stepper subsystem, when the motion stream reaches a coolant
+// event, so it may run in the stepper interrupt.
+void coolant_set_mode(uint8_t mode)
+{
+  if (mode == COOLANT_FLOOD_ENABLE) { 
+    COOLANT_FLOOD_PORT |= (1 << COOLANT_FLOOD_BIT);
+  #ifdef ENABLE_M7  
+    } else if (mode == COOLANT_MIST_ENABLE) {
+        COOLANT_MIST_PORT |= (1 << COOLANT_MIST_BIT);
+  #endif
+  } else {
+    coolant_stop();
+  }
+}
+
+// Queues a coolant change in turn with the buffered motion, so the coolant turns on when specified 
+// in the program without waiting for the motion to complete.
 void coolant_run(uint8_t mode)
 {
   if (mode != current_coolant_mode)
   { 
-    plan_synchronize(); // Ensure coolant turns on when specified in program.
-    if (mode == COOLANT_FLOOD_ENABLE) { 
-      COOLANT_FLOOD_PORT |= (1 << COOLANT_FLOOD_BIT);
-    #ifdef ENABLE_M7  
-      } else if (mode == COOLANT_MIST_ENABLE) {
-          COOLANT_MIST_PORT |= (1 << COOLANT_MIST_BIT);
-    #endif
-    } else {
-      coolant_stop();
-    }
+    mc_sync_event(PLAN_EVENT_COOLANT, mode);
     current_coolant_mode = mode;
   }
 }
@@ -38,5 +38,6 @@
 void coolant_init();
 void coolant_stop();
 void coolant_run(uint8_t mode);
+void coolant_set_mode(uint8_t mode);
 
 #endif
\ No newline at end of file
@@ -44,6 +44,12 @@
   #define DEFAULT_RAPID_FEEDRATE 500.0 // mm/min
   #define DEFAULT_FEEDRATE 250.0
   #define DEFAULT_ACCELERATION (10.0*60*60) // 10*60*60 mm/min^2 = 10 mm/s^2
+  #define DEFAULT_X_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Y_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Z_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_X_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Y_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Z_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
   #define DEFAULT_JUNCTION_DEVIATION 0.05 // mm
   #define DEFAULT_STEPPING_INVERT_MASK ((1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT))
   #define DEFAULT_REPORT_INCHES 0 // false
@@ -51,6 +57,8 @@
   #define DEFAULT_INVERT_ST_ENABLE 0 // false
   #define DEFAULT_HARD_LIMIT_ENABLE 0  // false
   #define DEFAULT_HOMING_ENABLE 0  // false
+  #define DEFAULT_REPORT_BUFFER_STATE 0 // false
+  #define DEFAULT_STATUS_REPORT_MASK 7 // MPos, WPos, Ov
   #define DEFAULT_HOMING_DIR_MASK 0 // move positive dir
   #define DEFAULT_HOMING_RAPID_FEEDRATE 250.0 // mm/min
   #define DEFAULT_HOMING_FEEDRATE 25.0 // mm/min
@@ -59,6 +67,7 @@
   #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-255)
   #define DEFAULT_DECIMAL_PLACES 3
   #define DEFAULT_N_ARC_CORRECTION 25
+  #define DEFAULT_ARC_TOLERANCE 0.002 // mm
 #endif
 
 #ifdef DEFAULTS_SHERLINE_5400
@@ -75,6 +84,12 @@
   #define DEFAULT_RAPID_FEEDRATE 635.0 // mm/min (25ipm)
   #define DEFAULT_FEEDRATE 254.0 // mm/min (10ipm)
   #define DEFAULT_ACCELERATION 50.0*60*60 // 50*60*60 mm/min^2 = 50 mm/s^2
+  #define DEFAULT_X_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Y_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Z_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_X_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Y_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Z_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
   #define DEFAULT_JUNCTION_DEVIATION 0.05 // mm
   #define DEFAULT_STEPPING_INVERT_MASK ((1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT))
   #define DEFAULT_REPORT_INCHES 1 // false
@@ -82,6 +97,8 @@
   #define DEFAULT_INVERT_ST_ENABLE 0 // false
   #define DEFAULT_HARD_LIMIT_ENABLE 0  // false
   #define DEFAULT_HOMING_ENABLE 0  // false
+  #define DEFAULT_REPORT_BUFFER_STATE 0 // false
+  #define DEFAULT_STATUS_REPORT_MASK 7 // MPos, WPos, Ov
   #define DEFAULT_HOMING_DIR_MASK 0 // move positive dir
   #define DEFAULT_HOMING_RAPID_FEEDRATE 250.0 // mm/min
   #define DEFAULT_HOMING_FEEDRATE 25.0 // mm/min
@@ -90,6 +107,7 @@
   #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-255)
   #define DEFAULT_DECIMAL_PLACES 3
   #define DEFAULT_N_ARC_CORRECTION 25
+  #define DEFAULT_ARC_TOLERANCE 0.002 // mm
 #endif
 
 #ifdef DEFAULTS_SHAPEOKO
@@ -109,6 +127,12 @@
   #define DEFAULT_RAPID_FEEDRATE 1000.0 // mm/min
   #define DEFAULT_FEEDRATE 250.0
   #define DEFAULT_ACCELERATION (15.0*60*60) // 15*60*60 mm/min^2 = 15 mm/s^2
+  #define DEFAULT_X_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Y_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Z_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_X_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Y_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Z_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
   #define DEFAULT_JUNCTION_DEVIATION 0.05 // mm
   #define DEFAULT_STEPPING_INVERT_MASK ((1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT))
   #define DEFAULT_REPORT_INCHES 0 // false
@@ -116,6 +140,8 @@
   #define DEFAULT_INVERT_ST_ENABLE 0 // false
   #define DEFAULT_HARD_LIMIT_ENABLE 0  // false
   #define DEFAULT_HOMING_ENABLE 0  // false
+  #define DEFAULT_REPORT_BUFFER_STATE 0 // false
+  #define DEFAULT_STATUS_REPORT_MASK 7 // MPos, WPos, Ov
   #define DEFAULT_HOMING_DIR_MASK 0 // move positive dir
   #define DEFAULT_HOMING_RAPID_FEEDRATE 250.0 // mm/min
   #define DEFAULT_HOMING_FEEDRATE 25.0 // mm/min
@@ -124,6 +150,7 @@
   #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-255)
   #define DEFAULT_DECIMAL_PLACES 3
   #define DEFAULT_N_ARC_CORRECTION 25
+  #define DEFAULT_ARC_TOLERANCE 0.002 // mm
 #endif
 
 #ifdef DEFAULTS_SHAPEOKO_2
@@ -143,6 +170,12 @@
   #define DEFAULT_RAPID_FEEDRATE 500.0 // mm/min
   #define DEFAULT_FEEDRATE 500.0
   #define DEFAULT_ACCELERATION (25.0*60*60) // 25*60*60 mm/min^2 = 25 mm/s^2
+  #define DEFAULT_X_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Y_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Z_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_X_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Y_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Z_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
   #define DEFAULT_JUNCTION_DEVIATION 0.05 // mm
   #define DEFAULT_STEPPING_INVERT_MASK ((1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT))
   #define DEFAULT_REPORT_INCHES 0 // false
@@ -150,6 +183,8 @@
   #define DEFAULT_INVERT_ST_ENABLE 0 // false
   #define DEFAULT_HARD_LIMIT_ENABLE 0  // false
   #define DEFAULT_HOMING_ENABLE 0  // false
+  #define DEFAULT_REPORT_BUFFER_STATE 0 // false
+  #define DEFAULT_STATUS_REPORT_MASK 7 // MPos, WPos, Ov
   #define DEFAULT_HOMING_DIR_MASK 0 // move positive dir
   #define DEFAULT_HOMING_RAPID_FEEDRATE 250.0 // mm/min
   #define DEFAULT_HOMING_FEEDRATE 25.0 // mm/min
@@ -158,6 +193,7 @@
   #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-255)
   #define DEFAULT_DECIMAL_PLACES 3
   #define DEFAULT_N_ARC_CORRECTION 25
+  #define DEFAULT_ARC_TOLERANCE 0.002 // mm
 #endif
 
 #ifdef DEFAULTS_ZEN_TOOLWORKS_7x7
@@ -175,6 +211,12 @@
   #define DEFAULT_RAPID_FEEDRATE 2500.0 // mm/min
   #define DEFAULT_FEEDRATE 1000.0 // mm/min
   #define DEFAULT_ACCELERATION 150.0*60*60 // 150*60*60 mm/min^2 = 150 mm/s^2
+  #define DEFAULT_X_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Y_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_Z_MAX_RATE DEFAULT_RAPID_FEEDRATE // mm/min
+  #define DEFAULT_X_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Y_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
+  #define DEFAULT_Z_ACCELERATION DEFAULT_ACCELERATION // mm/min^2
   #define DEFAULT_JUNCTION_DEVIATION 0.05 // mm
   #define DEFAULT_STEPPING_INVERT_MASK (1<<Y_DIRECTION_BIT)
   #define DEFAULT_REPORT_INCHES 0 // false
@@ -182,6 +224,8 @@
   #define DEFAULT_INVERT_ST_ENABLE 0 // false
   #define DEFAULT_HARD_LIMIT_ENABLE 0  // false
   #define DEFAULT_HOMING_ENABLE 0  // false
+  #define DEFAULT_REPORT_BUFFER_STATE 0 // false
+  #define DEFAULT_STATUS_REPORT_MASK 7 // MPos, WPos, Ov
   #define DEFAULT_HOMING_DIR_MASK 0 // move positive dir
   #define DEFAULT_HOMING_RAPID_FEEDRATE 500.0 // mm/min
   #define DEFAULT_HOMING_FEEDRATE 50.0 // mm/min
@@ -190,6 +234,31 @@
   #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-255)
   #define DEFAULT_DECIMAL_PLACES 3
   #define DEFAULT_N_ARC_CORRECTION 25
+  #define DEFAULT_ARC_TOLERANCE 0.002 // mm
+#endif
+
+// Defaults of the A and B axes, if compiled in (see N_AXIS in config.h). Profiles may define their own.
+#ifndef DEFAULT_A_STEPS_PER_MM
+  #define DEFAULT_A_STEPS_PER_MM 10.0 // step/unit, e.g. step/degree of a rotary axis
+  #define DEFAULT_A_MAX_RATE DEFAULT_RAPID_FEEDRATE // units/min
+  #define DEFAULT_A_ACCELERATION DEFAULT_ACCELERATION // units/min^2
+#endif
+#ifndef DEFAULT_B_STEPS_PER_MM
+  #define DEFAULT_B_STEPS_PER_MM 10.0 // step/unit
+  #define DEFAULT_B_MAX_RATE DEFAULT_RAPID_FEEDRATE // units/min
+  #define DEFAULT_B_ACCELERATION DEFAULT_ACCELERATION // units/min^2
+#endif
+
+// Default jerk of JERK_LIMITED_ACCELERATION (see config.h). Zero leaves the trapezoids linear until
+// set, since a useful jerk depends on the machine. Profiles may define their own.
+#ifndef DEFAULT_JERK
+  #define DEFAULT_JERK 0.0 // mm/min^3, e.g. (1000.0*60*60*60) for 1000 mm/s^3
+#endif
+
+// Default automatic status reports. Disabled, so hosts poll with '?' as before until set.
+#ifndef DEFAULT_STATUS_REPORT_INTERVAL
+  #define DEFAULT_STATUS_REPORT_INTERVAL 0 // msec (0-65k). Zero disables.
+  #define DEFAULT_AUTO_REPORT_ON_CHANGE 0 // false
 #endif
 
 #endif
@@ -23,6 +23,7 @@
 ****************************************************************************/
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include "eeprom.h"
 
 /* These EEPROM bits have different names on different devices. */
 #ifndef EEPE
@@ -37,54 +38,62 @@
 /* Define to reduce code size. */
 #define EEPROM_IGNORE_SELFPROG //!< Remove SPM flag polling.
 
+// Write-behind queue of the EEPROM writes, drained by the EEPROM ready interrupt. Each queued
+// write is stored as its EEPROM start address (2 bytes), size (1 byte), and the data bytes.
+static char eeprom_queue[EEPROM_QUEUE_SIZE];
+static uint8_t eeprom_queue_head = 0;
+static volatile uint8_t eeprom_queue_tail = 0;
+static unsigned int eeprom_write_addr; // EEPROM address of the next byte of the write at the tail.
+static volatile uint8_t eeprom_write_count = 0; // Remaining bytes in the write at the tail.
+
+static void eeprom_queue_wait(uint8_t size);
+
 /*! \brief  Read byte from EEPROM.
  *
  *  This function reads one byte from a given EEPROM address.
  *
  *  \note  The CPU is halted for 4 clock cycles during EEPROM read.
  *
+ *  \note  Any queued writes are completed first, so the byte read is always current.
+ *
  *  \param  addr  EEPROM address to read from.
  *  \return  The byte read from the EEPROM address.
  */
 unsigned char eeprom_get_char( unsigned int addr )
 {
+	eeprom_queue_wait(0); // Wait for the write-behind queue to empty.
 	do {} while( EECR & (1<<EEPE) ); // Wait for completion of previous write.
 	EEAR = addr; // Set EEPROM address register.
 	EECR = (1<<EERE); // Start EEPROM read operation.
 	return EEDR; // Return the byte read from EEPROM.
 }
 
-/*! \brief  Write byte to EEPROM.
+/*! \brief  Program byte to EEPROM.
  *
- *  This function writes one byte to a given EEPROM address.
+ *  This function starts programming one byte to a given EEPROM address.
  *  The differences between the existing byte and the new value is used
  *  to select the most efficient EEPROM programming mode.
  *
  *  \note  The CPU is halted for 2 clock cycles during EEPROM programming.
  *
- *  \note  When this function returns, the new EEPROM value is not available
- *         until the EEPROM programming time has passed. The EEPE bit in EECR
- *         should be polled to check whether the programming is finished.
- *
- *  \note  The EEPROM_GetChar() function checks the EEPE bit automatically.
+ *  \note  Must be called with interrupts disabled and no EEPROM programming
+ *         in progress, i.e. from the EEPROM ready interrupt.
  *
  *  \param  addr  EEPROM address to write to.
  *  \param  new_value  New EEPROM value.
+ *  \param  ready_ie  EERIE bit of EECR, set to keep the EEPROM ready interrupt enabled.
  */
-void eeprom_put_char( unsigned int addr, unsigned char new_value )
+static void eeprom_program_char( unsigned int addr, unsigned char new_value, unsigned char ready_ie )
 {
 	char old_value; // Old EEPROM value.
 	char diff_mask; // Difference mask, i.e. old value XOR new value.
 
-	cli(); // Ensure atomic operation for the write operation.
-	
-	do {} while( EECR & (1<<EEPE) ); // Wait for completion of previous write.
 	#ifndef EEPROM_IGNORE_SELFPROG
 	do {} while( SPMCSR & (1<<SELFPRGEN) ); // Wait for completion of SPM.
 	#endif
 	
 	EEAR = addr; // Set EEPROM address register.
-	EECR = (1<<EERE); // Start EEPROM read operation.
+	EECR = (1<<EERE) | ready_ie; // Start EEPROM read operation.
 	old_value = EEDR; // Get old EEPROM value.
 	diff_mask = old_value ^ new_value; // Get bit differences.
 	
@@ -97,13 +106,13 @@ void eeprom_put_char( unsigned int addr, unsigned char new_value )
 			// Now we know that some bits need to be programmed to '0' also.
 			
 			EEDR = new_value; // Set EEPROM data register.
-			EECR = (1<<EEMPE) | // Set Master Write Enable bit...
+			EECR = (1<<EEMPE) | ready_ie | // Set Master Write Enable bit...
 			       (0<<EEPM1) | (0<<EEPM0); // ...and Erase+Write mode.
 			EECR |= (1<<EEPE);  // Start Erase+Write operation.
 		} else {
 			// Now we know that all bits should be erased.
 
-			EECR = (1<<EEMPE) | // Set Master Write Enable bit...
+			EECR = (1<<EEMPE) | ready_ie | // Set Master Write Enable bit...
 			       (1<<EEPM0);  // ...and Erase-only mode.
 			EECR |= (1<<EEPE);  // Start Erase-only operation.
 		}
@@ -115,26 +124,120 @@ void eeprom_put_char( unsigned int addr, unsigned char new_value )
 			// Now we know that _some_ bits need to the programmed to '0'.
 			
 			EEDR = new_value;   // Set EEPROM data register.
-			EECR = (1<<EEMPE) | // Set Master Write Enable bit...
+			EECR = (1<<EEMPE) | ready_ie | // Set Master Write Enable bit...
 			       (1<<EEPM1);  // ...and Write-only mode.
 			EECR |= (1<<EEPE);  // Start Write-only operation.
 		}
 	}
-	
-	sei(); // Restore interrupt flag state.
 }
 
 // Extensions added as part of Grbl 
 
 
+// Programs the next queued byte to EEPROM, when there is one. Called by the EEPROM ready
+// interrupt, or polled by the main program while interrupts are disabled, e.g. during start-up.
+static void eeprom_queue_service()
+{
+  uint8_t tail = eeprom_queue_tail; // Temporary eeprom_queue_tail (to optimize for volatile)
+  if (eeprom_write_count == 0) {
+    if (tail == eeprom_queue_head) { 
+      EECR &= ~(1<<EERIE); // Queue is empty. Disable interrupt until the next write is queued.
+      return; 
+    }
+    // Load the next queued write.
+    eeprom_write_addr = (unsigned char)eeprom_queue[tail];
+    if (++tail == EEPROM_QUEUE_SIZE) { tail = 0; }
+    eeprom_write_addr |= (unsigned char)eeprom_queue[tail] << 8;
+    if (++tail == EEPROM_QUEUE_SIZE) { tail = 0; }
+    eeprom_write_count = eeprom_queue[tail];
+    if (++tail == EEPROM_QUEUE_SIZE) { tail = 0; }
+  }
+  unsigned char data = eeprom_queue[tail];
+  if (++tail == EEPROM_QUEUE_SIZE) { tail = 0; }
+  eeprom_queue_tail = tail;
+  eeprom_write_count--;
+  
+  // Keep the interrupt enabled, if there is more to write after this byte.
+  eeprom_program_char(eeprom_write_addr++, data, 
+    ((eeprom_write_count) || (tail != eeprom_queue_head)) ? (1<<EERIE) : 0) ;
+}
+
+ISR(EE_READY_vect)
+{
+  eeprom_queue_service();
+}
+
+// Returns the number of free bytes in the queue. One byte is always left unused to tell a full
+// queue from an empty one.
+static uint8_t eeprom_queue_free()
+{
+  uint8_t tail = eeprom_queue_tail;
+  if (eeprom_queue_head < tail) { return(tail-eeprom_queue_head-1); }
+  return(EEPROM_QUEUE_SIZE-1-(eeprom_queue_head-tail));
+}
+
+// Waits until the queue has room for the given number of bytes. Or, when zero, until all queued 
+// writes have been handed to the EEPROM. With interrupts disabled, the queue is drained here
+// instead of by the EEPROM ready interrupt.
+static void eeprom_queue_wait(uint8_t size)
+{
+  for (;;) {
+    if (size) {
+      if (eeprom_queue_free() >= size) { return; }
+    } else {
+      if ((eeprom_queue_tail == eeprom_queue_head) && (eeprom_write_count == 0)) { return; }
+    }
+    if (!(SREG & (1<<SREG_I)) && !(EECR & (1<<EEPE))) { eeprom_queue_service(); }
+  }
+}
+
+// Queues the source data to be written from the EEPROM destination address onwards. Only
+// blocks when the queue is full, until the EEPROM ready interrupt has made enough room.
+static void eeprom_queue_write(unsigned int destination, char *source, unsigned int size)
+{
+  while (size > 0) {
+    // Split data larger than the queue into multiple writes.
+    uint8_t n = EEPROM_QUEUE_SIZE-4; // Maximum data size after the write header and unused byte.
+    if (size < n) { n = size; }
+    eeprom_queue_wait(n+3);
+    
+    uint8_t head = eeprom_queue_head;
+    eeprom_queue[head] = destination & 0xff;
+    if (++head == EEPROM_QUEUE_SIZE) { head = 0; }
+    eeprom_queue[head] = destination >> 8;
+    if (++head == EEPROM_QUEUE_SIZE) { head = 0; }
+    eeprom_queue[head] = n;
+    if (++head == EEPROM_QUEUE_SIZE) { head = 0; }
+    destination += n;
+    size -= n;
+    for (; n > 0; n--) {
+      eeprom_queue[head] = *(source++);
+      if (++head == EEPROM_QUEUE_SIZE) { head = 0; }
+    }
+    
+    // Publish the complete write to the interrupt, then enable it to start programming.
+    eeprom_queue_head = head;
+    EECR |= (1<<EERIE);
+  }
+}
+
+// Queues one byte to be written to a given EEPROM address.
+void eeprom_put_char( unsigned int addr, unsigned char new_value )
+{
+  eeprom_queue_write(addr, (char*)&new_value, 1);
+}
+
+// Queues the source data and its checksum to be written to EEPROM. The checksum is computed up
+// front, so the source data may change as soon as this returns.
 void memcpy_to_eeprom_with_checksum(unsigned int destination, char *source, unsigned int size) {
   unsigned char checksum = 0;
-  for(; size > 0; size--) { 
+  unsigned int i;
+  for(i = 0; i < size; i++) { 
     checksum = (checksum << 1) || (checksum >> 7);
-    checksum += *source;
-    eeprom_put_char(destination++, *(source++)); 
+    checksum += source[i];
   }
-  eeprom_put_char(destination, checksum);
+  eeprom_queue_write(destination, source, size);
+  eeprom_put_char(destination+size, checksum);
 }
 
 int memcpy_from_eeprom_with_checksum(char *destination, unsigned int source, unsigned int size) {
@@ -29,7 +29,14 @@
 #ifndef eeprom_h
 #define eeprom_h
 
-char eeprom_get_char(unsigned int addr);
+#include "config.h"
+
+// Size of the EEPROM write-behind queue. Each queued write takes 3 bytes in addition to its data.
+#ifndef EEPROM_QUEUE_SIZE
+  #define EEPROM_QUEUE_SIZE 40
+#endif
+
+unsigned char eeprom_get_char(unsigned int addr);
 void eeprom_put_char( unsigned int addr, unsigned char new_value );
 void memcpy_to_eeprom_with_checksum(unsigned int destination, char *source, unsigned int size);
 int memcpy_from_eeprom_with_checksum(char *destination, unsigned int source, unsigned int size);
@@ -47,7 +47,8 @@ parser_state_t gc;
 
 #define FAIL(status) gc.status_code = status;
 
-static int next_statement(char *letter, float *float_ptr, char *line, uint8_t *char_counter);
+static int next_statement(char *letter, float *float_ptr, coord_t *coord_ptr, char *line, 
+                          uint8_t *char_counter);
 
 static void select_plane(uint8_t axis_0, uint8_t axis_1, uint8_t axis_2) 
 {
@@ -56,6 +57,53 @@ static void select_plane(uint8_t axis_0, uint8_t axis_1, uint8_t axis_2)
   gc.plane_axis_2 = axis_2;
 }
 
+#ifdef FIXED_POINT_COORDINATES
+// Converts a vector of parser coordinates to millimeters.
+static void coord_vector_to_mm(float *mm, coord_t *coord)
+{
+  uint8_t i;
+  for (i=0; i<N_AXIS; i++) { mm[i] = coord_to_mm(coord[i]); }
+}
+#endif
+
+// Converts an axis word in inches to millimeters. Exact in fixed point, since an inch is 25.4mm.
+static coord_t coord_inches_to_mm(coord_t coord)
+{
+  #ifdef FIXED_POINT_COORDINATES
+    int64_t coord_x10 = (int64_t)coord*254;
+    return((coord_x10 + ((coord_x10 < 0) ? -5 : 5))/10); // Rounded to nearest
+  #else
+    return(coord*MM_PER_INCH);
+  #endif
+}
+
+// Reads a coordinate data vector from EEPROM, which stores millimeters, into parser coordinates.
+// Returns false, if the read fails.
+static uint8_t read_coord_data(uint8_t coord_select, coord_t *coord)
+{
+  #ifdef FIXED_POINT_COORDINATES
+    float coord_data[N_AXIS];
+    if (!settings_read_coord_data(coord_select,coord_data)) { return(false); }
+    uint8_t i;
+    for (i=0; i<N_AXIS; i++) { coord[i] = mm_to_coord(coord_data[i]); }
+    return(true);
+  #else
+    return(settings_read_coord_data(coord_select,coord));
+  #endif
+}
+
+// Writes a coordinate data vector in parser coordinates to EEPROM.
+static void write_coord_data(uint8_t coord_select, coord_t *coord)
+{
+  #ifdef FIXED_POINT_COORDINATES
+    float coord_data[N_AXIS];
+    coord_vector_to_mm(coord_data,coord);
+    settings_write_coord_data(coord_select,coord_data);
+  #else
+    settings_write_coord_data(coord_select,coord);
+  #endif
+}
+
 void gc_init() 
 {
   memset(&gc, 0, sizeof(gc));
@@ -65,23 +113,17 @@ void gc_init()
   gc.absolute_mode = true;
   
   // Load default G54 coordinate system.
-  if (!(settings_read_coord_data(gc.coord_select,gc.coord_system))) { 
+  if (!(read_coord_data(gc.coord_select,gc.coord_system))) { 
     report_status_message(STATUS_SETTING_READ_FAIL); 
   } 
 }
 
 // Sets g-code parser position in mm. Input in steps. Called by the system abort and hard
 // limit pull-off routines.
-void gc_set_current_position(int32_t x, int32_t y, int32_t z) 
-{
-  gc.position[X_AXIS] = x/settings.steps_per_mm[X_AXIS];
-  gc.position[Y_AXIS] = y/settings.steps_per_mm[Y_AXIS];
-  gc.position[Z_AXIS] = z/settings.steps_per_mm[Z_AXIS]; 
-}
-
-static float to_millimeters(float value) 
+void gc_set_current_position(int32_t *position) 
 {
-  return(gc.inches_mode ? (value * MM_PER_INCH) : value);
+  uint8_t i;
+  for (i=0; i<N_AXIS; i++) { gc.position[i] = mm_to_coord(position[i]/settings.steps_per_mm[i]); }
 }
 
 // Executes one line of 0-terminated G-Code. The line is assumed to contain only uppercase
@@ -98,6 +140,7 @@ uint8_t gc_execute_line(char *line)
   uint8_t char_counter = 0;  
   char letter;
   float value;
+  coord_t axis_value; // Value of an axis word. Read as fixed point with FIXED_POINT_COORDINATES.
   int int_value;
   
   uint16_t modal_group_words = 0;  // Bitflag variable to track and check modal group words in block
@@ -107,19 +150,29 @@ uint8_t gc_execute_line(char *line)
   uint8_t absolute_override = false; // true(1) = absolute motion for this block only {G53}
   uint8_t non_modal_action = NON_MODAL_NONE; // Tracks the actions of modal group 0 (non-modal)
   
-  float target[3], offset[3];  
+  coord_t target[N_AXIS];
+  float offset[3];  
   clear_vector(target); // XYZ(ABC) axes parameters.
   clear_vector(offset); // IJK Arc offsets are incremental. Value of zero indicates no change.
     
+  float p = 0, r = 0, f = 0;
+  uint8_t l = 0;
+  uint8_t has_feed_word = false;
+  
   gc.status_code = STATUS_OK;
   
-  /* Pass 1: Commands and set all modes. Check for modal group violations.
+  /* Parse the line in a single pass. Commands set all modes as they are read and are checked for 
+     modal group violations. Parameters are stored as read, in the units of the block, and are 
+     converted only after the whole block is read, since unit and feed modes in the same block apply 
+     to all of its parameters. Position parameters are flagged to indicate a change. These can have
+     multiple connotations for different commands. Each will be converted to their proper value upon
+     execution. 
      NOTE: Modal group numbers are defined in Table 4 of NIST RS274-NGC v3, pg.20 */
   uint8_t group_number = MODAL_GROUP_NONE;
-  while(next_statement(&letter, &value, line, &char_counter)) {
-    int_value = trunc(value);
+  while(next_statement(&letter, &value, &axis_value, line, &char_counter)) {
     switch(letter) {
       case 'G':
+        int_value = trunc(value);
         // Set modal group values
         switch(int_value) {
           case 4: case 10: case 28: case 30: case 53: case 92: group_number = MODAL_GROUP_0; break;
@@ -129,6 +182,7 @@ uint8_t gc_execute_line(char *line)
           case 93: case 94: group_number = MODAL_GROUP_5; break;
           case 20: case 21: group_number = MODAL_GROUP_6; break;
           case 54: case 55: case 56: case 57: case 58: case 59: group_number = MODAL_GROUP_12; break;
+          case 61: case 64: group_number = MODAL_GROUP_13; break;
         }          
         // Set 'G' commands
         switch(int_value) {
@@ -157,6 +211,8 @@ uint8_t gc_execute_line(char *line)
           case 54: case 55: case 56: case 57: case 58: case 59:
             gc.coord_select = int_value-54;
             break;
+          case 61: gc.path_mode = PATH_MODE_EXACT; break;
+          case 64: gc.path_mode = PATH_MODE_CONTINUOUS; break;
           case 80: gc.motion_mode = MOTION_MODE_CANCEL; break;
           case 90: gc.absolute_mode = true; break;
           case 91: gc.absolute_mode = false; break;
@@ -174,6 +230,7 @@ uint8_t gc_execute_line(char *line)
         }
         break;        
       case 'M':
+        int_value = trunc(value);
         // Set modal group values
         switch(int_value) {
           case 0: case 1: case 2: case 30: group_number = MODAL_GROUP_4; break;
@@ -195,42 +252,15 @@ uint8_t gc_execute_line(char *line)
           default: FAIL(STATUS_UNSUPPORTED_STATEMENT);
         }            
         break;
-    }    
-    // Check for modal group multiple command violations in the current block
-    if (group_number) {
-      if ( bit_istrue(modal_group_words,bit(group_number)) ) {
-        FAIL(STATUS_MODAL_GROUP_VIOLATION);
-      } else {
-        bit_true(modal_group_words,bit(group_number));
-      }
-      group_number = MODAL_GROUP_NONE; // Reset for next command.
-    }
-  } 
-
-  // If there were any errors parsing this line, we will return right away with the bad news
-  if (gc.status_code) { return(gc.status_code); }
-  
-  /* Pass 2: Parameters. All units converted according to current block commands. Position 
-     parameters are converted and flagged to indicate a change. These can have multiple connotations
-     for different commands. Each will be converted to their proper value upon execution. */
-  float p = 0, r = 0;
-  uint8_t l = 0;
-  char_counter = 0;
-  while(next_statement(&letter, &value, line, &char_counter)) {
-    switch(letter) {
-      case 'G': case 'M': case 'N': break; // Ignore command statements and line numbers
+      case 'N': break; // Ignore line numbers
       case 'F': 
         if (value <= 0) { FAIL(STATUS_INVALID_STATEMENT); } // Must be greater than zero
-        if (gc.inverse_feed_rate_mode) {
-          inverse_feed_rate = to_millimeters(value); // seconds per motion for this motion only
-        } else {          
-          gc.feed_rate = to_millimeters(value); // millimeters per minute
-        }
+        f = value; has_feed_word = true;
         break;
-      case 'I': case 'J': case 'K': offset[letter-'I'] = to_millimeters(value); break;
+      case 'I': case 'J': case 'K': offset[letter-'I'] = value; break;
       case 'L': l = trunc(value); break;
       case 'P': p = value; break;                    
-      case 'R': r = to_millimeters(value); break;
+      case 'R': r = value; break;
       case 'S': 
         if (value < 0) { FAIL(STATUS_INVALID_STATEMENT); } // Cannot be negative
         // TBD: Spindle speed not supported due to PWM issues, but may come back once resolved.
@@ -240,16 +270,55 @@ uint8_t gc_execute_line(char *line)
         if (value < 0) { FAIL(STATUS_INVALID_STATEMENT); } // Cannot be negative
         gc.tool = trunc(value); 
         break;
-      case 'X': target[X_AXIS] = to_millimeters(value); bit_true(axis_words,bit(X_AXIS)); break;
-      case 'Y': target[Y_AXIS] = to_millimeters(value); bit_true(axis_words,bit(Y_AXIS)); break;
-      case 'Z': target[Z_AXIS] = to_millimeters(value); bit_true(axis_words,bit(Z_AXIS)); break;
+      case 'X': target[X_AXIS] = axis_value; bit_true(axis_words,bit(X_AXIS)); break;
+      case 'Y': target[Y_AXIS] = axis_value; bit_true(axis_words,bit(Y_AXIS)); break;
+      case 'Z': target[Z_AXIS] = axis_value; bit_true(axis_words,bit(Z_AXIS)); break;
+      #if N_AXIS > 3
+        case 'A': target[A_AXIS] = axis_value; bit_true(axis_words,bit(A_AXIS)); break;
+      #endif
+      #if N_AXIS > 4
+        case 'B': target[B_AXIS] = axis_value; bit_true(axis_words,bit(B_AXIS)); break;
+      #endif
       default: FAIL(STATUS_UNSUPPORTED_STATEMENT);
+    }    
+    // Check for modal group multiple command violations in the current block
+    if (group_number) {
+      if ( bit_istrue(modal_group_words,bit(group_number)) ) {
+        FAIL(STATUS_MODAL_GROUP_VIOLATION);
+      } else {
+        bit_true(modal_group_words,bit(group_number));
+      }
+      group_number = MODAL_GROUP_NONE; // Reset for next command.
     }
-  }
-  
+  } 
+
   // If there were any errors parsing this line, we will return right away with the bad news
   if (gc.status_code) { return(gc.status_code); }
   
+  // Convert the length parameters to millimeters by the units mode set for this block. Parameters 
+  // not in the block are zero and unaffected. The A and B axes are always in their own units.
+  if (gc.inches_mode) {
+    uint8_t i;
+    for (i=X_AXIS; i<=Z_AXIS; i++) {
+      target[i] = coord_inches_to_mm(target[i]);
+      offset[i] *= MM_PER_INCH;
+    }
+    r *= MM_PER_INCH;
+    f *= MM_PER_INCH;
+    if (bit_istrue(modal_group_words,bit(MODAL_GROUP_13))) { p *= MM_PER_INCH; } // G64 P tolerance
+  }
+  if (has_feed_word) {
+    if (gc.inverse_feed_rate_mode) {
+      inverse_feed_rate = f; // seconds per motion for this motion only
+    } else {          
+      gc.feed_rate = f; // millimeters per minute
+    }
+  }
+  
+  // Complete any arc still being generated from a previous line, before executing this line. The
+  // arc runs in the background while the main program reads and parses the following lines.
+  mc_arc_synchronize();
+  if (sys.abort) { return(gc.status_code); }
   
   /* Execute Commands: Perform by order of execution defined in NIST RS274-NGC.v3, Table 8, pg.41.
      NOTE: Independent non-motion/settings parameters are set out of this order for code efficiency 
@@ -259,7 +328,7 @@ uint8_t gc_execute_line(char *line)
   // TODO: Seek rates can change depending on the direction and maximum speeds of each axes. When
   // max axis speed is installed, the calculation can be performed here, or maybe in the planner.
     
-  if (sys.state != STATE_CHECK_MODE) { 
+  if ((sys.state != STATE_CHECK_MODE) && (sys.state != STATE_ESTIMATE)) { 
     //  ([M6]: Tool change should be executed here.)
 
     // [M3,M4,M5]: Update spindle state
@@ -269,10 +338,22 @@ uint8_t gc_execute_line(char *line)
     coolant_run(gc.coolant_mode);
   }
   
+  // [G61,G64]: Set path control mode. G64 blends the junctions of the following motions within the
+  // P tolerance, or within the junction deviation setting without one. See plan_buffer_line().
+  if ( bit_istrue(modal_group_words,bit(MODAL_GROUP_13)) ) {
+    if (p < 0) { // Tolerance cannot be negative.
+      FAIL(STATUS_INVALID_STATEMENT); 
+    } else {
+      if (gc.path_mode == PATH_MODE_CONTINUOUS) { gc.path_tolerance = p; } 
+      else { gc.path_tolerance = 0.0; }
+      plan_set_path_tolerance(gc.path_tolerance);
+    }
+  }
+  
   // [G54,G55,...,G59]: Coordinate system selection
   if ( bit_istrue(modal_group_words,bit(MODAL_GROUP_12)) ) { // Check if called in block
-    float coord_data[N_AXIS];
-    if (!(settings_read_coord_data(gc.coord_select,coord_data))) { return(STATUS_SETTING_READ_FAIL); } 
+    coord_t coord_data[N_AXIS];
+    if (!(read_coord_data(gc.coord_select,coord_data))) { return(STATUS_SETTING_READ_FAIL); } 
     memcpy(gc.coord_system,coord_data,sizeof(coord_data));
   }
   
@@ -297,8 +378,8 @@ uint8_t gc_execute_line(char *line)
       } else {
         if (int_value > 0) { int_value--; } // Adjust P1-P6 index to EEPROM coordinate data indexing.
         else { int_value = gc.coord_select; } // Index P0 as the active coordinate system
-        float coord_data[N_AXIS];
-        if (!settings_read_coord_data(int_value,coord_data)) { return(STATUS_SETTING_READ_FAIL); }
+        coord_t coord_data[N_AXIS];
+        if (!read_coord_data(int_value,coord_data)) { return(STATUS_SETTING_READ_FAIL); }
         uint8_t i;
         // Update axes defined only in block. Always in machine coordinates. Can change non-active system.
         for (i=0; i<N_AXIS; i++) { // Axes indices are consistent, so loop may be used.
@@ -310,7 +391,7 @@ uint8_t gc_execute_line(char *line)
             }
           }
         }
-        settings_write_coord_data(int_value,coord_data);
+        write_coord_data(int_value,coord_data);
         // Update system coordinate system if currently active.
         if (gc.coord_select == int_value) { memcpy(gc.coord_system,coord_data,sizeof(coord_data)); }
       }
@@ -333,24 +414,24 @@ uint8_t gc_execute_line(char *line)
             target[i] = gc.position[i];
           }
         }
-        mc_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], settings.default_seek_rate, false);
+        mc_line(target, -1.0, false);
       }
       // Retreive G28/30 go-home position data (in machine coordinates) from EEPROM
-      float coord_data[N_AXIS];
+      coord_t coord_data[N_AXIS];
       if (non_modal_action == NON_MODAL_GO_HOME_1) { 
-        if (!settings_read_coord_data(SETTING_INDEX_G30 ,coord_data)) { return(STATUS_SETTING_READ_FAIL); }     
+        if (!read_coord_data(SETTING_INDEX_G30 ,coord_data)) { return(STATUS_SETTING_READ_FAIL); }     
       } else {
-        if (!settings_read_coord_data(SETTING_INDEX_G28 ,coord_data)) { return(STATUS_SETTING_READ_FAIL); }     
+        if (!read_coord_data(SETTING_INDEX_G28 ,coord_data)) { return(STATUS_SETTING_READ_FAIL); }     
       }      
-      mc_line(coord_data[X_AXIS], coord_data[Y_AXIS], coord_data[Z_AXIS], settings.default_seek_rate, false); 
+      mc_line(coord_data, -1.0, false); 
       memcpy(gc.position, coord_data, sizeof(coord_data)); // gc.position[] = coord_data[];
       axis_words = 0; // Axis words used. Lock out from motion modes by clearing flags.
       break;
     case NON_MODAL_SET_HOME_0: case NON_MODAL_SET_HOME_1:
       if (non_modal_action == NON_MODAL_SET_HOME_1) { 
-        settings_write_coord_data(SETTING_INDEX_G30,gc.position);
+        write_coord_data(SETTING_INDEX_G30,gc.position);
       } else {
-        settings_write_coord_data(SETTING_INDEX_G28,gc.position);
+        write_coord_data(SETTING_INDEX_G28,gc.position);
       }
       break;    
     case NON_MODAL_SET_COORDINATE_OFFSET:
@@ -360,7 +441,7 @@ uint8_t gc_execute_line(char *line)
         // Update axes defined only in block. Offsets current system to defined value. Does not update when
         // active coordinate system is selected, but is still active unless G92.1 disables it. 
         uint8_t i;
-        for (i=0; i<=2; i++) { // Axes indices are consistent, so loop may be used.
+        for (i=0; i<N_AXIS; i++) { // Axes indices are consistent, so loop may be used.
           if (bit_istrue(axis_words,bit(i)) ) {
             gc.coord_offset[i] = gc.position[i]-gc.coord_system[i]-target[i];
           }
@@ -395,7 +476,7 @@ uint8_t gc_execute_line(char *line)
     // absolute mode coordinate offsets or incremental mode offsets.
     // NOTE: Tool offsets may be appended to these conversions when/if this feature is added.
     uint8_t i;
-    for (i=0; i<=2; i++) { // Axes indices are consistent, so loop may be used to save flash space.
+    for (i=0; i<N_AXIS; i++) { // Axes indices are consistent, so loop may be used to save flash space.
       if ( bit_istrue(axis_words,bit(i)) ) {
         if (!absolute_override) { // Do not update target in absolute override mode
           if (gc.absolute_mode) {
@@ -415,7 +496,7 @@ uint8_t gc_execute_line(char *line)
         break;
       case MOTION_MODE_SEEK:
         if (!axis_words) { FAIL(STATUS_INVALID_STATEMENT);} 
-        else { mc_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], settings.default_seek_rate, false); }
+        else { mc_line(target, -1.0, false); }
         break;
       case MOTION_MODE_LINEAR:
         // TODO: Inverse time requires F-word with each statement. Need to do a check. Also need
@@ -423,7 +504,7 @@ uint8_t gc_execute_line(char *line)
         // and after an inverse time move and then check for non-zero feed rate each time. This
         // should be efficient and effective.
         if (!axis_words) { FAIL(STATUS_INVALID_STATEMENT);} 
-        else { mc_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], 
+        else { mc_line(target, 
           (gc.inverse_feed_rate_mode) ? inverse_feed_rate : gc.feed_rate, gc.inverse_feed_rate_mode); }
         break;
       case MOTION_MODE_CW_ARC: case MOTION_MODE_CCW_ARC:
@@ -485,8 +566,8 @@ uint8_t gc_execute_line(char *line)
             */
             
             // Calculate the change in position along each selected axis
-            float x = target[gc.plane_axis_0]-gc.position[gc.plane_axis_0];
-            float y = target[gc.plane_axis_1]-gc.position[gc.plane_axis_1];
+            float x = coord_to_mm(target[gc.plane_axis_0]-gc.position[gc.plane_axis_0]);
+            float y = coord_to_mm(target[gc.plane_axis_1]-gc.position[gc.plane_axis_1]);
             
             clear_vector(offset);
             // First, use h_x2_div_d to compute 4*h^2 to check if it is negative or r is smaller
@@ -555,22 +636,109 @@ uint8_t gc_execute_line(char *line)
   // M0,M1,M2,M30: Perform non-running program flow actions. During a program pause, the buffer may 
   // refill and can only be resumed by the cycle start run-time command.
   if (gc.program_flow) {
+    mc_line_synchronize(); // Queue any pending merged line.
     plan_synchronize(); // Finish all remaining buffered motions. Program paused when complete.
     sys.auto_start = false; // Disable auto cycle start. Forces pause until cycle start issued.
     
     // If complete, reset to reload defaults (G92.2,G54,G17,G90,G94,M48,G40,M5,M9). Otherwise,
     // re-enable program flow after pause complete, where cycle start will resume the program.
-    if (gc.program_flow == PROGRAM_FLOW_COMPLETED) { mc_reset(); }
+    // An estimate mode program ends with the report of its estimated cycle time.
+    if (gc.program_flow == PROGRAM_FLOW_COMPLETED) { 
+      #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+        if (sys.state == STATE_ESTIMATE) { report_cycle_time_estimate(); }
+      #endif
+      mc_reset(); 
+    }
     else { gc.program_flow = PROGRAM_FLOW_RUNNING; }
   }    
   
   return(gc.status_code);
 }
 
+// Executes a jog line. Jogging uses the parser only to convert the jog target into machine 
+// coordinates by the same rules as a G1 motion, but without changing any g-code modal state, so a
+// jog may be issued anytime Grbl is idle between programs without affecting the next program.
+uint8_t gc_execute_jog_line(char *line)
+{
+  if (sys.state == STATE_ALARM) { return(STATUS_ALARM_LOCK); }
+
+  uint8_t char_counter = 0;  
+  char letter;
+  float value;
+  uint8_t axis_words = 0;
+  uint8_t inches_mode = gc.inches_mode;
+  uint8_t absolute_mode = gc.absolute_mode;
+  uint8_t absolute_override = false; // G53
+  float f = 0;
+  coord_t axis_value;
+  coord_t target[N_AXIS];
+  clear_vector(target);
+  
+  gc.status_code = STATUS_OK;
+  while(next_statement(&letter, &value, &axis_value, line, &char_counter)) {
+    switch(letter) {
+      case 'G':
+        switch((int)trunc(value)) {
+          case 20: inches_mode = true; break;
+          case 21: inches_mode = false; break;
+          case 53: absolute_override = true; break;
+          case 90: absolute_mode = true; break;
+          case 91: absolute_mode = false; break;
+          default: FAIL(STATUS_UNSUPPORTED_STATEMENT);
+        }
+        break;
+      case 'F': f = value; break;
+      case 'X': target[X_AXIS] = axis_value; bit_true(axis_words,bit(X_AXIS)); break;
+      case 'Y': target[Y_AXIS] = axis_value; bit_true(axis_words,bit(Y_AXIS)); break;
+      case 'Z': target[Z_AXIS] = axis_value; bit_true(axis_words,bit(Z_AXIS)); break;
+      #if N_AXIS > 3
+        case 'A': target[A_AXIS] = axis_value; bit_true(axis_words,bit(A_AXIS)); break;
+      #endif
+      #if N_AXIS > 4
+        case 'B': target[B_AXIS] = axis_value; bit_true(axis_words,bit(B_AXIS)); break;
+      #endif
+      default: FAIL(STATUS_UNSUPPORTED_STATEMENT);
+    }
+    if (gc.status_code) { break; }
+  }
+  if (gc.status_code) { return(gc.status_code); }
+  
+  // A jog must move at least one axis at an explicit, positive feed rate.
+  if (!axis_words || f <= 0) { return(STATUS_INVALID_STATEMENT); }
+
+  uint8_t i;
+  if (inches_mode) {
+    for (i=X_AXIS; i<=Z_AXIS; i++) { target[i] = coord_inches_to_mm(target[i]); } // A and B axes in their own units.
+    f *= MM_PER_INCH;
+  }
+  for (i=0; i<N_AXIS; i++) {
+    if ( bit_istrue(axis_words,bit(i)) ) {
+      if (absolute_override) { 
+        // Target is in machine coordinates, as given.
+      } else if (absolute_mode) {
+        target[i] += gc.coord_system[i] + gc.coord_offset[i];
+      } else {
+        target[i] += gc.position[i];
+      }
+    } else {
+      target[i] = gc.position[i];
+    }
+  }
+  
+  mc_jog_line(target, f);
+  if (!(sys.abort || sys.jog_cancel)) {
+    // Jog queued. The parser position follows the jog, so later g-code and jogs start from here.
+    memcpy(gc.position, target, sizeof(target)); // gc.position[] = target[];
+  }
+  return(STATUS_OK);
+}
+
 // Parses the next statement and leaves the counter on the first character following
 // the statement. Returns 1 if there was a statements, 0 if end of string was reached
-// or there was an error (check state.status_code).
-static int next_statement(char *letter, float *float_ptr, char *line, uint8_t *char_counter) 
+// or there was an error (check state.status_code). The value of an axis word is returned in 
+// parser coordinates by coord_ptr, and any other value by float_ptr.
+static int next_statement(char *letter, float *float_ptr, coord_t *coord_ptr, char *line, 
+                          uint8_t *char_counter) 
 {
   if (line[*char_counter] == 0) {
     return(0); // No more statements
@@ -582,10 +750,23 @@ static int next_statement(char *letter, float *float_ptr, char *line, uint8_t *c
     return(0);
   }
   (*char_counter)++;
+  #ifdef FIXED_POINT_COORDINATES
+    // Axis words are read as fixed point only. Their float value is not used.
+    if (((*letter >= 'X') && (*letter <= 'Z')) || (*letter == 'A') || (*letter == 'B')) {
+      if (!read_fixed(line, char_counter, coord_ptr, COORD_DECIMALS)) {
+        FAIL(STATUS_BAD_NUMBER_FORMAT); 
+        return(0);
+      }
+      return(1);
+    }
+  #endif
   if (!read_float(line, char_counter, float_ptr)) {
     FAIL(STATUS_BAD_NUMBER_FORMAT); 
     return(0);
   };
+  #ifndef FIXED_POINT_COORDINATES
+    *coord_ptr = *float_ptr;
+  #endif
   return(1);
 }
 
@@ -609,5 +790,5 @@ static int next_statement(char *letter, float *float_ptr, char *line, uint8_t *c
    group 6 = {M6} (Tool change)
    group 8 = {*M7} enable mist coolant
    group 9 = {M48, M49} enable/disable feed and speed override switches
-   group 13 = {G61, G61.1, G64} path control mode
+   group 13 = {G61.1} exact stop path control mode
 */
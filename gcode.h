@@ -47,6 +47,7 @@
 #define MODAL_GROUP_6 7 // [G20,G21] Units
 #define MODAL_GROUP_7 8 // [M3,M4,M5] Spindle turning
 #define MODAL_GROUP_12 9 // [G54,G55,G56,G57,G58,G59] Coordinate system selection
+#define MODAL_GROUP_13 10 // [G61,G64] Path control mode
 
 // Define command actions for within execution-type modal groups (motion, stopping, non-modal). Used
 // internally by the parser to know which command to execute.
@@ -56,6 +57,9 @@
 #define MOTION_MODE_CCW_ARC 3  // G3
 #define MOTION_MODE_CANCEL 4 // G80
 
+#define PATH_MODE_EXACT 0 // G61
+#define PATH_MODE_CONTINUOUS 1 // G64
+
 #define PROGRAM_FLOW_RUNNING 0
 #define PROGRAM_FLOW_PAUSED 1 // M0, M1
 #define PROGRAM_FLOW_COMPLETED 2 // M2, M30
@@ -76,21 +80,23 @@ typedef struct {
   uint8_t inverse_feed_rate_mode;  // {G93, G94}
   uint8_t inches_mode;             // 0 = millimeter mode, 1 = inches mode {G20, G21}
   uint8_t absolute_mode;           // 0 = relative motion, 1 = absolute motion {G90, G91}
+  uint8_t path_mode;               // {G61, G64}
+  float path_tolerance;            // G64 P blending tolerance in mm. Zero in exact path mode.
   uint8_t program_flow;            // {M0, M1, M2, M30}
   int8_t spindle_direction;        // 1 = CW, -1 = CCW, 0 = Stop {M3, M4, M5}
   uint8_t coolant_mode;            // 0 = Disable, 1 = Flood Enable {M8, M9}
   float feed_rate;                 // Millimeters/min
 //  float seek_rate;                 // Millimeters/min. Will be used in v0.9 when axis independence is installed
-  float position[3];               // Where the interpreter considers the tool to be at this point in the code
+  coord_t position[N_AXIS];        // Where the interpreter considers the tool to be at this point in the code
   uint8_t tool;
 //  uint16_t spindle_speed;          // RPM/100
   uint8_t plane_axis_0, 
           plane_axis_1, 
           plane_axis_2;            // The axes of the selected plane  
   uint8_t coord_select;            // Active work coordinate system number. Default: 0=G54.
-  float coord_system[N_AXIS];      // Current work coordinate system (G54+). Stores offset from absolute machine
+  coord_t coord_system[N_AXIS];    // Current work coordinate system (G54+). Stores offset from absolute machine
                                    // position in mm. Loaded from EEPROM when called.
-  float coord_offset[N_AXIS];      // Retains the G92 coordinate offset (work coordinates) relative to
+  coord_t coord_offset[N_AXIS];    // Retains the G92 coordinate offset (work coordinates) relative to
                                    // machine zero in mm. Non-persistent. Cleared upon reset and boot.        
 } parser_state_t;
 extern parser_state_t gc;
@@ -101,7 +107,11 @@ void gc_init();
 // Execute one block of rs275/ngc/g-code
 uint8_t gc_execute_line(char *line);
 
+// Execute one jog line, the command of a '$J=' line. Accepts only G20/G21, G90/G91, G53, the 
+// axis words, and a required F feed rate. Modal states in the line apply to the jog only.
+uint8_t gc_execute_jog_line(char *line);
+
 // Set g-code parser position. Input in steps.
-void gc_set_current_position(int32_t x, int32_t y, int32_t z); 
+void gc_set_current_position(int32_t *position); 
 
 #endif
@@ -0,0 +1,135 @@
+/*
+  hal.h - hardware abstraction of the microcontroller peripherals
+  Part of Grbl
+
+  The MIT License (MIT)
+
+  GRBL(tm) - Embedded CNC g-code interpreter and motion-controller
+  Copyright (c) 2013 Sungeun K. Jeon
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+/* The hal.h file defines the microcontroller peripherals used by Grbl: the step timer, the step
+   pulse timer, the serial port, the limit and pin-out pin change inputs, and the free running
+   system timebase timer. The stepper, serial, limits, protocol, and nuts_bolts modules access these
+   only through the definitions below, together with the pin mapping of pin_map.h, and the non-volatile
+   storage only through the eeprom.h interface. The definitions are macros, so the AVR build compiles
+   to the same register accesses as before and the stepper interrupt pays no function call overhead.
+   NOTE: Only the AVR 328p and Mega 2560 are supported. This gathers their peripheral register access
+   in one place, but it is not yet a complete port interface. The pin map, the program memory strings,
+   the interrupt macros, and the sleep mode still use avr-libc throughout the modules. */
+
+#ifndef hal_h
+#define hal_h
+
+#include "config.h"
+
+#ifndef HAL_CUSTOM_PROC // AVR 328p and Mega 2560. Both have the same timers and serial port 0.
+
+  #include <avr/io.h>
+  #include <avr/interrupt.h>
+
+  // Step timer. Timer1 in CTC mode, with the output pins disconnected. Its compare match interrupt is
+  // the stepper driver interrupt, which runs at the step event rate of the executing segment. The
+  // rate is set by the clock select bits of the prescaler and the compare value, as computed by
+  // config_step_timer() in stepper.c. The counter counts from the last compare match.
+  #define HAL_STEP_TIMER_vect TIMER1_COMPA_vect
+  #define hal_step_timer_init() { \
+    TCCR1B &= ~(1<<WGM13); TCCR1B |= (1<<WGM12); TCCR1A &= ~((1<<WGM11)|(1<<WGM10)); \
+    TCCR1A &= ~((3<<COM1A0)|(3<<COM1B0)); }
+  #define hal_step_timer_set_rate(prescaler,ceiling) { \
+    TCCR1B = (TCCR1B & ~(0x07<<CS10)) | ((prescaler)<<CS10); OCR1A = (ceiling); }
+  #define hal_step_timer_enable() (TIMSK1 |= (1<<OCIE1A))
+  #define hal_step_timer_disable() (TIMSK1 &= ~(1<<OCIE1A))
+  #define hal_step_timer_count() (TCNT1)
+  #define hal_step_timer_unprescaled() ((TCCR1B & (0x07<<CS10)) == (1<<CS10)) // Counts CPU cycles
+
+  // Step pulse timer. Timer2 in normal mode, counting up at F_CPU/8 from the loaded count. Its overflow
+  // interrupt ends the step pulse, and its optional compare match interrupt begins a delayed pulse.
+  // The timer is stopped while no step pulse is active.
+  #define HAL_PULSE_TIMER_vect TIMER2_OVF_vect
+  #define HAL_PULSE_DELAY_vect TIMER2_COMPA_vect
+  #define hal_pulse_timer_init() { TCCR2A = 0; TCCR2B = 0; TIMSK2 |= (1<<TOIE2); }
+  #define hal_pulse_timer_delay_init(count) { OCR2A = (count); TIMSK2 |= (1<<OCIE2A); }
+  #define hal_pulse_timer_start(count) { TCNT2 = (count); TCCR2B = (1<<CS21); }
+  #define hal_pulse_timer_stop() (TCCR2B = 0)
+  #define hal_pulse_timer_running() (TCCR2B)
+
+  // Serial port. USART0 at BAUD_RATE, 8-bit, no parity, 1 stop bit, with the receive complete and
+  // data register empty interrupts. The latter is enabled only while there is data to transmit.
+  #define HAL_SERIAL_RX_vect SERIAL_RX
+  #define HAL_SERIAL_TX_vect SERIAL_UDRE
+  #if BAUD_RATE < 57600
+    #define HAL_SERIAL_UBRR (((F_CPU / (8L * BAUD_RATE)) - 1)/2)
+    #define HAL_SERIAL_U2X 0 // Baud doubler off
+  #else
+    #define HAL_SERIAL_UBRR (((F_CPU / (4L * BAUD_RATE)) - 1)/2)
+    #define HAL_SERIAL_U2X (1 << U2X0) // Baud doubler on for high baud rates, i.e. 115200
+  #endif
+  #define hal_serial_init() { \
+    UCSR0A = (UCSR0A & ~(1 << U2X0)) | HAL_SERIAL_U2X; \
+    UBRR0H = HAL_SERIAL_UBRR >> 8; UBRR0L = HAL_SERIAL_UBRR; \
+    UCSR0B |= (1<<RXEN0)|(1<<TXEN0)|(1<<RXCIE0); }
+  #define hal_serial_read() (UDR0)
+  #define hal_serial_write(data) (UDR0 = (data))
+  #define hal_serial_tx_enable() (UCSR0B |= (1 << UDRIE0))
+  #define hal_serial_tx_disable() (UCSR0B &= ~(1 << UDRIE0))
+  #define hal_serial_rx_enable() (UCSR0B |= (1 << RXCIE0))
+  #define hal_serial_rx_disable() (UCSR0B &= ~(1 << RXCIE0))
+
+  // Limit switch inputs. A pin change interrupt on any of the limit pins, with the pull-up resistors
+  // enabled, unless the switches are active high and pulled down externally.
+  #define HAL_LIMIT_vect LIMIT_INT_vect
+  #ifndef LIMIT_SWITCHES_ACTIVE_HIGH
+    #define hal_limit_init() { LIMIT_DDR &= ~(LIMIT_MASK); LIMIT_PORT |= (LIMIT_MASK); }
+  #else
+    #define hal_limit_init() { LIMIT_DDR &= ~(LIMIT_MASK); LIMIT_PORT &= ~(LIMIT_MASK); }
+  #endif
+  #define hal_limit_read() (LIMIT_PIN)
+  #define hal_limit_interrupt_enable() { LIMIT_PCMSK |= LIMIT_MASK; PCICR |= (1 << LIMIT_INT); }
+  #define hal_limit_interrupt_disable() { LIMIT_PCMSK &= ~LIMIT_MASK; PCICR &= ~(1 << LIMIT_INT); }
+
+  // Pin-out command inputs, i.e. reset, feed hold, and cycle start. A pin change interrupt on any of
+  // the pins, which are active low with the pull-up resistors enabled.
+  #define HAL_PINOUT_vect PINOUT_INT_vect
+  #define hal_pinout_init() { \
+    PINOUT_DDR &= ~(PINOUT_MASK); PINOUT_PORT |= PINOUT_MASK; \
+    PINOUT_PCMSK |= PINOUT_MASK; PCICR |= (1 << PINOUT_INT); }
+  #define hal_pinout_read() (PINOUT_PIN)
+
+  // System timebase timer. Timer0 running free at F_CPU/1024, 64 usec per count at 16MHz, with its
+  // overflow interrupt extending the 8-bit counter in software. See sys_get_time() in nuts_bolts.c.
+  #define HAL_TIMEBASE_vect TIMER0_OVF_vect
+  #define HAL_TIMEBASE_PER_SECOND (F_CPU/1024)
+  #define hal_timebase_init() { TCCR0A = 0; TCCR0B = (1<<CS02)|(1<<CS00); TIMSK0 |= (1<<TOIE0); }
+  #define hal_timebase_count() (TCNT0)
+  #define hal_timebase_overflow_pending() (TIFR0 & (1<<TOV0))
+
+#endif
+
+/*
+#ifdef HAL_CUSTOM_PROC
+  // For a different processor, copy and paste the AVR definitions above and implement each of them
+  // for its peripherals, along with its own headers. Then, define HAL_CUSTOM_PROC in config.h. The
+  // avr-libc dependencies of the modules must be replaced as well. See the note above.
+#endif
+*/
+
+#endif
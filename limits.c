@@ -27,8 +27,7 @@
   THE SOFTWARE.
 */  
 #include <util/delay.h>
-#include <avr/io.h>
-#include <avr/interrupt.h>
+#include "hal.h"
 #include "stepper.h"
 #include "settings.h"
 #include "nuts_bolts.h"
@@ -40,41 +39,49 @@
 #include "limits.h"
 #include "report.h"
 
-#define MICROSECONDS_PER_ACCELERATION_TICK  (1000000/ACCELERATION_TICKS_PER_SECOND)
-
 void limits_init() 
 {
-  LIMIT_DDR &= ~(LIMIT_MASK); // Set as input pins
-  #ifndef LIMIT_SWITCHES_ACTIVE_HIGH
-    LIMIT_PORT |= (LIMIT_MASK); // Enable internal pull-up resistors. Normal high operation.
-  #else // LIMIT_SWITCHES_ACTIVE_HIGH
-    LIMIT_PORT &= ~(LIMIT_MASK); // Normal low operation. Requires external pull-down.
-  #endif // !LIMIT_SWITCHES_ACTIVE_HIGH
+  hal_limit_init(); // Set as input pins, normally high with pull-ups, unless active high.
   if (bit_istrue(settings.flags,BITFLAG_HARD_LIMIT_ENABLE)) {
-    LIMIT_PCMSK |= LIMIT_MASK; // Enable specific pins of the Pin Change Interrupt
-    PCICR |= (1 << LIMIT_INT); // Enable Pin Change Interrupt
+    hal_limit_interrupt_enable();
   } else {
-    LIMIT_PCMSK &= ~LIMIT_MASK; // Disable
-    PCICR &= ~(1 << LIMIT_INT); 
+    hal_limit_interrupt_disable();
   }
 }
 
+// Homing motion state. The limit pin state that stops an axis, when inverted to leave the switches.
+static volatile uint8_t homing_invert_pin;
+
+// Locks every axis whose limit switch reached the state the homing motion is looking for, i.e. engaged
+// when approaching, or released when leaving. Locked axes stop stepping on the next step event and
+// stay locked for the rest of the homing motion, so switch bounce cannot restart them.
+static void homing_lock_axes()
+{
+  uint8_t limit_state = hal_limit_read();
+  if (homing_invert_pin) { limit_state ^= LIMIT_MASK; } // If leaving switch, invert to move.
+  #define LOCK_AXIS(idx) \
+    if (!(limit_state & (1<<LIMIT_BIT_##idx))) { sys.homing_axis_lock |= (1<<idx); }
+  FOR_EACH_AXIS(LOCK_AXIS)
+  #undef LOCK_AXIS
+}
+
 // This is the Limit Pin Change Interrupt, which handles the hard limit feature. A bouncing 
 // limit switch can cause a lot of problems, like false readings and multiple interrupt calls.
 // If a switch is triggered at all, something bad has happened and treat it as such, regardless
 // if a limit switch is being disengaged. It's impossible to reliably tell the state of a 
 // bouncing pin without a debouncing method.
-// NOTE: Do not attach an e-stop to the limit pins, because this interrupt is disabled during
-// homing cycles and will not respond correctly. Upon user request or need, there may be a
-// special pinout for an e-stop, but it is generally recommended to just directly connect
+// During a homing motion, this interrupt instead stops each axis at its limit switch, while the 
+// main stepper interrupt continues the others.
+// NOTE: Do not attach an e-stop to the limit pins, because this interrupt does not trigger an
+// alarm during homing cycles and will not respond correctly. Upon user request or need, there may 
+// be a special pinout for an e-stop, but it is generally recommended to just directly connect
 // your e-stop switch to the Arduino reset pin, since it is the most correct way to do this.
-ISR(LIMIT_INT_vect) 
+ISR(HAL_LIMIT_vect) 
 {
-  // TODO: This interrupt may be used to manage the homing cycle directly with the main stepper
-  // interrupt without adding too much to it. All it would need is some way to stop one axis 
-  // when its limit is triggered and continue the others. This may reduce some of the code, but
-  // would make Grbl a little harder to read and understand down road. Holding off on this until
-  // we move on to new hardware or flash space becomes an issue. If it ain't broke, don't fix it.
+  if (sys.state == STATE_HOMING) { 
+    homing_lock_axes(); 
+    return;
+  }
 
   // Ignore limit switches if already in an alarm state or in-process of executing an alarm.
   // When in the alarm state, Grbl should have been reset or will force a reset, so any pending 
@@ -91,147 +98,85 @@ ISR(LIMIT_INT_vect)
 
 
 // Moves all specified axes in same specified direction (positive=true, negative=false)
-// and at the homing rate. Homing is a special motion case, where there is only an 
-// acceleration followed by abrupt asynchronous stops by each axes reaching their limit 
-// switch independently. Instead of shoehorning homing cycles into the main stepper 
-// algorithm and overcomplicate things, a stripped-down, lite version of the stepper 
-// algorithm is written here. This also lets users hack and tune this code freely for
-// their own particular needs without affecting the rest of Grbl.
+// and at the homing rate, until each reaches its limit switch. Homing is a special motion case,
+// where there is only an acceleration followed by abrupt asynchronous stops by each axes reaching
+// their limit switch independently. The motion is planned as a single block and executed by the 
+// main stepper interrupt, so homing runs at full step rates with the planner acceleration. The 
+// limit pin change interrupt locks each axis on the exact step event its switch changes state.
 // NOTE: Only the abort runtime command can interrupt this process.
 static void homing_cycle(uint8_t cycle_mask, int8_t pos_dir, bool invert_pin, float homing_rate) 
 {
+  if (sys.execute & EXEC_RESET) { return; }
+
   #ifdef LIMIT_SWITCHES_ACTIVE_HIGH
     // When in an active-high switch configuration, invert_pin needs to be adjusted.
     invert_pin = !invert_pin;
   #endif
 
-  // Determine governing axes with finest step resolution per distance for the Bresenham
-  // algorithm. This solves the issue when homing multiple axes that have different 
-  // resolutions without exceeding system acceleration setting. It doesn't have to be
-  // perfect since homing locates machine zero, but should create for a more consistent 
-  // and speedy homing routine.
-  // NOTE: For each axes enabled, the following calculations assume they physically move 
-  // an equal distance over each time step until they hit a limit switch, aka dogleg.
-  uint32_t steps[3];
+  // Lock the axes not homed in this cycle and any already at their switch state.
+  homing_invert_pin = invert_pin;
+  sys.homing_axis_lock = ~cycle_mask;
+  cli(); homing_lock_axes(); sei(); // Atomic with respect to the limit pin change interrupt.
+  if (sys.homing_axis_lock == 0xff) { return; }
+
+  // Move each homed axis the maximum homing travel towards or away from its switch. The axes
+  // physically move an equal distance over each time step until they hit a limit switch, aka dogleg.
+  // NOTE: Locked axes do not step and their system position remains exact, so the planner restarts
+  // from it for each cycle.
+  uint8_t dir_bits = settings.homing_dir_mask; // Apply homing direction settings. Set bits move negative.
+  if (!pos_dir) { dir_bits ^= DIRECTION_MASK; } // Invert bits, if negative dir.
+  coord_t target[N_AXIS];
+  #define TRAVEL_AXIS(idx) \
+    target[idx] = mm_to_coord((dir_bits & (1<<DIRECTION_BIT_##idx)) ? -HOMING_MAX_TRAVEL : HOMING_MAX_TRAVEL);
+  FOR_EACH_AXIS(TRAVEL_AXIS)
+  #undef TRAVEL_AXIS
   uint8_t dist = 0;
-  clear_vector(steps);
-  if (cycle_mask & (1<<X_AXIS)) { 
-    dist++;
-    steps[X_AXIS] = lround(settings.steps_per_mm[X_AXIS]); 
+  uint8_t i;
+  for (i=0; i<N_AXIS; i++) {
+    if (cycle_mask & (1<<i)) { dist++; } 
+    else { target[i] = 0; }
+    target[i] += mm_to_coord(sys.position[i]/settings.steps_per_mm[i]);
   }
-  if (cycle_mask & (1<<Y_AXIS)) { 
-    dist++;
-    steps[Y_AXIS] = lround(settings.steps_per_mm[Y_AXIS]); 
-  }
-  if (cycle_mask & (1<<Z_AXIS)) {
-    dist++;
-    steps[Z_AXIS] = lround(settings.steps_per_mm[Z_AXIS]);
-  }
-  uint32_t step_event_count = max(steps[X_AXIS], max(steps[Y_AXIS], steps[Z_AXIS]));  
-  
-  // To ensure global acceleration is not exceeded, reduce the governing axes nominal rate
-  // by adjusting the actual axes distance traveled per step. This is the same procedure
-  // used in the main planner to account for distance traveled when moving multiple axes.
-  // NOTE: When axis acceleration independence is installed, this will be updated to move
-  // all axes at their maximum acceleration and rate.
-  float ds = step_event_count/sqrt(dist);
-
-  // Compute the adjusted step rate change with each acceleration tick. (in step/min/acceleration_tick)
-  uint32_t delta_rate = ceil( ds*settings.acceleration/(60*ACCELERATION_TICKS_PER_SECOND));
   
   #ifdef HOMING_RATE_ADJUST
     // Adjust homing rate so a multiple axes moves all at the homing rate independently.
     homing_rate *= sqrt(dist); // Eq. only works if axes values are 1 or 0.
   #endif
+
+  plan_reset_buffer();
+  plan_set_current_position(sys.position);
+  plan_buffer_line(target, homing_rate, false);
+  st_prep_buffer();
+  st_wake_up();
   
-  // Nominal and initial time increment per step. Nominal should always be greater then 3
-  // usec, since they are based on the same parameters as the main stepper routine. Initial
-  // is based on the MINIMUM_STEPS_PER_MINUTE config. Since homing feed can be very slow,
-  // disable acceleration when rates are below MINIMUM_STEPS_PER_MINUTE.
-  uint32_t dt_min = lround(1000000*60/(ds*homing_rate)); // Cruising (usec/step)
-  uint32_t dt = 1000000*60/MINIMUM_STEPS_PER_MINUTE; // Initial (usec/step)
-  if (dt > dt_min) { dt = dt_min; } // Disable acceleration for very slow rates.
-      
-  // Set default out_bits. 
-  uint8_t out_bits0 = settings.invert_mask;
-  out_bits0 ^= (settings.homing_dir_mask & DIRECTION_MASK); // Apply homing direction settings
-  if (!pos_dir) { out_bits0 ^= DIRECTION_MASK; }   // Invert bits, if negative dir.
-  
-  // Initialize stepping variables
-  int32_t counter_x = -(step_event_count >> 1); // Bresenham counters
-  int32_t counter_y = counter_x;
-  int32_t counter_z = counter_x;
-  uint32_t step_delay = dt-settings.pulse_microseconds;  // Step delay after pulse
-  uint32_t step_rate = 0;  // Tracks step rate. Initialized from 0 rate. (in step/min)
-  uint32_t trap_counter = MICROSECONDS_PER_ACCELERATION_TICK/2; // Acceleration trapezoid counter
-  uint8_t out_bits;
-  uint8_t limit_state;
-  for(;;) {
-  
-    // Reset out bits. Both direction and step pins appropriately inverted and set.
-    out_bits = out_bits0;
-    
-    // Get limit pin state.
-    limit_state = LIMIT_PIN;
-    if (invert_pin) { limit_state ^= LIMIT_MASK; } // If leaving switch, invert to move.
-    
-    // Set step pins by Bresenham line algorithm. If limit switch reached, disable and
-    // flag for completion.
-    if (cycle_mask & (1<<X_AXIS)) {
-      counter_x += steps[X_AXIS];
-      if (counter_x > 0) {
-        if (limit_state & (1<<X_LIMIT_BIT)) { out_bits ^= (1<<X_STEP_BIT); }
-        else { cycle_mask &= ~(1<<X_AXIS); }
-        counter_x -= step_event_count;
-      }
-    }
-    if (cycle_mask & (1<<Y_AXIS)) {
-      counter_y += steps[Y_AXIS];
-      if (counter_y > 0) {
-        if (limit_state & (1<<Y_LIMIT_BIT)) { out_bits ^= (1<<Y_STEP_BIT); }
-        else { cycle_mask &= ~(1<<Y_AXIS); }
-        counter_y -= step_event_count;
-      }
-    }
-    if (cycle_mask & (1<<Z_AXIS)) {
-      counter_z += steps[Z_AXIS];
-      if (counter_z > 0) {
-        if (limit_state & (1<<Z_LIMIT_BIT)) { out_bits ^= (1<<Z_STEP_BIT); }
-        else { cycle_mask &= ~(1<<Z_AXIS); }
-        counter_z -= step_event_count;
-      }
-    }        
-    
-    // Check if we are done or for system abort
-    if (!(cycle_mask) || (sys.execute & EXEC_RESET)) { return; }
-        
-    // Perform step.
-    STEPPING_PORT = (STEPPING_PORT & ~STEP_MASK) | (out_bits & STEP_MASK);
-    delay_us(settings.pulse_microseconds);
-    STEPPING_PORT = out_bits0;
-    delay_us(step_delay);
-    
-    // Track and set the next step delay, if required. This routine uses another Bresenham
-    // line algorithm to follow the constant acceleration line in the velocity and time 
-    // domain. This is a lite version of the same routine used in the main stepper program.
-    if (dt > dt_min) { // Unless cruising, check for time update.
-      trap_counter += dt; // Track time passed since last update.
-      if (trap_counter > MICROSECONDS_PER_ACCELERATION_TICK) {
-        trap_counter -= MICROSECONDS_PER_ACCELERATION_TICK;
-        step_rate += delta_rate; // Increment velocity
-        dt = (1000000*60)/step_rate; // Compute new time increment
-        if (dt < dt_min) {dt = dt_min;}  // If target rate reached, cruise.
-        step_delay = dt-settings.pulse_microseconds;
+  // Keep the steppers fed until all axes are locked. If the motion completes first, a switch was
+  // not found within the homing travel.
+  for (;;) {
+    st_prep_buffer();
+    if (sys.execute & EXEC_RESET) { return; } // Check for system abort
+    if (sys.homing_axis_lock == 0xff) { break; }
+    if (sys.execute & EXEC_CYCLE_STOP) {
+      bit_false(sys.execute,EXEC_CYCLE_STOP);
+      if (plan_get_current_block() != NULL) { // Segment buffer underrun. Resume.
+        st_wake_up();
+        continue;
       }
+      report_alarm_message(ALARM_HOMING_FAIL);
+      sys.state = STATE_ALARM; // Position is still known, but machine zero is not.
+      mc_reset(); 
+      return;
     }
   }
+  st_halt(); // Stop stepping abruptly. All axes are at their switches.
+  plan_reset_buffer();
 }
 
 
 void limits_go_home() 
 {  
-  // Enable only the steppers, not the cycle. Cycle should be inactive/complete.
-  st_wake_up();
+  // Enable the limit pin change interrupt, which stops the axes at their switches, regardless of the
+  // hard limits setting. Each homing motion wakes up the steppers, which then stay enabled throughout.
+  hal_limit_interrupt_enable();
   
   // Search to engage all axes limit switches at faster homing seek rate.
   homing_cycle(HOMING_SEARCH_CYCLE_0, true, false, settings.homing_seek_rate);  // Search cycle 0
@@ -258,5 +203,7 @@ void limits_go_home()
     }
   }
 
+  sys.homing_axis_lock = 0;
+  hal_limit_interrupt_disable(); // Disable the pin change interrupt for the pull-off. 
   st_go_idle(); // Call main stepper shutdown routine.  
 }
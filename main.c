@@ -52,6 +52,7 @@ int main(void)
   serial_init(); // Setup serial baud rate and interrupts
   settings_init(); // Load grbl settings from EEPROM
   st_init(); // Setup stepper pins and interrupt timers
+  sys_timebase_init(); // Start the system timebase for the planner telemetry and status reports
   sei(); // Enable interrupts
   
   memset(&sys, 0, sizeof(sys));  // Clear all system variables
@@ -68,6 +69,7 @@ int main(void)
       serial_reset_read_buffer(); // Clear serial read buffer
       plan_init(); // Clear block buffer and planner variables
       gc_init(); // Set g-code parser to default state
+      mc_init(); // Clear any pending arc motion
       protocol_init(); // Clear incoming line data and execute startup lines
       spindle_init();
       coolant_init();
@@ -81,6 +83,11 @@ int main(void)
       // Reset system variables.
       sys.abort = false;
       sys.execute = 0;
+      sys.override = 0;
+      sys.jog_cancel = false;
+      sys.homing_axis_lock = 0;
+      sys.feed_override = 100;
+      sys.rapid_override = 100;
       if (bit_istrue(settings.flags,BITFLAG_AUTO_START)) { sys.auto_start = true; }
       
       // Check for power-up and set system alarm if homing is enabled to force homing cycle
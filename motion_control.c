@@ -36,6 +36,7 @@
 #include <stdlib.h>
 #include "settings.h"
 #include "config.h"
+#include "hal.h"
 #include "gcode.h"
 #include "motion_control.h"
 #include "spindle_control.h"
@@ -46,25 +47,184 @@
 #include "limits.h"
 #include "protocol.h"
 
-// Execute linear motion in absolute millimeter coordinates. Feed rate given in millimeters/second
+#ifdef LINE_MERGE_TOLERANCE
+// Line merge state. Consecutive linear motions at the same feed rate are merged into one pending 
+// line, as long as all of their end points lie within a band of half the merge tolerance around the
+// direction of the first motion and keep advancing along it. The merged line also lies within this
+// band, so no end point deviates more than the merge tolerance from it. The pending line is queued 
+// into the planner once a motion does not fit, or as the planner runs low on blocks or at any sync
+// point. See mc_line_continue() and mc_line_synchronize().
+typedef struct {
+  uint8_t pending;            // True, if a merged line is pending
+  uint8_t start_valid;        // True, if the start of the next line is known. Cleared by position resets.
+  float feed_rate;            // Feed rate of the pending line. Never an inverse time feed rate.
+  coord_t start[N_AXIS];      // Start of the pending line, i.e. end of the last queued line
+  coord_t target[N_AXIS];     // End of the pending line
+  float unit_vec[N_AXIS];     // Direction of the first motion of the pending line
+  float travel;               // Travel of the pending line end along the direction of the band
+} merge_t;
+static merge_t merge;
+#endif
+
+// Plans a linear motion into the planner, which must have room for it, and starts the cycle.
+static void mc_plan_line(coord_t *target, float feed_rate, uint8_t invert_feed_rate)
+{
+  PROFILE_BEGIN(PROFILE_PLAN_BUFFER_LINE);
+  plan_buffer_line(target, feed_rate, invert_feed_rate);
+  PROFILE_END(PROFILE_PLAN_BUFFER_LINE);
+  
+  // If idle, indicate to the system there is now a planned block in the buffer ready to cycle 
+  // start. Otherwise ignore and continue on.
+  if (!sys.state) { sys.state = STATE_QUEUED; }
+  
+  // Auto-cycle start immediately after planner finishes. Enabled/disabled by grbl settings. During 
+  // a feed hold, auto-start is disabled momentarily until the cycle is resumed by the cycle-start 
+  // runtime command.
+  // NOTE: This is allows the user to decide to exclusively use the cycle start runtime command to
+  // begin motion or let grbl auto-start it for them. This is useful when: manually cycle-starting
+  // when the buffer is completely full and primed; auto-starting, if there was only one g-code 
+  // command sent during manual operation; or if a system is prone to buffer starvation, auto-start
+  // helps make sure it minimizes any dwelling/motion hiccups and keeps the cycle going. 
+  if (sys.auto_start) { st_cycle_start(); }
+}
+
+#ifdef LINE_QUEUE_SIZE
+// Line queue of parsed line motions waiting for room in the planner buffer. When the planner is full,
+// the motions of the next few program lines are kept here, so the main program reads and parses 
+// ahead of the planner rather than blocking on it, and each freed planner block is refilled at once
+// from a line that is ready. Kept in program order with everything else queued into the planner, 
+// since any sync point first empties it. See mc_line_continue() and mc_line_synchronize().
+typedef struct {
+  coord_t target[N_AXIS];
+  float feed_rate;
+  uint8_t invert_feed_rate;
+} line_queue_t;
+static line_queue_t line_queue[LINE_QUEUE_SIZE];
+static uint8_t line_queue_head;  // Index of the next line motion to be pushed
+static uint8_t line_queue_tail;  // Index of the next line motion to be planned
+
+// Returns the index of the next line motion in the ring buffer.
+static uint8_t next_line_queue_index(uint8_t index)
+{
+  index++;
+  if (index == LINE_QUEUE_SIZE) { index = 0; }
+  return(index);
+}
+
+// Plans the line motions in the line queue, while the planner buffer has room, and starts the cycle.
+// Does not wait.
+static void mc_plan_line_queue()
+{
+  while ((line_queue_tail != line_queue_head) && !plan_check_full_buffer()) {
+    line_queue_t *line = &line_queue[line_queue_tail];
+    mc_plan_line(line->target, line->feed_rate, line->invert_feed_rate);
+    line_queue_tail = next_line_queue_index(line_queue_tail);
+  }
+}
+
+// Queues a linear motion to be planned, waiting only if the line queue is full, and plans it right
+// away, if the planner buffer has room.
+static void mc_queue_line(coord_t *target, float feed_rate, uint8_t invert_feed_rate)
+{
+  // If the buffers are full: good! That means we are well ahead of the robot. 
+  // Remain in this loop until there is room in the line queue.
+  uint8_t next_head = next_line_queue_index(line_queue_head);
+  while (next_head == line_queue_tail) {
+    protocol_execute_runtime(); // Check for any run-time commands
+    if (sys.abort) { return; } // Bail, if system abort.
+    mc_plan_line_queue();
+  }
+  line_queue_t *line = &line_queue[line_queue_head];
+  memcpy(line->target, target, sizeof(line->target));
+  line->feed_rate = feed_rate;
+  line->invert_feed_rate = invert_feed_rate;
+  line_queue_head = next_head;
+  mc_plan_line_queue();
+}
+#else
+// Queues a linear motion into the planner, waiting for room in the buffer, and starts the cycle.
+static void mc_queue_line(coord_t *target, float feed_rate, uint8_t invert_feed_rate)
+{
+  // If the buffer is full: good! That means we are well ahead of the robot. 
+  // Remain in this loop until there is room in the buffer.
+  do {
+    protocol_execute_runtime(); // Check for any run-time commands
+    if (sys.abort) { return; } // Bail, if system abort.
+  } while ( plan_check_full_buffer() );
+  mc_plan_line(target, feed_rate, invert_feed_rate);
+}
+#endif
+
+#ifdef LINE_MERGE_TOLERANCE
+// Merges the line motion to the target into the pending line, if it fits. Returns true, if merged.
+static uint8_t mc_merge_line(coord_t *target)
+{
+  float travel = 0.0;
+  float distance_sq = 0.0;
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) { 
+    float delta = coord_to_mm(target[idx]-merge.start[idx]);
+    travel += delta*merge.unit_vec[idx];
+    distance_sq += delta*delta;
+  }
+  if (travel <= merge.travel) { return(false); } // Turns back or stalls along the band.
+  if (distance_sq-travel*travel > 0.25*LINE_MERGE_TOLERANCE*LINE_MERGE_TOLERANCE) { return(false); }
+  memcpy(merge.target, target, sizeof(merge.target));
+  merge.travel = travel;
+  return(true);
+}
+#endif
+
+// Execute linear motion in absolute machine coordinates of the parser coordinate type, i.e. 
+// millimeters or fixed point. See coord_t. Feed rate given in millimeters/second
 // unless invert_feed_rate is true. Then the feed_rate means that the motion should be completed in
-// (1 minute)/feed_rate time.
+// (1 minute)/feed_rate time. A negative feed rate indicates a seek motion.
 // NOTE: This is the primary gateway to the grbl planner. All line motions, including arc line 
 // segments, must pass through this routine before being passed to the planner. The seperation of
 // mc_line and plan_buffer_line is done primarily to make backlash compensation integration simple
-// and direct.
+// and direct. It also merges runs of nearly collinear motions into one planner block, if enabled by
+// LINE_MERGE_TOLERANCE in config.h.
 // TODO: Check for a better way to avoid having to push the arguments twice for non-backlash cases.
 // However, this keeps the memory requirements lower since it doesn't have to call and hold two 
 // plan_buffer_lines in memory. Grbl only has to retain the original line input variables during a
 // backlash segment(s).
-void mc_line(float x, float y, float z, float feed_rate, uint8_t invert_feed_rate)
+void mc_line(coord_t *target, float feed_rate, uint8_t invert_feed_rate)
 {
-  // TODO: Perform soft limit check here. Just check if the target x,y,z values are outside the 
+  // TODO: Perform soft limit check here. Just check if the target values are outside the 
   // work envelope. Should be straightforward and efficient. By placing it here, rather than in 
   // the g-code parser, it directly picks up motions from everywhere in Grbl.
 
   // If in check gcode mode, prevent motion by blocking planner.
   if (sys.state == STATE_CHECK_MODE) { return; }
+
+  #ifdef LINE_MERGE_TOLERANCE
+    // Merge the motion into the pending line, if it continues it. Otherwise, queue the pending line
+    // and start a new one from its end. Inverse time motions are never merged, since their feed rate
+    // is the duration of each motion. Homing motions are queued right away.
+    if (merge.pending) {
+      if (!invert_feed_rate && (feed_rate == merge.feed_rate) && mc_merge_line(target)) { return; }
+      mc_line_synchronize();
+      if (sys.abort) { return; }
+    }
+    if (!invert_feed_rate && merge.start_valid && (sys.state != STATE_HOMING)) {
+      float length = 0.0;
+      uint8_t idx;
+      for (idx=0; idx<N_AXIS; idx++) { 
+        merge.unit_vec[idx] = coord_to_mm(target[idx]-merge.start[idx]); 
+        length += merge.unit_vec[idx]*merge.unit_vec[idx];
+      }
+      if (length == 0.0) { return; } // Zero-length motion. Nothing to do.
+      length = sqrt(length);
+      for (idx=0; idx<N_AXIS; idx++) { merge.unit_vec[idx] /= length; }
+      memcpy(merge.target, target, sizeof(merge.target));
+      merge.feed_rate = feed_rate;
+      merge.travel = length;
+      merge.pending = true;
+      return;
+    }
+    memcpy(merge.start, target, sizeof(merge.start));
+    merge.start_valid = true;
+  #endif
     
   // TODO: Backlash compensation may be installed here. Only need direction info to track when
   // to insert a backlash line motion(s) before the intended line motion. Requires its own
@@ -73,27 +233,149 @@ void mc_line(float x, float y, float z, float feed_rate, uint8_t invert_feed_rat
   // i.e. keep the planner independent and do the computations in the status reporting, or let
   // the planner handle the position corrections. The latter may get complicated.
 
-  // If the buffer is full: good! That means we are well ahead of the robot. 
-  // Remain in this loop until there is room in the buffer.
+  mc_queue_line(target, feed_rate, invert_feed_rate);
+}
+
+
+// Plans the queued line motions, as planner buffer space frees up, and the pending merged line, if 
+// the planner is running low on blocks. Does not wait. Called by the main program, while it reads
+// serial data, so a queued or merged line is never held back from a starving or idle machine.
+void mc_line_continue()
+{
+  #ifdef LINE_QUEUE_SIZE
+    mc_plan_line_queue();
+  #endif
+  #ifdef LINE_MERGE_TOLERANCE
+    if (merge.pending && (plan_get_block_buffer_count() < 2)) { 
+      merge.pending = false;
+      memcpy(merge.start, merge.target, sizeof(merge.start));
+      mc_queue_line(merge.target, merge.feed_rate, false);
+    }
+  #endif
+}
+
+
+// Plans the pending merged line and all queued line motions, waiting for room in the planner as 
+// needed. Must be called before executing anything, which is synchronized with the motion or goes
+// into the planner by itself.
+void mc_line_synchronize()
+{
+  #ifdef LINE_MERGE_TOLERANCE
+    if (merge.pending) {
+      merge.pending = false;
+      memcpy(merge.start, merge.target, sizeof(merge.start));
+      mc_queue_line(merge.target, merge.feed_rate, false);
+    }
+  #endif
+  #ifdef LINE_QUEUE_SIZE
+    while (line_queue_tail != line_queue_head) {
+      protocol_execute_runtime(); // Check for any run-time commands
+      if (sys.abort) { return; } // Bail, if system abort.
+      mc_plan_line_queue();
+    }
+  #endif
+}
+
+
+// Discards any queued line motions, the pending merged line and the known start of the next line.
+// Called upon any reset of the planner position, since the next line then starts from an unknown
+// position.
+void mc_line_reset()
+{
+  #ifdef LINE_QUEUE_SIZE
+    line_queue_tail = line_queue_head;
+  #endif
+  #ifdef LINE_MERGE_TOLERANCE
+    merge.pending = false;
+    merge.start_valid = false;
+  #endif
+}
+
+
+// Execute a jog motion. Jog motions are queued directly into the planner, which joins consecutive
+// jogs at their junction speeds, and start moving as soon as they are planned, regardless of auto
+// start. The jog state lasts until the last jog motion completes or the jog is cancelled by the
+// feed hold or jog cancel runtime commands, which decelerate to a stop and flush all jog motions.
+void mc_jog_line(coord_t *target, float feed_rate)
+{
+  // If in check gcode mode, prevent motion by blocking planner.
+  if (sys.state == STATE_CHECK_MODE) { return; }
+
+  // Wait for room in the buffer. Drop the jog, if the jog is cancelled in the meantime.
   do {
     protocol_execute_runtime(); // Check for any run-time commands
-    if (sys.abort) { return; } // Bail, if system abort.
+    if (sys.abort || sys.jog_cancel) { return; } // Bail, if system abort or jog cancel.
   } while ( plan_check_full_buffer() );
-  plan_buffer_line(x, y, z, feed_rate, invert_feed_rate);
-  
-  // If idle, indicate to the system there is now a planned block in the buffer ready to cycle 
-  // start. Otherwise ignore and continue on.
-  if (!sys.state) { sys.state = STATE_QUEUED; }
+  plan_buffer_line(target, feed_rate, false);
+  mc_line_reset(); // The next program line starts from wherever the jog ends.
   
-  // Auto-cycle start immediately after planner finishes. Enabled/disabled by grbl settings. During 
-  // a feed hold, auto-start is disabled momentarily until the cycle is resumed by the cycle-start 
-  // runtime command.
-  // NOTE: This is allows the user to decide to exclusively use the cycle start runtime command to
-  // begin motion or let grbl auto-start it for them. This is useful when: manually cycle-starting
-  // when the buffer is completely full and primed; auto-starting, if there was only one g-code 
-  // command sent during manual operation; or if a system is prone to buffer starvation, auto-start
-  // helps make sure it minimizes any dwelling/motion hiccups and keeps the cycle going. 
-  if (sys.auto_start) { st_cycle_start(); }
+  // Start jogging, if idle. Otherwise, the running jog continues into this motion.
+  if (sys.state == STATE_IDLE) {
+    sys.state = STATE_JOG;
+    st_prep_buffer();
+    st_wake_up();
+  }
+}
+
+// Arc generator state. An arc is set up by mc_arc() and its line segments are then queued into the
+// planner as space frees up, so the main program is free to read and parse the next line, while
+// the arc is being generated. See mc_arc_continue() and mc_arc_synchronize().
+typedef struct {
+  uint16_t segments;       // Number of line segments of the arc. Zero, if no arc is pending.
+  uint16_t segment_index;  // Index of the next segment to generate (1..segments)
+  int8_t count;            // Segments generated since the last arc correction
+  uint8_t axis_0, axis_1, axis_linear;
+  uint8_t invert_feed_rate;
+  float feed_rate;
+  float center_axis0, center_axis1;  // Circle center
+  float r_axis0, r_axis1;  // Radius vector from center to the last segment end
+  float offset_axis0, offset_axis1;  // Offset from the arc start to the center (=-initial radius vector)
+  float theta_per_segment;
+  float linear_per_segment[N_AXIS]; // Travel per segment of the axes not in the circle plane
+  float cos_T, sin_T;      // Vector rotation matrix values
+  float arc_target[N_AXIS]; // End of the last segment in mm
+  coord_t target[N_AXIS];
+} arc_t;
+static arc_t arc;
+
+
+// Queues the next line segment of the pending arc into the planner. Waits for room in the planner
+// buffer, if full, as any other line motion.
+static void mc_arc_segment()
+{
+  if (arc.segment_index < arc.segments) {
+    if (arc.count < settings.n_arc_correction) {
+      // Apply vector rotation matrix 
+      float r_axisi = arc.r_axis0*arc.sin_T + arc.r_axis1*arc.cos_T;
+      arc.r_axis0 = arc.r_axis0*arc.cos_T - arc.r_axis1*arc.sin_T;
+      arc.r_axis1 = r_axisi;
+      arc.count++;
+    } else {
+      // Arc correction to radius vector. Computed only every n_arc_correction increments.
+      // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
+      float cos_Ti = cos(arc.segment_index*arc.theta_per_segment);
+      float sin_Ti = sin(arc.segment_index*arc.theta_per_segment);
+      arc.r_axis0 = -arc.offset_axis0*cos_Ti + arc.offset_axis1*sin_Ti;
+      arc.r_axis1 = -arc.offset_axis0*sin_Ti - arc.offset_axis1*cos_Ti;
+      arc.count = 0;
+    }
+
+    // Update arc_target location. Axes outside the circle plane move linearly.
+    uint8_t idx;
+    for (idx=0; idx<N_AXIS; idx++) { arc.arc_target[idx] += arc.linear_per_segment[idx]; }
+    arc.arc_target[arc.axis_0] = arc.center_axis0 + arc.r_axis0;
+    arc.arc_target[arc.axis_1] = arc.center_axis1 + arc.r_axis1;
+    arc.segment_index++;
+    coord_t segment_target[N_AXIS];
+    for (idx=0; idx<N_AXIS; idx++) { segment_target[idx] = mm_to_coord(arc.arc_target[idx]); }
+    mc_line(segment_target, arc.feed_rate, arc.invert_feed_rate);
+  } else {
+    // Ensure last segment arrives at target location.
+    arc.segments = 0; 
+    mc_line(arc.target, arc.feed_rate, arc.invert_feed_rate);
+  }
+  // Drop the rest of the arc on system abort. Runtime command check already performed by mc_line.
+  if (sys.abort) { arc.segments = 0; }
 }
 
 
@@ -102,17 +384,28 @@ void mc_line(float x, float y, float z, float feed_rate, uint8_t invert_feed_rat
 // the direction of helical travel, radius == circle radius, isclockwise boolean. Used
 // for vector transformation direction.
 // The arc is approximated by generating a huge number of tiny, linear segments. The length of each 
-// segment is configured in settings.mm_per_arc_segment.  
-void mc_arc(float *position, float *target, float *offset, uint8_t axis_0, uint8_t axis_1, 
+// segment is set by the maximum chord error from the true arc, settings.arc_tolerance, such that 
+// large radius arcs get long segments and small arcs keep a fine resolution. If the arc tolerance 
+// is zero, the length of each segment is configured in settings.mm_per_arc_segment.  
+// NOTE: Only sets up the arc and queues as many segments as the planner buffer has room for. The 
+// remaining segments are queued by mc_arc_continue() from the main program, and any following
+// motion or command must first call mc_arc_synchronize() to complete the arc.
+void mc_arc(coord_t *position, coord_t *target, float *offset, uint8_t axis_0, uint8_t axis_1, 
   uint8_t axis_linear, float feed_rate, uint8_t invert_feed_rate, float radius, uint8_t isclockwise)
 {      
-  float center_axis0 = position[axis_0] + offset[axis_0];
-  float center_axis1 = position[axis_1] + offset[axis_1];
-  float linear_travel = target[axis_linear] - position[axis_linear];
+  // If in check gcode mode, prevent motion by not generating the arc at all.
+  if (sys.state == STATE_CHECK_MODE) { return; }
+  mc_arc_synchronize(); // Complete any previous arc. Usually already done by the g-code parser.
+  if (sys.abort) { return; }
+
+  // The travel is taken from the coordinate differences, which are exact in fixed point.
+  float center_axis0 = coord_to_mm(position[axis_0]) + offset[axis_0];
+  float center_axis1 = coord_to_mm(position[axis_1]) + offset[axis_1];
+  float linear_travel = coord_to_mm(target[axis_linear] - position[axis_linear]);
   float r_axis0 = -offset[axis_0];  // Radius vector from center to current location
   float r_axis1 = -offset[axis_1];
-  float rt_axis0 = target[axis_0] - center_axis0;
-  float rt_axis1 = target[axis_1] - center_axis1;
+  float rt_axis0 = coord_to_mm(target[axis_0] - position[axis_0]) - offset[axis_0];
+  float rt_axis1 = coord_to_mm(target[axis_1] - position[axis_1]) - offset[axis_1];
   
   // CCW angle between position and target from circle center. Only one atan2() trig computation required.
   float angular_travel = atan2(r_axis0*rt_axis1-r_axis1*rt_axis0, r_axis0*rt_axis0+r_axis1*rt_axis1);
@@ -124,14 +417,26 @@ void mc_arc(float *position, float *target, float *offset, uint8_t axis_0, uint8
   
   float millimeters_of_travel = hypot(angular_travel*radius, fabs(linear_travel));
   if (millimeters_of_travel == 0.0) { return; }
-  uint16_t segments = floor(millimeters_of_travel/settings.mm_per_arc_segment);
+  uint16_t segments;
+  if (settings.arc_tolerance > 0.0) {
+    // Chord length with a sagitta of arc_tolerance, i.e. the maximum distance between the segment
+    // and the arc. Arcs with a radius within the tolerance are completed by a single segment.
+    if (radius > settings.arc_tolerance) {
+      float mm_per_arc_segment = 2*sqrt(settings.arc_tolerance*(2*radius-settings.arc_tolerance));
+      segments = floor(fabs(angular_travel)*radius/mm_per_arc_segment);
+    } else {
+      segments = 0;
+    }
+    if (segments == 0) { segments = 1; }
+  } else {
+    segments = floor(millimeters_of_travel/settings.mm_per_arc_segment);
+  }
   // Multiply inverse feed_rate to compensate for the fact that this movement is approximated
   // by a number of discrete segments. The inverse feed_rate should be correct for the sum of 
   // all segments.
   if (invert_feed_rate) { feed_rate *= segments; }
  
   float theta_per_segment = angular_travel/segments;
-  float linear_per_segment = linear_travel/segments;
   
   /* Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
      and phi is the angle of rotation. Solution approach by Jens Geisler.
@@ -158,64 +463,101 @@ void mc_arc(float *position, float *target, float *offset, uint8_t axis_0, uint8
      a correction, the planner should have caught up to the lag caused by the initial mc_arc overhead. 
      This is important when there are successive arc motions. 
   */
-  // Vector rotation matrix values
-  float cos_T = 1-0.5*theta_per_segment*theta_per_segment; // Small angle approximation
-  float sin_T = theta_per_segment;
-  
-  float arc_target[3];
-  float sin_Ti;
-  float cos_Ti;
-  float r_axisi;
-  uint16_t i;
-  int8_t count = 0;
+  // Vector rotation matrix values. Small angle approximation by a third order Taylor series, since
+  // the arc tolerance may produce segments spanning larger angles, where the first order sine 
+  // approximation would drift noticeably off the arc in between corrections.
+  float cos_T = 2.0 - theta_per_segment*theta_per_segment;
+  arc.sin_T = theta_per_segment*0.16666667*(cos_T + 4.0); // theta - theta^3/6
+  arc.cos_T = 0.5*cos_T; // 1 - theta^2/2
 
-  // Initialize the linear axis
-  arc_target[axis_linear] = position[axis_linear];
+  // Set up the arc generator state, starting from the arc start position.
+  arc.axis_0 = axis_0;
+  arc.axis_1 = axis_1;
+  arc.axis_linear = axis_linear;
+  arc.feed_rate = feed_rate;
+  arc.invert_feed_rate = invert_feed_rate;
+  arc.center_axis0 = center_axis0;
+  arc.center_axis1 = center_axis1;
+  arc.r_axis0 = r_axis0;
+  arc.r_axis1 = r_axis1;
+  arc.offset_axis0 = offset[axis_0];
+  arc.offset_axis1 = offset[axis_1];
+  arc.theta_per_segment = theta_per_segment;
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) { 
+    arc.linear_per_segment[idx] = coord_to_mm(target[idx] - position[idx])/segments; 
+    arc.arc_target[idx] = coord_to_mm(position[idx]); // Initialize the out-of-plane axes
+  }
+  arc.linear_per_segment[axis_0] = 0.0;
+  arc.linear_per_segment[axis_1] = 0.0;
+  memcpy(arc.target, target, sizeof(arc.target));
+  arc.count = 0;
+  arc.segment_index = 1; // Generates (segments-1) segments plus the final segment to the target.
+  arc.segments = segments;
 
-  for (i = 1; i<segments; i++) { // Increment (segments-1)
-    
-    if (count < settings.n_arc_correction) {
-      // Apply vector rotation matrix 
-      r_axisi = r_axis0*sin_T + r_axis1*cos_T;
-      r_axis0 = r_axis0*cos_T - r_axis1*sin_T;
-      r_axis1 = r_axisi;
-      count++;
-    } else {
-      // Arc correction to radius vector. Computed only every n_arc_correction increments.
-      // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-      cos_Ti = cos(i*theta_per_segment);
-      sin_Ti = sin(i*theta_per_segment);
-      r_axis0 = -offset[axis_0]*cos_Ti + offset[axis_1]*sin_Ti;
-      r_axis1 = -offset[axis_0]*sin_Ti - offset[axis_1]*cos_Ti;
-      count = 0;
-    }
+  mc_arc_continue();
+}
 
-    // Update arc_target location
-    arc_target[axis_0] = center_axis0 + r_axis0;
-    arc_target[axis_1] = center_axis1 + r_axis1;
-    arc_target[axis_linear] += linear_per_segment;
-    mc_line(arc_target[X_AXIS], arc_target[Y_AXIS], arc_target[Z_AXIS], feed_rate, invert_feed_rate);
-    
-    // Bail mid-circle on system abort. Runtime command check already performed by mc_line.
-    if (sys.abort) { return; }
+
+// Queues the pending arc segments, while the planner buffer has room. Returns once the buffer is
+// full without waiting, so the main program may continue reading and parsing serial data.
+void mc_arc_continue()
+{
+  while (arc.segments && !plan_check_full_buffer()) { mc_arc_segment(); }
+}
+
+
+// Queues all remaining segments of the pending arc, waiting for planner buffer space as needed. 
+// Must be called before executing anything following an arc to retain the program order.
+void mc_arc_synchronize()
+{
+  while (arc.segments) { mc_arc_segment(); }
+}
+
+
+// Clears any pending arc. Called upon a system reset.
+void mc_init()
+{
+  arc.segments = 0;
+  mc_line_reset();
+}
+
+
+// Queues a synchronized spindle, coolant or dwell event into the planner, executed once the motion
+// buffered before it is complete. This replaces waiting for the planner buffer to drain, so the 
+// motion plan continues across spindle and coolant changes. If nothing is moving or queued, spindle
+// and coolant events are executed right away. Otherwise, the event is queued like mc_line() does.
+void mc_sync_event(uint8_t event, float value)
+{
+  // If in check gcode mode, prevent any output by blocking planner.
+  if (sys.state == STATE_CHECK_MODE) { return; }
+  mc_line_synchronize(); // Queue any pending merged line first.
+  if (sys.abort) { return; }
+
+  if ((event != PLAN_EVENT_DWELL) && (plan_get_current_block() == NULL) && (sys.state != STATE_CYCLE) &&
+      (sys.state != STATE_HOLD) && (sys.state != STATE_JOG)) {
+    st_execute_sync_event(event, value);
+    return;
   }
-  // Ensure last segment arrives at target location.
-  mc_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], feed_rate, invert_feed_rate);
+
+  // Remain in this loop until there is room in the buffer.
+  while ( plan_check_full_buffer() ) {
+    protocol_execute_runtime(); // Check for any run-time commands
+    if (sys.abort) { return; } // Bail, if system abort.
+  }
+  plan_buffer_sync_event(event, value);
+  
+  if (!sys.state) { sys.state = STATE_QUEUED; }
+  if (sys.auto_start) { st_cycle_start(); } // Auto-cycle start, as for mc_line().
 }
 
 
-// Execute dwell in seconds.
+// Dwell for a specific number of seconds. The dwell is queued as a planner event, which the motion 
+// before it decelerates to a stop for. Runtime commands are executed as usual during the dwell, and
+// a feed hold pauses it.
 void mc_dwell(float seconds) 
 {
-   uint16_t i = floor(1000/DWELL_TIME_STEP*seconds);
-   plan_synchronize();
-   delay_ms(floor(1000*seconds-i*DWELL_TIME_STEP)); // Delay millisecond remainder
-   while (i-- > 0) {
-     // NOTE: Check and execute runtime commands during dwell every <= DWELL_TIME_STEP milliseconds.
-     protocol_execute_runtime();
-     if (sys.abort) { return; }
-     _delay_ms(DWELL_TIME_STEP); // Delay DWELL_TIME_STEP increment
-   }
+  mc_sync_event(PLAN_EVENT_DWELL, seconds);
 }
 
 
@@ -225,9 +567,8 @@ void mc_dwell(float seconds)
 void mc_go_home()
 {
   sys.state = STATE_HOMING; // Set system state variable
-  LIMIT_PCMSK &= ~LIMIT_MASK; // Disable hard limits pin change register for cycle duration
   
-  limits_go_home(); // Perform homing routine.
+  limits_go_home(); // Perform homing routine. Leaves the hard limits pin change register disabled.
 
   protocol_execute_runtime(); // Check for reset and set system abort.
   if (sys.abort) { return; } // Did not complete. Alarm state set by mc_alarm.
@@ -241,22 +582,16 @@ void mc_go_home()
   // Pull-off axes (that have been homed) from limit switches before continuing motion. 
   // This provides some initial clearance off the switches and should also help prevent them 
   // from falsely tripping when hard limits are enabled.
-  int8_t x_dir, y_dir, z_dir;
-  x_dir = y_dir = z_dir = 0;
-  if (HOMING_LOCATE_CYCLE & (1<<X_AXIS)) { 
-    if (settings.homing_dir_mask & (1<<X_DIRECTION_BIT)) { x_dir = 1; }
-    else { x_dir = -1; }
-  }
-  if (HOMING_LOCATE_CYCLE & (1<<Y_AXIS)) { 
-    if (settings.homing_dir_mask & (1<<Y_DIRECTION_BIT)) { y_dir = 1; }
-    else { y_dir = -1; }
-  }
-  if (HOMING_LOCATE_CYCLE & (1<<Z_AXIS)) { 
-    if (settings.homing_dir_mask & (1<<Z_DIRECTION_BIT)) { z_dir = 1; }
-    else { z_dir = -1; }
-  }
-  mc_line(x_dir*settings.homing_pulloff, y_dir*settings.homing_pulloff, 
-          z_dir*settings.homing_pulloff, settings.homing_seek_rate, false);
+  coord_t pulloff[N_AXIS];
+  #define PULLOFF_AXIS(idx) \
+    pulloff[idx] = 0; \
+    if (HOMING_LOCATE_CYCLE & (1<<idx)) { \
+      if (settings.homing_dir_mask & (1<<DIRECTION_BIT_##idx)) { pulloff[idx] = mm_to_coord(settings.homing_pulloff); } \
+      else { pulloff[idx] = -mm_to_coord(settings.homing_pulloff); } \
+    }
+  FOR_EACH_AXIS(PULLOFF_AXIS)
+  #undef PULLOFF_AXIS
+  mc_line(pulloff, settings.homing_seek_rate, false);
   st_cycle_start(); // Move it. Nothing should be in the buffer except this motion. 
   plan_synchronize(); // Make sure the motion completes.
   
@@ -264,7 +599,7 @@ void mc_go_home()
   sys_sync_current_position();
 
   // If hard limits feature enabled, re-enable hard limits pin change register after homing cycle.
-  if (bit_istrue(settings.flags,BITFLAG_HARD_LIMIT_ENABLE)) { LIMIT_PCMSK |= LIMIT_MASK; }
+  if (bit_istrue(settings.flags,BITFLAG_HARD_LIMIT_ENABLE)) { hal_limit_interrupt_enable(); }
   // Finished! 
 }
 
@@ -289,7 +624,7 @@ void mc_reset()
     // the steppers enabled by avoiding the go_idle call altogether, unless the motion state is
     // violated, by which, all bets are off.
     switch (sys.state) {
-      case STATE_CYCLE: case STATE_HOLD: case STATE_HOMING: // case STATE_JOG:
+      case STATE_CYCLE: case STATE_HOLD: case STATE_HOMING: case STATE_JOG:
         sys.execute |= EXEC_ALARM; // Execute alarm state.
         st_go_idle(); // Execute alarm force kills steppers. Position likely lost.
     }
@@ -33,18 +33,47 @@
 #include <avr/io.h>
 #include "planner.h"
 
-// Execute linear motion in absolute millimeter coordinates. Feed rate given in millimeters/second
+// Execute linear motion in absolute machine coordinates of the parser coordinate type, i.e. 
+// millimeters or fixed point. See coord_t. Feed rate given in millimeters/second
 // unless invert_feed_rate is true. Then the feed_rate means that the motion should be completed in
-// (1 minute)/feed_rate time.
-void mc_line(float x, float y, float z, float feed_rate, uint8_t invert_feed_rate);
+// (1 minute)/feed_rate time. A negative feed rate indicates a seek motion at the default seek rate,
+// which is scaled by the rapid override rather than the feed override.
+void mc_line(coord_t *target, float feed_rate, uint8_t invert_feed_rate);
 
-// Execute an arc in offset mode format. position == current xyz, target == target xyz, 
-// offset == offset from current xyz, axis_XXX defines circle plane in tool space, axis_linear is
-// the direction of helical travel, radius == circle radius, isclockwise boolean. Used
+// Plan the queued line motions, while the planner has room, and the pending merged line, if the
+// planner is running low on blocks. Called by the main program, while it reads serial data.
+void mc_line_continue();
+
+// Plan the pending merged line and all queued line motions, waiting for room as needed.
+void mc_line_synchronize();
+
+// Discard the queued and pending merged line motions upon a reset of the planner position.
+void mc_line_reset();
+
+// Execute a jog motion to the absolute target, as for mc_line(), at the feed rate in mm/min. Goes
+// directly to the planner and starts the jog immediately, if idle.
+void mc_jog_line(coord_t *target, float feed_rate);
+
+// Execute an arc in offset mode format. position == current xyz, target == target xyz, both as for
+// mc_line(), offset == offset from current xyz in mm, axis_XXX defines circle plane in tool space,
+// axis_linear is the direction of helical travel, radius == circle radius, isclockwise boolean. Used
 // for vector transformation direction.
-void mc_arc(float *position, float *target, float *offset, uint8_t axis_0, uint8_t axis_1,
+void mc_arc(coord_t *position, coord_t *target, float *offset, uint8_t axis_0, uint8_t axis_1,
   uint8_t axis_linear, float feed_rate, uint8_t invert_feed_rate, float radius, uint8_t isclockwise);
+
+// Queues pending arc segments into the planner, while there is room. Does not wait. Called by the
+// main program to continue generating an arc, while it processes incoming serial data.
+void mc_arc_continue();
+
+// Queues all remaining segments of a pending arc, waiting for room in the planner as needed. 
+void mc_arc_synchronize();
+
+// Clears the arc generator state upon a system reset
+void mc_init();
   
+// Queue a synchronized spindle, coolant or dwell planner event, in turn with the buffered motion.
+void mc_sync_event(uint8_t event, float value);
+
 // Dwell for a specific number of seconds
 void mc_dwell(float seconds);
 
@@ -29,19 +29,22 @@
 
 #include <util/delay.h>
 #include "nuts_bolts.h"
+#include "hal.h"
 #include "gcode.h"
 #include "planner.h"
+#include "motion_control.h"
 
 #define MAX_INT_DIGITS 8 // Maximum number of digits in int32 (and float)
 
-// Extracts a floating point value from a string. The following code is based loosely on
-// the avr-libc strtod() function by Michael Stumpf and Dmitry Xmelkov and many freely
-// available conversion method examples, but has been highly optimized for Grbl. For known
-// CNC applications, the typical decimal value is expected to be in the range of E0 to E-4.
-// Scientific notation is officially not supported by g-code, and the 'E' character may
-// be a g-code word on some CNC systems. So, 'E' notation will not be recognized. 
+// Extracts the digits of a decimal value from a string into an integer and a decimal exponent, 
+// with the sign. The following code is based loosely on the avr-libc strtod() function by Michael
+// Stumpf and Dmitry Xmelkov and many freely available conversion method examples, but has been 
+// highly optimized for Grbl. Scientific notation is officially not supported by g-code, and the 'E'
+// character may be a g-code word on some CNC systems. So, 'E' notation will not be recognized. 
+// Digits beyond MAX_INT_DIGITS are dropped. Returns false, if there are no digits.
 // NOTE: Thanks to Radu-Eosif Mihailescu for identifying the issues with using strtod().
-int read_float(char *line, uint8_t *char_counter, float *float_ptr)                  
+static int read_decimal(char *line, uint8_t *char_counter, uint32_t *intval_ptr, int8_t *exp_ptr, 
+                        bool *isnegative_ptr)
 {
   char *ptr = line + *char_counter;
   unsigned char c;
@@ -84,6 +87,23 @@ int read_float(char *line, uint8_t *char_counter, float *float_ptr)
   // Return if no digits have been read.
   if (!ndigit) { return(false); };
   
+  *intval_ptr = intval;
+  *exp_ptr = exp;
+  *isnegative_ptr = isnegative;
+  *char_counter = ptr - line - 1; // Set char_counter to next statement
+  return(true);
+}
+
+
+// Extracts a floating point value from a string. For known CNC applications, the typical decimal
+// value is expected to be in the range of E0 to E-4. See read_decimal().
+int read_float(char *line, uint8_t *char_counter, float *float_ptr)                  
+{
+  uint32_t intval;
+  int8_t exp;
+  bool isnegative;
+  if (!read_decimal(line, char_counter, &intval, &exp, &isnegative)) { return(false); }
+  
   // Convert integer into floating point.
   float fval;
   fval = (float)intval;
@@ -110,11 +130,49 @@ int read_float(char *line, uint8_t *char_counter, float *float_ptr)
   } else {
     *float_ptr = fval;
   }
+  
+  return(true);
+}
 
-  *char_counter = ptr - line - 1; // Set char_counter to next statement
+
+#ifdef FIXED_POINT_COORDINATES
+// Extracts a decimal value from a string as a fixed-point integer with the given number of decimal 
+// places, without any floating point operations. Any further decimal places are rounded to nearest.
+// Returns false, if the value does not fit an int32. See read_decimal().
+int read_fixed(char *line, uint8_t *char_counter, int32_t *fixed_ptr, uint8_t decimals)
+{
+  uint32_t intval;
+  int8_t exp;
+  bool isnegative;
+  if (!read_decimal(line, char_counter, &intval, &exp, &isnegative)) { return(false); }
+  
+  // Shift the decimal point to the fixed-point decimal places.
+  exp += decimals;
+  if (exp < 0) {
+    while (exp < -1) { 
+      intval /= 10; 
+      exp++; 
+    }
+    intval = (intval+5)/10; // Round the last dropped digit
+  } else {
+    while (exp > 0) {
+      if (intval > INT32_MAX/10) { return(false); }
+      intval = (((intval << 2) + intval) << 1); // intval*10
+      exp--;
+    }
+  }
+  if (intval > INT32_MAX) { return(false); }
+
+  // Assign fixed-point value with correct sign.    
+  if (isnegative) {
+    *fixed_ptr = -(int32_t)intval;
+  } else {
+    *fixed_ptr = intval;
+  }
   
   return(true);
 }
+#endif
 
 
 // Delays variable defined milliseconds. Compiler compatibility fix for _delay_ms(),
@@ -147,9 +205,38 @@ void delay_us(uint32_t us)
   }
 }
 
+// Timebase overflow count, which extends the 8-bit timebase timer to the 32-bit system time.
+static volatile uint32_t timebase_overflows;
+
+ISR(HAL_TIMEBASE_vect)
+{
+  timebase_overflows++;
+}
+
+void sys_timebase_init()
+{
+  hal_timebase_init();
+}
+
+// Reads the system time. The time wraps after 2^32 ticks, or 76 hours at 16MHz. Interrupts are
+// briefly disabled to read the timer and its overflows together, then restored to their prior state,
+// so the time is safe to read with interrupts already disabled.
+uint32_t sys_get_time()
+{
+  uint8_t sreg = SREG;
+  cli();
+  uint32_t overflows = timebase_overflows;
+  uint8_t count = hal_timebase_count();
+  // An overflow not yet counted by its interrupt came before the count, if the count is low.
+  if (hal_timebase_overflow_pending() && (count < 0x80)) { overflows++; }
+  SREG = sreg;
+  return((overflows << 8) | count);
+}
+
 // Syncs all internal position vectors to the current system position.
 void sys_sync_current_position()
 {
-  plan_set_current_position(sys.position[X_AXIS],sys.position[Y_AXIS],sys.position[Z_AXIS]);
-  gc_set_current_position(sys.position[X_AXIS],sys.position[Y_AXIS],sys.position[Z_AXIS]);
+  plan_set_current_position(sys.position);
+  gc_set_current_position(sys.position);
+  mc_line_reset();
 }
@@ -40,10 +40,39 @@
 #define false 0
 #define true 1
 
-#define N_AXIS 3 // Number of axes
-#define X_AXIS 0 // Axis indexing value
+#define X_AXIS 0 // Axis indexing value. Number of axes N_AXIS set in config.h.
 #define Y_AXIS 1
 #define Z_AXIS 2
+#define A_AXIS 3
+#define B_AXIS 4
+
+// Expands the per-axis macro M(idx) once for each axis index at compile time. The motion core uses
+// this in place of loops over the axes, so its per-axis code compiles with constant array offsets and
+// pin bits, exactly as separately hand-written code for each axis would.
+#if N_AXIS == 3
+  #define FOR_EACH_AXIS(M) M(0) M(1) M(2)
+#elif N_AXIS == 4
+  #define FOR_EACH_AXIS(M) M(0) M(1) M(2) M(3)
+#elif N_AXIS == 5
+  #define FOR_EACH_AXIS(M) M(0) M(1) M(2) M(3) M(4)
+#else
+  #error "N_AXIS must be 3, 4, or 5."
+#endif
+
+// Coordinate type of the parser axis words, positions, and offsets, and of the line motion targets
+// down to the planner. With FIXED_POINT_COORDINATES, these are integers of 1/COORD_PER_MM 
+// millimeters, i.e. COORD_DECIMALS decimal places, which the planner converts to steps directly.
+#ifdef FIXED_POINT_COORDINATES
+  #define COORD_DECIMALS 5
+  #define COORD_PER_MM 100000 // 10^COORD_DECIMALS
+  typedef int32_t coord_t;
+  #define coord_to_mm(coord) ((coord)*(1.0/COORD_PER_MM))
+  #define mm_to_coord(mm) lround((mm)*COORD_PER_MM)
+#else
+  typedef float coord_t;
+  #define coord_to_mm(coord) (coord)
+  #define mm_to_coord(mm) (mm)
+#endif
 
 #define MM_PER_INCH (25.40)
 #define INCH_PER_MM (0.0393701)
@@ -62,6 +91,21 @@
 #define bit_istrue(x,mask) ((x & mask) != 0)
 #define bit_isfalse(x,mask) ((x & mask) == 0)
 
+// Profiling hooks for the host benchmark harness in bench/, built by 'make host-bench'. These
+// mark the start and end of the measured code sections and compile to nothing in the firmware.
+#define PROFILE_PLAN_BUFFER_LINE     0
+#define PROFILE_PLANNER_RECALCULATE  1
+#define N_PROFILE                    2
+#ifdef HOST_BENCH
+  void bench_profile_begin(uint8_t id);
+  void bench_profile_end(uint8_t id);
+  #define PROFILE_BEGIN(id) bench_profile_begin(id)
+  #define PROFILE_END(id) bench_profile_end(id)
+#else
+  #define PROFILE_BEGIN(id)
+  #define PROFILE_END(id)
+#endif
+
 // Define system executor bit map. Used internally by runtime protocol as runtime command flags, 
 // which notifies the main program to execute the specified runtime command asynchronously.
 // NOTE: The system executor uses an unsigned 8-bit volatile variable (8 flag limit.) The default
@@ -74,7 +118,19 @@
 #define EXEC_RESET          bit(4) // bitmask 00010000
 #define EXEC_ALARM          bit(5) // bitmask 00100000
 #define EXEC_CRIT_EVENT     bit(6) // bitmask 01000000
-// #define                  bit(7) // bitmask 10000000
+#define EXEC_JOG_CANCEL     bit(7) // bitmask 10000000
+
+// Define system override bit map. Set by the serial interrupt upon an override command character 
+// and executed by the runtime protocol, which updates the override values and replans the buffer.
+// NOTE: Kept separate from the system executor, since it only has one flag left.
+#define EXEC_FEED_OVR_RESET         bit(0)
+#define EXEC_FEED_OVR_COARSE_PLUS   bit(1)
+#define EXEC_FEED_OVR_COARSE_MINUS  bit(2)
+#define EXEC_FEED_OVR_FINE_PLUS     bit(3)
+#define EXEC_FEED_OVR_FINE_MINUS    bit(4)
+#define EXEC_RAPID_OVR_RESET        bit(5)
+#define EXEC_RAPID_OVR_MEDIUM       bit(6)
+#define EXEC_RAPID_OVR_LOW          bit(7)
 
 // Define system state bit map. The state variable primarily tracks the individual functions
 // of Grbl to manage each without overlapping. It is also used as a messaging flag for
@@ -87,7 +143,8 @@
 #define STATE_HOMING     5 // Performing homing cycle
 #define STATE_ALARM      6 // In alarm state. Locks out all g-code processes. Allows settings access.
 #define STATE_CHECK_MODE 7 // G-code check mode. Locks out planner and motion only.
-// #define STATE_JOG     8 // Jogging mode is unique like homing.
+#define STATE_JOG        8 // Jogging mode. Motions go directly to the planner and may be cancelled.
+#define STATE_ESTIMATE   9 // Cycle time estimate mode. Motions are planned and timed, but not executed.
 
 // Define global system variables
 typedef struct {
@@ -97,6 +154,11 @@ typedef struct {
   int32_t position[N_AXIS];      // Real-time machine (aka home) position vector in steps. 
                                  // NOTE: This may need to be a volatile variable, if problems arise.   
   uint8_t auto_start;            // Planner auto-start flag. Toggled off during feed hold. Defaulted by settings.
+  uint8_t jog_cancel;            // Flags a jog cancel deceleration, after which the jog motions are flushed.
+  volatile uint8_t homing_axis_lock; // Axes stopped by their limit switch during a homing motion. Set by the limit ISR.
+  volatile uint8_t override;     // Realtime override command bitflag variable. See EXEC_OVR bitmasks.
+  uint8_t feed_override;         // Feed rate override value in percent. Applies to feed motions.
+  uint8_t rapid_override;        // Rapid override value in percent. Applies to seek motions.
 } system_t;
 extern system_t sys;
 
@@ -105,6 +167,12 @@ extern system_t sys;
 // a pointer to the result variable. Returns true when it succeeds
 int read_float(char *line, uint8_t *char_counter, float *float_ptr);
 
+#ifdef FIXED_POINT_COORDINATES
+  // Read a decimal value from a string as a fixed-point integer with the given decimal places, like
+  // read_float(). Returns true when it succeeds and the value fits an int32.
+  int read_fixed(char *line, uint8_t *char_counter, int32_t *fixed_ptr, uint8_t decimals);
+#endif
+
 // Delays variable-defined milliseconds. Compiler compatibility fix for _delay_ms().
 void delay_ms(uint16_t ms);
 
@@ -114,4 +182,11 @@ void delay_us(uint32_t us);
 // Syncs Grbl's gcode and planner position variables with the system position.
 void sys_sync_current_position();
 
+// Starts the system timebase timer. Called once at power-up.
+void sys_timebase_init();
+
+// Returns the system time in ticks of the timebase timer, HAL_TIMEBASE_PER_SECOND per second. Only
+// differences of times are meaningful, since the time wraps.
+uint32_t sys_get_time();
+
 #endif
@@ -51,6 +51,9 @@
   #define STEP_MASK ((1<<X_STEP_BIT)|(1<<Y_STEP_BIT)|(1<<Z_STEP_BIT)) // All step bits
   #define DIRECTION_MASK ((1<<X_DIRECTION_BIT)|(1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT)) // All direction bits
   #define STEPPING_MASK (STEP_MASK | DIRECTION_MASK) // All stepping-related bits (step/direction)
+  #if N_AXIS > 3
+    #error "The Uno pin map has no free stepping port pins for more than 3 axes."
+  #endif
 
   #define STEPPERS_DISABLE_DDR    DDRB
   #define STEPPERS_DISABLE_PORT   PORTB
@@ -127,8 +130,18 @@
   #define X_DIRECTION_BIT   5 // MEGA2560 Digital Pin 27
   #define Y_DIRECTION_BIT   6 // MEGA2560 Digital Pin 28
   #define Z_DIRECTION_BIT   7 // MEGA2560 Digital Pin 29
-  #define STEP_MASK ((1<<X_STEP_BIT)|(1<<Y_STEP_BIT)|(1<<Z_STEP_BIT)) // All step bits
-  #define DIRECTION_MASK ((1<<X_DIRECTION_BIT)|(1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT)) // All direction bits
+  #if N_AXIS > 3
+    #define A_STEP_BIT        0 // MEGA2560 Digital Pin 22
+    #define A_DIRECTION_BIT   1 // MEGA2560 Digital Pin 23
+    #define STEP_MASK ((1<<X_STEP_BIT)|(1<<Y_STEP_BIT)|(1<<Z_STEP_BIT)|(1<<A_STEP_BIT))
+    #define DIRECTION_MASK ((1<<X_DIRECTION_BIT)|(1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT)|(1<<A_DIRECTION_BIT))
+  #else
+    #define STEP_MASK ((1<<X_STEP_BIT)|(1<<Y_STEP_BIT)|(1<<Z_STEP_BIT)) // All step bits
+    #define DIRECTION_MASK ((1<<X_DIRECTION_BIT)|(1<<Y_DIRECTION_BIT)|(1<<Z_DIRECTION_BIT)) // All direction bits
+  #endif
+  #if N_AXIS > 4
+    #error "The Mega 2560 pin map has no free stepping port pins for more than 4 axes."
+  #endif
   #define STEPPING_MASK (STEP_MASK | DIRECTION_MASK) // All stepping-related bits (step/direction)
 
   #define STEPPERS_DISABLE_DDR   DDRB
@@ -146,7 +159,12 @@
   #define LIMIT_INT       PCIE0  // Pin change interrupt enable pin
   #define LIMIT_INT_vect  PCINT0_vect 
   #define LIMIT_PCMSK     PCMSK0 // Pin change interrupt register
-  #define LIMIT_MASK ((1<<X_LIMIT_BIT)|(1<<Y_LIMIT_BIT)|(1<<Z_LIMIT_BIT)) // All limit bits
+  #if N_AXIS > 3
+    #define A_LIMIT_BIT     0 // MEGA2560 Digital Pin 53
+    #define LIMIT_MASK ((1<<X_LIMIT_BIT)|(1<<Y_LIMIT_BIT)|(1<<Z_LIMIT_BIT)|(1<<A_LIMIT_BIT))
+  #else
+    #define LIMIT_MASK ((1<<X_LIMIT_BIT)|(1<<Y_LIMIT_BIT)|(1<<Z_LIMIT_BIT)) // All limit bits
+  #endif
 
   #define SPINDLE_ENABLE_DDR   DDRC
   #define SPINDLE_ENABLE_PORT  PORTC
@@ -181,6 +199,23 @@
 
 #endif
 
+// Step, direction, and limit pin bits by axis index, for the per-axis macros of the motion core.
+#define STEP_BIT_0 X_STEP_BIT
+#define STEP_BIT_1 Y_STEP_BIT
+#define STEP_BIT_2 Z_STEP_BIT
+#define STEP_BIT_3 A_STEP_BIT
+#define STEP_BIT_4 B_STEP_BIT
+#define DIRECTION_BIT_0 X_DIRECTION_BIT
+#define DIRECTION_BIT_1 Y_DIRECTION_BIT
+#define DIRECTION_BIT_2 Z_DIRECTION_BIT
+#define DIRECTION_BIT_3 A_DIRECTION_BIT
+#define DIRECTION_BIT_4 B_DIRECTION_BIT
+#define LIMIT_BIT_0 X_LIMIT_BIT
+#define LIMIT_BIT_1 Y_LIMIT_BIT
+#define LIMIT_BIT_2 Z_LIMIT_BIT
+#define LIMIT_BIT_3 A_LIMIT_BIT
+#define LIMIT_BIT_4 B_LIMIT_BIT
+
 /* 
 #ifdef PIN_MAP_CUSTOM_PROC
   // For a custom pin map or different processor, copy and paste one of the default pin map
@@ -30,6 +30,7 @@
 
 #include <inttypes.h>    
 #include <stdlib.h>
+#include <avr/io.h>
 #include "planner.h"
 #include "nuts_bolts.h"
 #include "stepper.h"
@@ -41,17 +42,36 @@ static block_t block_buffer[BLOCK_BUFFER_SIZE];  // A ring buffer for motion ins
 static volatile uint8_t block_buffer_head;       // Index of the next block to be pushed
 static volatile uint8_t block_buffer_tail;       // Index of the block to process now
 static uint8_t next_buffer_head;                 // Index of the next buffer head
+static uint8_t block_buffer_planned;             // Index of the optimally planned block. Blocks from the tail
+                                                 // up to here are fully planned and never replanned.
+
+#define SOME_LARGE_VALUE 1.0E+38 // Junction speed limit of straight junctions. Only limited by nominal speeds.
+#ifdef JERK_LIMITED_ACCELERATION
+  #define S_CURVE_BISECTIONS 10 // Bisection steps of the S-curve ramp speeds without a closed form
+#endif
 
 // Define planner variables
 typedef struct {
-  int32_t position[3];             // The planner position of the tool in absolute steps. Kept separate
+  int32_t position[N_AXIS];        // The planner position of the tool in absolute steps. Kept separate
                                    // from g-code position for movements requiring multiple line motions,
                                    // i.e. arcs, canned cycles, and backlash compensation.
-  float previous_unit_vec[3];     // Unit vector of previous path line segment
+  float previous_unit_vec[N_AXIS];// Unit vector of previous path line segment
   float previous_nominal_speed;   // Nominal speed of previous path line segment
+  float previous_millimeters;     // Length of previous path line segment
+  float path_tolerance;           // G64 junction blending tolerance in mm. Zero in exact path mode G61.
+  #ifdef FIXED_POINT_COORDINATES
+    uint32_t step_scale[N_AXIS];  // Steps per parser coordinate unit of each axis, in units of 2^-step_shift
+    uint8_t step_shift[N_AXIS];   // Fraction bits of the step scale of each axis
+  #endif
 } planner_t;
 static planner_t pl;
 
+plan_telemetry_t plan_telemetry;
+
+#ifdef ENABLE_CYCLE_TIME_ESTIMATE
+  plan_estimate_t plan_estimate;
+#endif
+
 // Returns the index of the next block in the ring buffer
 // NOTE: Removed modulo (%) operator, which uses an expensive divide and multiplication.
 static uint8_t next_block_index(uint8_t block_index) 
@@ -71,6 +91,7 @@ static uint8_t prev_block_index(uint8_t block_index)
 }
 
 
+#ifndef FIXED_POINT_TRAPEZOID
 // Calculates the distance (not time) it takes to accelerate from initial_rate to target_rate using the 
 // given acceleration:
 static float estimate_acceleration_distance(float initial_rate, float target_rate, float acceleration) 
@@ -96,16 +117,187 @@ static float intersection_distance(float initial_rate, float final_rate, float a
 {
   return( (2*acceleration*distance-initial_rate*initial_rate+final_rate*final_rate)/(4*acceleration) );
 }
+#else
+// Calculates the number of step events it takes to accelerate from initial_rate to target_rate, i.e.
+// (target_rate^2-initial_rate^2)/(2*acceleration), in integer math. The rate difference and sum are
+// each scaled down to 16 bits to keep their product within 32 bits, and the acceleration divisor is
+// scaled down by the same power of two. Both are exact below 2^16 step/min. The result is rounded up,
+// if ceiling is set, and rounded down otherwise.
+// NOTE: Requires target_rate >= initial_rate. Acceleration is given in (step/min^2).
+static uint32_t fixed_acceleration_distance(uint32_t initial_rate, uint32_t target_rate, 
+  uint32_t acceleration, uint8_t ceiling)
+{
+  uint32_t rate_difference = target_rate-initial_rate;
+  uint32_t rate_sum = target_rate+initial_rate;
+  uint8_t shift = 0;
+  while (rate_difference > 0xFFFF) { rate_difference >>= 1; shift++; }
+  while (rate_sum > 0xFFFF) { rate_sum >>= 1; shift++; }
+  uint32_t divisor = (2*acceleration) >> shift;
+  if (divisor == 0) { divisor = 1; }
+  uint32_t product = rate_difference*rate_sum;
+  uint32_t steps = product/divisor;
+  if (ceiling && (product % divisor)) { steps++; }
+  return(steps);
+}
+#endif
+
+#ifdef JERK_LIMITED_ACCELERATION
+// Returns the duration of the S-curve ramp by the given speed change, as traced by the stepper 
+// segment generator. The acceleration ramps up at the jerk, holds at the acceleration and ramps down
+// again. A speed change too small to reach the acceleration ramps it up and down only. Any
+// consistent units, e.g. mm/min, mm/min^2 and mm/min^3 give minutes.
+static float s_curve_time(float speed_change, float acceleration, float jerk)
+{
+  if (speed_change*jerk >= acceleration*acceleration) { return(speed_change/acceleration + acceleration/jerk); }
+  return(2*sqrt(speed_change/jerk));
+}
+
+// Returns the distance of the S-curve ramp between the two speeds. Being symmetric, the ramp covers
+// the distance at the mean of both speeds over its duration.
+static float s_curve_distance(float initial_speed, float final_speed, float acceleration, float jerk)
+{
+  return(0.5*(initial_speed+final_speed)*s_curve_time(fabs(final_speed-initial_speed),acceleration,jerk));
+}
+
+// Returns the highest speed, from or to which the S-curve ramp reaches the given speed within the 
+// distance. Solves the ramp distance from s_curve_distance() for the speed change. Without reaching
+// the acceleration, this is a cubic in the half duration of the ramp, solved by Cardano's formula in
+// a form free of cancellation. A zero jerk ramps linearly.
+float plan_ramp_max_speed(float speed, float distance, float acceleration, float jerk)
+{
+  if (jerk <= 0.0) { return(sqrt(speed*speed + 2*acceleration*distance)); }
+  float k = 0.5*acceleration*acceleration/jerk; // Speed change of each jerk phase
+  if (distance*jerk >= 2*(speed+k)*acceleration) {
+    float v = speed-k;
+    return(sqrt(v*v + 2*acceleration*distance) - k);
+  }
+  float p = (2.0/3.0)*speed/jerk;
+  float q = 0.5*distance/jerk;
+  float u = cbrt(q + sqrt(q*q + p*p*p));
+  float w = p/u;
+  float t = distance/(jerk*(u*u + p + w*w)); // Half duration of the ramp
+  return(speed + jerk*t*t);
+}
+#endif
 
             
+// Returns the lowest of the axis maximum values scaled by the path unit vector, i.e. the largest
+// path rate or acceleration in the direction of the unit vector that keeps all axes within their
+// limits. Axes without travel do not limit the value.
+static float limit_value_by_axis_maximum(float *max_value, float *unit_vec)
+{
+  uint8_t idx;
+  float limit_value = SOME_LARGE_VALUE;
+  for (idx=0; idx<N_AXIS; idx++) {
+    if (unit_vec[idx] != 0) { // Avoid divide by zero.
+      limit_value = min(limit_value,fabs(max_value[idx]/unit_vec[idx]));
+    }
+  }
+  return(limit_value);
+}
+
+// Returns the nominal speed limit of a block by the axis maximum rates. Reconstructs the direction
+// from the block step counts, since a partially completed block only retains its remaining length.
+static float block_max_speed(block_t *block)
+{
+  float unit_vec[N_AXIS];
+  float length = 0.0;
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    unit_vec[idx] = block->steps[idx]/settings.steps_per_mm[idx];
+    length += unit_vec[idx]*unit_vec[idx];
+  }
+  float inverse_length = 1.0/sqrt(length);
+  for (idx=0; idx<N_AXIS; idx++) { unit_vec[idx] *= inverse_length; }
+  return(limit_value_by_axis_maximum(settings.max_rate, unit_vec));
+}
+
+// Returns the nominal step rate of a block by its nominal speed. Not stored in the block, since only 
+// the executing block needs it. A dwell block runs at one step event per acceleration tick.
+static uint32_t block_nominal_rate(block_t *block)
+{
+  if (block->sync_event) { return(60*ACCELERATION_TICKS_PER_SECOND); }
+  return(ceil(block->nominal_speed*block->step_event_count/block->millimeters)); // (step/min) Always > 0
+}
+
+// Returns the override percent to apply to the programmed speed of a block. An override above 100%
+// is limited to the highest whole percent within the axis maximum rates, so the programmed speed 
+// can always be recovered from the nominal speed and the override. See block_programmed_speed().
+static uint8_t limit_override_by_max_speed(uint8_t override, float programmed_speed, float max_speed)
+{
+  if (override > 100) {
+    float limit = floor(100.0*max_speed/programmed_speed);
+    if (limit < override) { override = max(limit,100); }
+  }
+  return(override);
+}
+
+// Returns the programmed speed of a block in mm/min, i.e. its nominal speed without the override.
+// Not stored in the block, since it is only needed to rescale the block for a new override.
+static float block_programmed_speed(block_t *block)
+{
+  if (block->override == 100) { return(block->nominal_speed); }
+  return(block->nominal_speed*100.0/block->override);
+}
+
+// Returns the maximum allowable entry speed of a block at the junction with the previous motion 
+// block. Only the cornering limit is stored in the block, as the nominal speeds of both blocks also
+// limit the junction speed and change with the overrides.
+static float max_entry_speed(block_t *previous, block_t *current)
+{
+  if (current->junction_fixed_flag) { return(current->max_junction_speed); }
+  return(min(current->max_junction_speed, min(previous->nominal_speed,current->nominal_speed)));
+}
+
+// Returns the stepper rate change per acceleration tick of a block, i.e. its path acceleration in
+// step rate units. Not stored in the block, since only the executing block needs it. The rate change
+// is rounded up, so the stepper accelerates at least as quickly as the plan. A dwell block has the 
+// rate change of its full nominal rate, so a feed hold pauses it at the next tick.
+// NOTE: A partially completed block keeps its millimeters per step event, and so its rate change.
+uint32_t plan_get_rate_delta(block_t *block)
+{
+  if (block->sync_event) { return(block_nominal_rate(block)); }
+  return(ceil(block->acceleration*block->step_event_count/
+    (block->millimeters*(60*ACCELERATION_TICKS_PER_SECOND)))); // (step/min/acceleration_tick)
+}
+
 // Calculates the maximum allowable speed at this point when you must be able to reach target_velocity
 // using the acceleration within the allotted distance.
 // NOTE: sqrt() reimplimented here from prior version due to improved planner logic. Increases speed
 // in time critical computations, i.e. arcs or rapid short lines from curves. Guaranteed to not exceed
 // BLOCK_BUFFER_SIZE calls per planner cycle.
+// With JERK_LIMITED_ACCELERATION, this is the S-curve ramp of the stepper segment generator.
 static float max_allowable_speed(float acceleration, float target_velocity, float distance) 
 {
-  return( sqrt(target_velocity*target_velocity-2*acceleration*distance) );
+  #ifdef JERK_LIMITED_ACCELERATION
+    return( plan_ramp_max_speed(target_velocity,distance,-acceleration,settings.jerk) );
+  #else
+    return( sqrt(target_velocity*target_velocity-2*acceleration*distance) );
+  #endif
+}
+
+
+// Returns the lowest speed reachable when decelerating from the given speed within the distance,
+// the inverse of max_allowable_speed(). The S-curve ramp has no practical closed form inverse, so 
+// its speed is bisected. This is only called upon override changes.
+static float min_reachable_speed(float acceleration, float speed, float distance)
+{
+  #ifdef JERK_LIMITED_ACCELERATION
+    if (settings.jerk > 0.0) {
+      if (max_allowable_speed(-acceleration,0.0,distance) >= speed) { return(0.0); }
+      float low = 0.0;
+      uint8_t i;
+      for (i = 0; i < S_CURVE_BISECTIONS; i++) {
+        float v = 0.5*(low+speed);
+        if (max_allowable_speed(-acceleration,v,distance) >= speed) { speed = v; }
+        else { low = v; }
+      }
+      return(speed);
+    }
+  #endif
+  float v_squared = speed*speed - 2*acceleration*distance;
+  if (v_squared > 0.0) { return(sqrt(v_squared)); }
+  return(0.0);
 }
 
 
@@ -118,15 +310,16 @@ static void planner_reverse_pass_kernel(block_t *previous, block_t *current, blo
     // If entry speed is already at the maximum entry speed, no need to recheck. Block is cruising.
     // If not, block in state of acceleration or deceleration. Reset entry speed to maximum and 
     // check for maximum allowable speed reductions to ensure maximum possible planned speed.
-    if (current->entry_speed != current->max_entry_speed) {
+    float max_entry = max_entry_speed(previous, current);
+    if (current->entry_speed != max_entry) {
     
       // If nominal length true, max junction speed is guaranteed to be reached. Only compute
       // for max allowable speed if block is decelerating and nominal length is false.
-      if ((!current->nominal_length_flag) && (current->max_entry_speed > next->entry_speed)) {
-        current->entry_speed = min( current->max_entry_speed,
-          max_allowable_speed(-settings.acceleration,next->entry_speed,current->millimeters));
+      if ((!current->nominal_length_flag) && (max_entry > next->entry_speed)) {
+        current->entry_speed = min( max_entry,
+          max_allowable_speed(-current->acceleration,next->entry_speed,current->millimeters));
       } else {
-        current->entry_speed = current->max_entry_speed;
+        current->entry_speed = max_entry;
       } 
       current->recalculate_flag = true;    
     
@@ -136,27 +329,30 @@ static void planner_reverse_pass_kernel(block_t *previous, block_t *current, blo
 
 
 // planner_recalculate() needs to go over the current plan twice. Once in reverse and once forward. This 
-// implements the reverse pass.
+// implements the reverse pass. Only the blocks after the optimally planned block are scanned, since
+// no junction speed at or before it can change. Every block replanned thus has a previous block.
 static void planner_reverse_pass() 
 {
   uint8_t block_index = block_buffer_head;
   block_t *block[3] = {NULL, NULL, NULL};
-  while(block_index != block_buffer_tail) {    
+  while(block_index != block_buffer_planned) {    
     block_index = prev_block_index( block_index );
+    if (block_buffer[block_index].sync_event) { continue; } // Transparent to the look-ahead.
     block[2]= block[1];
     block[1]= block[0];
     block[0] = &block_buffer[block_index];
     planner_reverse_pass_kernel(block[0], block[1], block[2]);
   }
-  // Skip buffer tail/first block to prevent over-writing the initial entry speed.
+  // Skip the optimally planned block to prevent over-writing its entry speed. This is always the
+  // buffer tail/first block or a block after it.
 }
 
 
 // The kernel called by planner_recalculate() when scanning the plan from first to last entry.
-static void planner_forward_pass_kernel(block_t *previous, block_t *current, block_t *next) 
+// Returns true, if the current block entry speed is limited by the acceleration of the previous
+// block, as its junction speed can then never be increased by any block planned afterwards.
+static uint8_t planner_forward_pass_kernel(block_t *previous, block_t *current) 
 {
-  if(!previous) { return; }  // Begin planning after buffer_tail
-  
   // If the previous block is an acceleration block, but it is not long enough to complete the
   // full speed change within the block, we need to adjust the entry speed accordingly. Entry
   // speeds have already been reset, maximized, and reverse planned by reverse planner.
@@ -164,36 +360,93 @@ static void planner_forward_pass_kernel(block_t *previous, block_t *current, blo
   if (!previous->nominal_length_flag) {
     if (previous->entry_speed < current->entry_speed) {
       float entry_speed = min( current->entry_speed,
-        max_allowable_speed(-settings.acceleration,previous->entry_speed,previous->millimeters) );
+        max_allowable_speed(-previous->acceleration,previous->entry_speed,previous->millimeters) );
 
       // Check for junction speed change
       if (current->entry_speed != entry_speed) {
         current->entry_speed = entry_speed;
         current->recalculate_flag = true;
+        return(true);
       }
     }    
   }
+  return(false);
 }
 
 
 // planner_recalculate() needs to go over the current plan twice. Once in reverse and once forward. This 
-// implements the forward pass.
+// implements the forward pass. It also advances the optimally planned block pointer. A block is 
+// optimally planned, if its entry speed is at the maximum junction speed or if it is limited by the
+// acceleration from the previous block. Neither can change when more blocks are added, so this
+// block and all blocks before it have their final junction speeds and are skipped by all further
+// replanning until they are executed.
 static void planner_forward_pass() 
 {
-  uint8_t block_index = block_buffer_tail;
-  block_t *block[3] = {NULL, NULL, NULL};
+  uint8_t block_index = block_buffer_planned;
+  block_t *previous;
+  block_t *current = &block_buffer[block_index];
   
+  block_index = next_block_index( block_index );
   while(block_index != block_buffer_head) {
-    block[0] = block[1];
-    block[1] = block[2];
-    block[2] = &block_buffer[block_index];
-    planner_forward_pass_kernel(block[0],block[1],block[2]);
+    if (!block_buffer[block_index].sync_event) { // Event blocks are transparent to the look-ahead.
+      previous = current;
+      current = &block_buffer[block_index];
+      if (planner_forward_pass_kernel(previous,current) || 
+         (current->entry_speed == max_entry_speed(previous,current))) { 
+        block_buffer_planned = block_index;
+      }
+    }
     block_index = next_block_index( block_index );
   }
-  planner_forward_pass_kernel(block[1], block[2], NULL);
 }
 
 
+#ifdef JERK_LIMITED_ACCELERATION
+// Calculates the trapezoid phases for the S-curve ramps of the stepper segment generator, as 
+// calculate_trapezoid_for_block() does for the linear ramps. The S-curves take longer, since neither
+// the acceleration nor the jerk is ever exceeded. Without a plateau, the peak rate of the two ramps
+// is bisected, and the acceleration phase is rounded down, so the stepper segment generator ramps to
+// at most this peak. Computed in floating point, with or without FIXED_POINT_TRAPEZOID.
+static void calculate_s_curve_trapezoid(block_t *block, plan_trapezoid_t *trapezoid, float initial_rate)
+{
+  float acceleration = plan_get_rate_delta(block)*(ACCELERATION_TICKS_PER_SECOND*60.0); // (step/min^2)
+  float jerk = settings.jerk*block->step_event_count/block->millimeters; // (step/min^3)
+  float nominal_rate = trapezoid->nominal_rate;
+  float final_rate = trapezoid->final_rate;
+  float accelerate_steps = ceil(s_curve_distance(initial_rate,nominal_rate,acceleration,jerk));
+  float decelerate_steps = ceil(s_curve_distance(nominal_rate,final_rate,acceleration,jerk));
+  
+  // Override deceleration. See calculate_trapezoid_for_block().
+  if ((initial_rate > nominal_rate) || (final_rate > nominal_rate)) {
+    trapezoid->accelerate_until = 0;
+    trapezoid->decelerate_after = 0;
+    if ((final_rate < nominal_rate) && (accelerate_steps+decelerate_steps <= block->step_event_count)) {
+      trapezoid->accelerate_until = accelerate_steps;
+      trapezoid->decelerate_after = block->step_event_count-decelerate_steps;
+    }
+    return;
+  }
+  
+  if (accelerate_steps+decelerate_steps > block->step_event_count) {
+    float low = max(initial_rate,final_rate);
+    float high = nominal_rate;
+    uint8_t i;
+    for (i = 0; i < S_CURVE_BISECTIONS; i++) {
+      float peak_rate = 0.5*(low+high);
+      if (s_curve_distance(initial_rate,peak_rate,acceleration,jerk) + 
+          s_curve_distance(peak_rate,final_rate,acceleration,jerk) > block->step_event_count) { high = peak_rate; }
+      else { low = peak_rate; }
+    }
+    accelerate_steps = floor(s_curve_distance(initial_rate,low,acceleration,jerk));
+    accelerate_steps = min(accelerate_steps,block->step_event_count); // Round-off, or too short for any ramp
+    decelerate_steps = block->step_event_count-accelerate_steps;
+  }
+  trapezoid->accelerate_until = accelerate_steps;
+  trapezoid->decelerate_after = block->step_event_count-decelerate_steps;
+}
+#endif
+
+
 /*                             STEPPER RATE DEFINITION                                              
                                      +--------+   <- nominal_rate
                                     /          \                                
@@ -206,15 +459,90 @@ static void planner_forward_pass()
 // The factors represent a factor of braking and must be in the range 0.0-1.0.
 // This converts the planner parameters to the data required by the stepper controller.
 // NOTE: Final rates must be computed in terms of their respective blocks.
-static void calculate_trapezoid_for_block(block_t *block, float entry_factor, float exit_factor) 
+static void calculate_trapezoid_for_block(block_t *block, plan_trapezoid_t *trapezoid, float entry_factor, 
+  float exit_factor) 
 {  
-  block->initial_rate = ceil(block->nominal_rate*entry_factor); // (step/min)
-  block->final_rate = ceil(block->nominal_rate*exit_factor); // (step/min)
-  int32_t acceleration_per_minute = block->rate_delta*ACCELERATION_TICKS_PER_SECOND*60.0; // (step/min^2)
+  trapezoid->nominal_rate = block_nominal_rate(block);
+  uint32_t initial_rate = ceil(trapezoid->nominal_rate*entry_factor); // (step/min) See plan_get_initial_rate().
+  trapezoid->final_rate = ceil(trapezoid->nominal_rate*exit_factor); // (step/min)
+
+#ifdef JERK_LIMITED_ACCELERATION
+  if (settings.jerk > 0.0) { 
+    calculate_s_curve_trapezoid(block, trapezoid, initial_rate);
+    return;
+  }
+#endif
+
+#ifdef FIXED_POINT_TRAPEZOID
+  uint32_t acceleration_per_minute = plan_get_rate_delta(block)*ACCELERATION_TICKS_PER_SECOND*60; // (step/min^2)
+  
+  // Override deceleration. The entry or exit rate is above a reduced nominal rate, so decelerate to 
+  // the nominal rate at the start of the block, rather than accelerate. If the block is too short to
+  // reach the nominal rate, decelerate from the start to the final rate instead.
+  if ((initial_rate > trapezoid->nominal_rate) || (trapezoid->final_rate > trapezoid->nominal_rate)) {
+    trapezoid->accelerate_until = 0;
+    trapezoid->decelerate_after = 0;
+    if (trapezoid->final_rate < trapezoid->nominal_rate) {
+      uint32_t accelerate_steps = 
+        fixed_acceleration_distance(trapezoid->nominal_rate, initial_rate, acceleration_per_minute, true);
+      uint32_t decelerate_steps = 
+        fixed_acceleration_distance(trapezoid->final_rate, trapezoid->nominal_rate, acceleration_per_minute, false);
+      if (accelerate_steps+decelerate_steps <= block->step_event_count) {
+        trapezoid->accelerate_until = accelerate_steps;
+        trapezoid->decelerate_after = block->step_event_count-decelerate_steps;
+      }
+    }
+    return;
+  }
+  
+  int32_t accelerate_steps = 
+    fixed_acceleration_distance(initial_rate, trapezoid->nominal_rate, acceleration_per_minute, true);
+  int32_t decelerate_steps = 
+    fixed_acceleration_distance(trapezoid->final_rate, trapezoid->nominal_rate, acceleration_per_minute, false);
+    
+  // Calculate the size of Plateau of Nominal Rate. 
+  int32_t plateau_steps = block->step_event_count-accelerate_steps-decelerate_steps;
+  
+  // Is the Plateau of Nominal Rate smaller than nothing? That means no cruising, and we will find
+  // the intersection of the acceleration and deceleration ramps, where the block would reach the 
+  // final_rate exactly at its end. This is halfway along the block, offset by half the distance
+  // it takes to change between the initial and final rates.
+  if (plateau_steps < 0) {  
+    if (trapezoid->final_rate >= initial_rate) {
+      accelerate_steps = (block->step_event_count + 1 + (int32_t)fixed_acceleration_distance(
+        initial_rate, trapezoid->final_rate, acceleration_per_minute, true)) >> 1;
+    } else {
+      accelerate_steps = (block->step_event_count + 1 - (int32_t)fixed_acceleration_distance(
+        trapezoid->final_rate, initial_rate, acceleration_per_minute, false)) >> 1;
+    }
+    accelerate_steps = max(accelerate_steps,0); // Check limits due to numerical round-off
+    accelerate_steps = min(accelerate_steps,block->step_event_count);
+    plateau_steps = 0;
+  }  
+#else
+  int32_t acceleration_per_minute = plan_get_rate_delta(block)*ACCELERATION_TICKS_PER_SECOND*60.0; // (step/min^2)
+  
+  // Override deceleration. See above.
+  if ((initial_rate > trapezoid->nominal_rate) || (trapezoid->final_rate > trapezoid->nominal_rate)) {
+    trapezoid->accelerate_until = 0;
+    trapezoid->decelerate_after = 0;
+    if (trapezoid->final_rate < trapezoid->nominal_rate) {
+      int32_t accelerate_steps = 
+        ceil(estimate_acceleration_distance(trapezoid->nominal_rate, initial_rate, acceleration_per_minute));
+      int32_t decelerate_steps = 
+        floor(estimate_acceleration_distance(trapezoid->nominal_rate, trapezoid->final_rate, -acceleration_per_minute));
+      if (accelerate_steps+decelerate_steps <= block->step_event_count) {
+        trapezoid->accelerate_until = accelerate_steps;
+        trapezoid->decelerate_after = block->step_event_count-decelerate_steps;
+      }
+    }
+    return;
+  }
+  
   int32_t accelerate_steps = 
-    ceil(estimate_acceleration_distance(block->initial_rate, block->nominal_rate, acceleration_per_minute));
+    ceil(estimate_acceleration_distance(initial_rate, trapezoid->nominal_rate, acceleration_per_minute));
   int32_t decelerate_steps = 
-    floor(estimate_acceleration_distance(block->nominal_rate, block->final_rate, -acceleration_per_minute));
+    floor(estimate_acceleration_distance(trapezoid->nominal_rate, trapezoid->final_rate, -acceleration_per_minute));
     
   // Calculate the size of Plateau of Nominal Rate. 
   int32_t plateau_steps = block->step_event_count-accelerate_steps-decelerate_steps;
@@ -224,14 +552,15 @@ static void calculate_trapezoid_for_block(block_t *block, float entry_factor, fl
   // in order to reach the final_rate exactly at the end of this block.
   if (plateau_steps < 0) {  
     accelerate_steps = ceil(
-      intersection_distance(block->initial_rate, block->final_rate, acceleration_per_minute, block->step_event_count));
+      intersection_distance(initial_rate, trapezoid->final_rate, acceleration_per_minute, block->step_event_count));
     accelerate_steps = max(accelerate_steps,0); // Check limits due to numerical round-off
     accelerate_steps = min(accelerate_steps,block->step_event_count);
     plateau_steps = 0;
   }  
+#endif
   
-  block->accelerate_until = accelerate_steps;
-  block->decelerate_after = accelerate_steps+plateau_steps;
+  trapezoid->accelerate_until = accelerate_steps;
+  trapezoid->decelerate_after = accelerate_steps+plateau_steps;
 }     
 
 /*                            PLANNER SPEED DEFINITION                                              
@@ -242,34 +571,36 @@ static void calculate_trapezoid_for_block(block_t *block, float entry_factor, fl
                                    +-------------+                              
                                        time -->                                 
 */                                                                              
-// Recalculates the trapezoid speed profiles for flagged blocks in the plan according to the 
-// entry_speed for each junction and the entry_speed of the next junction. Must be called by 
-// planner_recalculate() after updating the blocks. Any recalulate flagged junction will
-// compute the two adjacent trapezoids to the junction, since the junction speed corresponds 
-// to exit speed and entry speed of one another.
-static void planner_recalculate_trapezoids() 
+// Flags the trapezoid speed profiles of the blocks in the plan for recalculation, where the 
+// entry_speed of the junction or the entry_speed of the next junction has changed. Must be called by 
+// planner_recalculate() after updating the blocks. Any recalulate flagged junction will flag the
+// two adjacent trapezoids to the junction, since the junction speed corresponds to exit speed and
+// entry speed of one another. Starts from the given block, at or before which no junction speeds
+// have changed. The trapezoids themselves are only computed for the executing block, as it is 
+// prepped by the stepper segment generator. See plan_get_current_trapezoid().
+static void planner_recalculate_trapezoids(uint8_t block_index) 
 {
-  uint8_t block_index = block_buffer_tail;
   block_t *current;
   block_t *next = NULL;
   
   while(block_index != block_buffer_head) {
+    if (block_buffer[block_index].sync_event) { // Transparent to the look-ahead.
+      block_index = next_block_index( block_index );
+      continue;
+    }
     current = next;
     next = &block_buffer[block_index];
     if (current) {
       // Recalculate if current block entry or exit junction speed has changed.
       if (current->recalculate_flag || next->recalculate_flag) {
-        // NOTE: Entry and exit factors always > 0 by all previous logic operations.     
-        calculate_trapezoid_for_block(current, current->entry_speed/current->nominal_speed,
-          next->entry_speed/current->nominal_speed);      
-        current->recalculate_flag = false; // Reset current only to ensure next trapezoid is computed
+        current->trapezoid_flag = true;
+        current->recalculate_flag = false; // Reset current only to ensure next trapezoid is flagged
       }
     }
     block_index = next_block_index( block_index );
   }
   // Last/newest block in buffer. Exit speed is set with MINIMUM_PLANNER_SPEED. Always recalculated.
-  calculate_trapezoid_for_block(next, next->entry_speed/next->nominal_speed,
-    MINIMUM_PLANNER_SPEED/next->nominal_speed);
+  next->trapezoid_flag = true;
   next->recalculate_flag = false;
 }
 
@@ -291,19 +622,37 @@ static void planner_recalculate_trapezoids()
 //   3. Recalculate trapezoids for all blocks using the recently updated junction speeds. Block trapezoids
 //      with no updated junction speeds will not be recalculated and assumed ok as is.
 //
+// The one, true constant acceleration is that of each block, i.e. the path acceleration setting limited
+// by the axis accelerations in the direction of travel of the block.
+//
 // All planner computations are performed with doubles (float on Arduinos) to minimize numerical round-
 // off errors. Only when planned values are converted to stepper rate parameters, these are integers.
+//
+// Only the blocks after the optimally planned block pointer are replanned, which is advanced by the
+// forward pass, as described in planner_forward_pass(). For long streams of short segments, like 3D
+// toolpaths, a new block usually only replans a few blocks back, rather than the whole buffer.
+// The optimally planned block pointer always points to a motion block, or to the buffer head if no
+// motion block remains after the fully planned ones, so the event blocks in between are skipped.
 
 static void planner_recalculate() 
 {     
+  if (block_buffer_planned == block_buffer_head) { return; } // Only event blocks. Nothing to plan.
+  PROFILE_BEGIN(PROFILE_PLANNER_RECALCULATE);
+  uint32_t start_time = sys_get_time();
+  uint8_t block_index = block_buffer_planned; // No junction speeds change at or before this block.
   planner_reverse_pass();
   planner_forward_pass();
-  planner_recalculate_trapezoids();
+  planner_recalculate_trapezoids(block_index);
+  uint32_t ticks = sys_get_time()-start_time;
+  if (ticks > 0xff) { ticks = 0xff; } // Saturate, if longer than the telemetry range.
+  if (ticks > plan_telemetry.max_recalculate_ticks) { plan_telemetry.max_recalculate_ticks = ticks; }
+  PROFILE_END(PROFILE_PLANNER_RECALCULATE);
 }
 
 void plan_reset_buffer() 
 {
   block_buffer_tail = block_buffer_head;
+  block_buffer_planned = block_buffer_tail;
   next_buffer_head = next_block_index(block_buffer_head);
 }
 
@@ -311,12 +660,61 @@ void plan_init()
 {
   plan_reset_buffer();
   memset(&pl, 0, sizeof(pl)); // Clear planner struct
+  #ifdef FIXED_POINT_COORDINATES
+    plan_update_step_scale();
+  #endif
+  memset(&plan_telemetry, 0, sizeof(plan_telemetry));
+  plan_reset_telemetry();
+  #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+    memset(&plan_estimate, 0, sizeof(plan_estimate));
+  #endif
+}
+
+#ifdef FIXED_POINT_COORDINATES
+// The step scale is the steps/mm setting divided by COORD_PER_MM as a 31-bit binary fraction, so a
+// fixed-point target converts to steps with one integer multiply and shift, at a relative error
+// below 10^-9. The setting is doubled up to 2^30 while still a float, which is exact, and then 
+// divided in integers.
+void plan_update_step_scale()
+{
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    float steps_per_mm = settings.steps_per_mm[idx]; // Always > 0
+    uint8_t shift = 0;
+    while (steps_per_mm < 1073741824.0) { // 2^30
+      steps_per_mm *= 2;
+      shift++;
+    }
+    uint64_t scale = lround(steps_per_mm);
+    while ((scale << 1) < ((uint64_t)COORD_PER_MM << 31)) {
+      scale <<= 1;
+      shift++;
+    }
+    pl.step_scale[idx] = (scale + COORD_PER_MM/2)/COORD_PER_MM;
+    pl.step_shift[idx] = shift;
+  }
+}
+#endif
+
+void plan_reset_telemetry()
+{
+  plan_telemetry.min_depth = BLOCK_BUFFER_SIZE-1;
+  plan_telemetry.max_recalculate_ticks = 0;
 }
 
 void plan_discard_current_block() 
 {
   if (block_buffer_head != block_buffer_tail) {
-    block_buffer_tail = next_block_index( block_buffer_tail );
+    uint8_t block_index = next_block_index( block_buffer_tail );
+    // Push the optimally planned block pointer along with the tail, if it is the discarded block,
+    // and on past any event blocks to the next motion block.
+    if (block_buffer_tail == block_buffer_planned) { 
+      block_buffer_planned = block_index; 
+      while ((block_buffer_planned != block_buffer_head) && block_buffer[block_buffer_planned].sync_event) {
+        block_buffer_planned = next_block_index( block_buffer_planned );
+      }
+    }
+    block_buffer_tail = block_index;
   }
 }
 
@@ -326,6 +724,44 @@ block_t *plan_get_current_block()
   return(&block_buffer[block_buffer_tail]);
 }
 
+// The trapezoid of every block is recalculated upon any change of its entry or nominal speed, so this 
+// always equals the initial rate the trapezoid was calculated with, which is not stored to save RAM.
+// A dwell block runs at its constant nominal rate.
+uint32_t plan_get_initial_rate(block_t *block)
+{
+  uint32_t nominal_rate = block_nominal_rate(block);
+  if (block->sync_event) { return(nominal_rate); }
+  return(ceil(nominal_rate*(block->entry_speed/block->nominal_speed))); // (step/min)
+}
+
+// The exit speed of the current block is the entry speed of the next motion block. Event blocks are
+// transparent, as in the planner passes. Without a next motion block, the block plans to stop. A 
+// dwell block runs at its constant nominal rate throughout.
+void plan_get_current_trapezoid(plan_trapezoid_t *trapezoid)
+{
+  block_t *block = &block_buffer[block_buffer_tail];
+  block->trapezoid_flag = false;
+  if (block->sync_event) {
+    trapezoid->nominal_rate = block_nominal_rate(block);
+    trapezoid->final_rate = trapezoid->nominal_rate;
+    trapezoid->accelerate_until = 0;
+    trapezoid->decelerate_after = block->step_event_count;
+    return;
+  }
+  float exit_speed = MINIMUM_PLANNER_SPEED;
+  uint8_t block_index = next_block_index( block_buffer_tail );
+  while (block_index != block_buffer_head) {
+    if (!block_buffer[block_index].sync_event) { 
+      exit_speed = block_buffer[block_index].entry_speed;
+      break;
+    }
+    block_index = next_block_index( block_index );
+  }
+  // NOTE: Entry and exit factors always > 0 by all previous logic operations.     
+  calculate_trapezoid_for_block(block, trapezoid, block->entry_speed/block->nominal_speed,
+    exit_speed/block->nominal_speed);
+}
+
 // Returns the availability status of the block ring buffer. True, if full.
 uint8_t plan_check_full_buffer()
 {
@@ -333,84 +769,190 @@ uint8_t plan_check_full_buffer()
   return(false);
 }
 
+uint8_t plan_get_block_buffer_available()
+{
+  if (block_buffer_head >= block_buffer_tail) { return((BLOCK_BUFFER_SIZE-1)-(block_buffer_head-block_buffer_tail)); }
+  return(block_buffer_tail-block_buffer_head-1);
+}
+
+uint8_t plan_get_block_buffer_count()
+{
+  return((BLOCK_BUFFER_SIZE-1)-plan_get_block_buffer_available());
+}
+
 // Block until all buffered steps are executed or in a cycle state. Works with feed hold
 // during a synchronize call, if it should happen. Also, waits for clean cycle end.
+// NOTE: Planner blocks are discarded once they have been prepped into step segments, so the
+// cycle and feed hold states also indicate that the segment buffer is still executing.
 void plan_synchronize()
 {
-  while (plan_get_current_block() || sys.state == STATE_CYCLE) { 
+  #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+    // Nothing executes the blocks in the estimate mode. Estimate and discard them all instead.
+    if (sys.state == STATE_ESTIMATE) { 
+      while (plan_get_current_block()) { plan_estimate_current_block(); }
+      return;
+    }
+  #endif
+  while (plan_get_current_block() || sys.state == STATE_CYCLE || sys.state == STATE_HOLD || 
+         sys.state == STATE_JOG) { 
     protocol_execute_runtime();   // Check and execute run-time commands
     if (sys.abort) { return; } // Check for system abort
   }    
 }
 
-// Add a new linear movement to the buffer. x, y and z is the signed, absolute target position in 
-// millimeters. Feed rate specifies the speed of the motion. If feed rate is inverted, the feed
+#ifdef ENABLE_CYCLE_TIME_ESTIMATE
+// Returns the time in minutes to trace the step events at a constant acceleration between the two 
+// step rates, which the stepper subsystem never runs below its minimum step rate.
+static float estimate_ramp_time(float initial_rate, float final_rate, int32_t step_events)
+{
+  initial_rate = max(initial_rate, MINIMUM_STEPS_PER_MINUTE);
+  final_rate = max(final_rate, MINIMUM_STEPS_PER_MINUTE);
+  return(2*step_events/(initial_rate+final_rate));
+}
+
+// Estimates the execution time of the current block from its trapezoid, as the stepper subsystem
+// would trace it, and discards the block. The block is final, since the stepper subsystem would 
+// begin its execution here too. From the initial rate, the block ramps to the nominal rate until 
+// accelerate_until, cruises at the nominal rate until decelerate_after and then ramps to the final
+// rate. With the deceleration override, the first ramp decelerates to the reduced nominal rate.
+void plan_estimate_current_block()
+{
+  block_t *block = plan_get_current_block();
+  if (block == NULL) { return; }
+  
+  if (block->sync_event == PLAN_EVENT_DWELL) {
+    plan_estimate.dwell_time += (float)block->step_event_count/ACCELERATION_TICKS_PER_SECOND;
+  } else if (!block->sync_event) {
+    plan_trapezoid_t trapezoid;
+    plan_get_current_trapezoid(&trapezoid);
+    float acceleration = plan_get_rate_delta(block)*(ACCELERATION_TICKS_PER_SECOND*60.0); // (step/min^2)
+    float initial_rate = plan_get_initial_rate(block);
+    float rate_change = 2*acceleration*trapezoid.accelerate_until; // (step/min)^2
+    float rate;
+    if (initial_rate < trapezoid.nominal_rate) {
+      #ifdef JERK_LIMITED_ACCELERATION
+        float jerk = settings.jerk*block->step_event_count/block->millimeters; // (step/min^3)
+        rate = plan_ramp_max_speed(initial_rate, trapezoid.accelerate_until, acceleration, jerk);
+      #else
+        rate = sqrt(initial_rate*initial_rate + rate_change);
+      #endif
+      if (rate > trapezoid.nominal_rate) { rate = trapezoid.nominal_rate; }
+    } else {
+      rate = initial_rate*initial_rate - rate_change;
+      rate = (rate > 0.0) ? sqrt(rate) : 0.0;
+      if (rate < trapezoid.nominal_rate) { rate = trapezoid.nominal_rate; }
+    }
+    float time = estimate_ramp_time(initial_rate, rate, trapezoid.accelerate_until); // (min)
+    if (trapezoid.decelerate_after > trapezoid.accelerate_until) {
+      rate = trapezoid.nominal_rate;
+      time += (trapezoid.decelerate_after-trapezoid.accelerate_until)/rate;
+    }
+    time += estimate_ramp_time(rate, trapezoid.final_rate, block->step_event_count-trapezoid.decelerate_after);
+    time *= 60; // (sec)
+  
+    // Break the time down by the programmed feed rates, in order of appearance, until out of room.
+    if (block->rapid_motion_flag) { 
+      plan_estimate.rapid_time += time; 
+    } else {
+      float programmed_speed = block_programmed_speed(block);
+      uint8_t idx;
+      for (idx = 0; idx < ESTIMATE_FEED_RATES; idx++) {
+        if (plan_estimate.feed_rate[idx] == 0.0) { plan_estimate.feed_rate[idx] = programmed_speed; }
+        if (plan_estimate.feed_rate[idx] == programmed_speed) { break; }
+      }
+      if (idx < ESTIMATE_FEED_RATES) { plan_estimate.feed_time[idx] += time; }
+      else { plan_estimate.other_time += time; }
+    }
+  }
+  plan_discard_current_block();
+}
+#endif
+
+
+// Add a new linear movement to the buffer. target[N_AXIS] is the signed, absolute target position 
+// in parser coordinates, i.e. millimeters or fixed point. See coord_t. Feed rate specifies the speed of the motion. If feed rate is inverted, the feed
 // rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
 // All position data passed to the planner must be in terms of machine position to keep the planner 
 // independent of any coordinate system changes and offsets, which are handled by the g-code parser.
 // NOTE: Assumes buffer is available. Buffer checks are handled at a higher level by motion_control.
-void plan_buffer_line(float x, float y, float z, float feed_rate, uint8_t invert_feed_rate) 
+void plan_buffer_line(coord_t *target, float feed_rate, uint8_t invert_feed_rate) 
 {
   // Prepare to set up new block
   block_t *block = &block_buffer[block_buffer_head];
 
-  // Calculate target position in absolute steps
-  int32_t target[3];
-  target[X_AXIS] = lround(x*settings.steps_per_mm[X_AXIS]);
-  target[Y_AXIS] = lround(y*settings.steps_per_mm[Y_AXIS]);
-  target[Z_AXIS] = lround(z*settings.steps_per_mm[Z_AXIS]);     
-
-  // Compute direction bits for this block
+  // Calculate the target position in absolute steps, the direction bits, and the number of steps 
+  // and path vector for each axis in terms of absolute step target and current positions. Unrolled
+  // per axis, so the direction pin bits are compile-time constants. A fixed-point target converts to
+  // steps by the step scale in integer math, rounded to nearest.
+  int32_t target_steps[N_AXIS];
+  float delta_mm[N_AXIS];
+  block->sync_event = 0;
   block->direction_bits = 0;
-  if (target[X_AXIS] < pl.position[X_AXIS]) { block->direction_bits |= (1<<X_DIRECTION_BIT); }
-  if (target[Y_AXIS] < pl.position[Y_AXIS]) { block->direction_bits |= (1<<Y_DIRECTION_BIT); }
-  if (target[Z_AXIS] < pl.position[Z_AXIS]) { block->direction_bits |= (1<<Z_DIRECTION_BIT); }
-  
-  // Number of steps for each axis
-  block->steps_x = labs(target[X_AXIS]-pl.position[X_AXIS]);
-  block->steps_y = labs(target[Y_AXIS]-pl.position[Y_AXIS]);
-  block->steps_z = labs(target[Z_AXIS]-pl.position[Z_AXIS]);
-  block->step_event_count = max(block->steps_x, max(block->steps_y, block->steps_z));
+  block->step_event_count = 0;
+  #ifdef FIXED_POINT_COORDINATES
+    #define TARGET_STEPS(idx) \
+      (((int64_t)target[idx]*pl.step_scale[idx] + (1LL<<(pl.step_shift[idx]-1))) >> pl.step_shift[idx])
+  #else
+    #define TARGET_STEPS(idx) lround(target[idx]*settings.steps_per_mm[idx])
+  #endif
+  #define PLAN_AXIS(idx) \
+    target_steps[idx] = TARGET_STEPS(idx); \
+    if (target_steps[idx] < pl.position[idx]) { block->direction_bits |= (1<<DIRECTION_BIT_##idx); } \
+    block->steps[idx] = labs(target_steps[idx]-pl.position[idx]); \
+    block->step_event_count = max(block->step_event_count, block->steps[idx]); \
+    delta_mm[idx] = (target_steps[idx]-pl.position[idx])/settings.steps_per_mm[idx];
+  FOR_EACH_AXIS(PLAN_AXIS)
+  #undef PLAN_AXIS
+  #undef TARGET_STEPS
 
   // Bail if this is a zero-length block
   if (block->step_event_count == 0) { return; };
   
-  // Compute path vector in terms of absolute step target and current positions
-  float delta_mm[3];
-  delta_mm[X_AXIS] = (target[X_AXIS]-pl.position[X_AXIS])/settings.steps_per_mm[X_AXIS];
-  delta_mm[Y_AXIS] = (target[Y_AXIS]-pl.position[Y_AXIS])/settings.steps_per_mm[Y_AXIS];
-  delta_mm[Z_AXIS] = (target[Z_AXIS]-pl.position[Z_AXIS])/settings.steps_per_mm[Z_AXIS];
-  block->millimeters = sqrt(delta_mm[X_AXIS]*delta_mm[X_AXIS] + delta_mm[Y_AXIS]*delta_mm[Y_AXIS] + 
-                            delta_mm[Z_AXIS]*delta_mm[Z_AXIS]);
+  uint8_t idx;
+  block->millimeters = 0.0;
+  for (idx=0; idx<N_AXIS; idx++) { block->millimeters += delta_mm[idx]*delta_mm[idx]; }
+  block->millimeters = sqrt(block->millimeters);
   float inverse_millimeters = 1.0/block->millimeters;  // Inverse millimeters to remove multiple divides	
   
+  // Compute path unit vector                            
+  float unit_vec[N_AXIS];
+  for (idx=0; idx<N_AXIS; idx++) { unit_vec[idx] = delta_mm[idx]*inverse_millimeters; }
+
   // Calculate speed in mm/minute for each axis. No divide by zero due to previous checks.
   // NOTE: Minimum stepper speed is limited by MINIMUM_STEPS_PER_MINUTE in stepper.c
   float inverse_minute;
+  uint8_t override = sys.feed_override;
+  block->rapid_motion_flag = false;
+  if (feed_rate < 0) { // Seek motion
+    feed_rate = settings.default_seek_rate;
+    invert_feed_rate = false;
+    block->rapid_motion_flag = true;
+    override = sys.rapid_override;
+  }
+  if (sys.state == STATE_HOMING) { override = 100; } // Homing always moves at the homing rates.
   if (!invert_feed_rate) {
     inverse_minute = feed_rate * inverse_millimeters;
   } else {
     inverse_minute = 1.0 / feed_rate;
   }
   block->nominal_speed = block->millimeters * inverse_minute; // (mm/min) Always > 0
-  block->nominal_rate = ceil(block->step_event_count * inverse_minute); // (step/min) Always > 0
+  // Limit the programmed and the overridden speed to the axis maximum rates in the direction of travel.
+  float max_speed = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+  if (block->nominal_speed > max_speed) { block->nominal_speed = max_speed; }
+  block->override = limit_override_by_max_speed(override, block->nominal_speed, max_speed);
+  if (block->override != 100) { 
+    block->nominal_speed = min(block->nominal_speed*block->override/100.0, max_speed);
+  }
   
-  // Compute the acceleration rate for the trapezoid generator. Depending on the slope of the line
-  // average travel per step event changes. For a line along one axis the travel per step event
-  // is equal to the travel/step in the particular axis. For a 45 degree line the steppers of both
-  // axes might step for every step event. Travel per step event is then sqrt(travel_x^2+travel_y^2).
-  // To generate trapezoids with constant acceleration between blocks the rate_delta must be computed 
-  // specifically for each line to compensate for this phenomenon:
-  // Convert universal acceleration for direction-dependent stepper rate change parameter
-  block->rate_delta = ceil( block->step_event_count*inverse_millimeters *  
-        settings.acceleration / (60 * ACCELERATION_TICKS_PER_SECOND )); // (step/min/acceleration_tick)
-
-  // Compute path unit vector                            
-  float unit_vec[3];
-
-  unit_vec[X_AXIS] = delta_mm[X_AXIS]*inverse_millimeters;
-  unit_vec[Y_AXIS] = delta_mm[Y_AXIS]*inverse_millimeters;
-  unit_vec[Z_AXIS] = delta_mm[Z_AXIS]*inverse_millimeters;  
+  // Compute the path acceleration, limited by the axis accelerations in the direction of travel. 
+  // Depending on the slope of the line average travel per step event changes. For a line along one 
+  // axis the travel per step event is equal to the travel/step in the particular axis. For a 45 
+  // degree line the steppers of both axes might step for every step event. Travel per step event is
+  // then sqrt(travel_x^2+travel_y^2). To generate trapezoids with constant acceleration between 
+  // blocks, the stepper rate change is computed specifically for each line from it to compensate 
+  // for this phenomenon. See plan_get_rate_delta().
+  block->acceleration = min(settings.acceleration,
+    limit_value_by_axis_maximum(settings.max_acceleration, unit_vec)); // (mm/min^2)
 
   // Compute maximum allowable entry speed at junction by centripetal acceleration approximation.
   // Let a circle be tangent to both previous and current path line segments, where the junction 
@@ -422,37 +964,64 @@ void plan_buffer_line(float x, float y, float z, float feed_rate, uint8_t invert
   // from path, but used as a robust way to compute cornering speeds, as it takes into account the
   // nonlinearities of both the junction angle and junction velocity.
   // NOTE: This is basically an exact path mode (G61), but it doesn't come to a complete stop unless
-  // the junction deviation value is high. In the future, if continuous mode (G64) is desired, the
-  // math here is exactly the same. Instead of motioning all the way to junction point, the machine
-  // will just need to follow the arc circle defined above and check if the arc radii are no longer
-  // than half of either line segment to ensure no overlapping. Right now, the Arduino likely doesn't
-  // have the horsepower to do these calculations at high feed rates.
-  float vmax_junction = MINIMUM_PLANNER_SPEED; // Set default max junction speed
+  // the junction deviation value is high. In continuous mode (G64), the math is exactly the same, 
+  // but with the deviation raised to the G64 P path tolerance, as long as the circle is no longer 
+  // blending more than half of either line segment, so the blends of adjacent junctions never 
+  // overlap. The machine still moves all the way to the junction point, rather than following the 
+  // arc, which the Arduino likely doesn't have the horsepower for at high feed rates. The junction
+  // speed is that of the blending arc, so the centripetal acceleration still respects the limits.
+  // NOTE: The default junction speed is not limited by the nominal speeds, so it is flagged fixed.
+  block->max_junction_speed = MINIMUM_PLANNER_SPEED; // Set default max junction speed
+  block->junction_fixed_flag = true;
 
   // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
-  if ((block_buffer_head != block_buffer_tail) && (pl.previous_nominal_speed > 0.0)) {
+  // The block is also the first, if only event blocks remain in the buffer, since the last motion
+  // block has been prepped to stop. See plan_discard_current_block().
+  if ((block_buffer_planned != block_buffer_head) && (pl.previous_nominal_speed > 0.0)) {
     // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
     // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
-    float cos_theta = - pl.previous_unit_vec[X_AXIS] * unit_vec[X_AXIS] 
-                       - pl.previous_unit_vec[Y_AXIS] * unit_vec[Y_AXIS] 
-                       - pl.previous_unit_vec[Z_AXIS] * unit_vec[Z_AXIS] ;
+    float cos_theta = 0.0;
+    for (idx=0; idx<N_AXIS; idx++) { cos_theta -= pl.previous_unit_vec[idx] * unit_vec[idx]; }
                          
     // Skip and use default max junction speed for 0 degree acute junction.
     if (cos_theta < 0.95) {
-      vmax_junction = min(pl.previous_nominal_speed,block->nominal_speed);
+      block->junction_fixed_flag = false;
+      block->max_junction_speed = SOME_LARGE_VALUE;
       // Skip and avoid divide by zero for straight junctions at 180 degrees. Limit to min() of nominal speeds.
       if (cos_theta > -0.95) {
         // Compute maximum junction velocity based on maximum acceleration and junction deviation
         float sin_theta_d2 = sqrt(0.5*(1.0-cos_theta)); // Trig half angle identity. Always positive.
-        vmax_junction = min(vmax_junction,
-          sqrt(settings.acceleration * settings.junction_deviation * sin_theta_d2/(1.0-sin_theta_d2)) );
+        // The centripetal acceleration points along the difference of the unit vectors, so it is 
+        // limited by the axis accelerations in that direction.
+        float junction_vec[N_AXIS];
+        float junction_length = 0.0;
+        for (idx=0; idx<N_AXIS; idx++) { 
+          junction_vec[idx] = unit_vec[idx]-pl.previous_unit_vec[idx];
+          junction_length += junction_vec[idx]*junction_vec[idx];
+        }
+        junction_length = sqrt(junction_length); // Always > 0, since not a straight junction.
+        for (idx=0; idx<N_AXIS; idx++) { junction_vec[idx] /= junction_length; }
+        float junction_acceleration = min(settings.acceleration,
+          limit_value_by_axis_maximum(settings.max_acceleration, junction_vec));
+        float radius_factor = sin_theta_d2/(1.0-sin_theta_d2); // Circle radius per junction deviation
+        float junction_radius = settings.junction_deviation * radius_factor;
+        if (pl.path_tolerance > settings.junction_deviation) {
+          // G64 blend. The circle touches each segment at radius/tan(theta/2) from the junction.
+          float max_radius = 0.5*min(block->millimeters,pl.previous_millimeters) * 
+            sin_theta_d2/sqrt(0.5*(1.0+cos_theta));
+          junction_radius = max(junction_radius, min(pl.path_tolerance*radius_factor, max_radius));
+        }
+        block->max_junction_speed = sqrt(junction_acceleration * junction_radius);
       }
     }
   }
-  block->max_entry_speed = vmax_junction;
+  float vmax_junction = block->max_junction_speed;
+  if (!block->junction_fixed_flag) {
+    vmax_junction = min(vmax_junction, min(pl.previous_nominal_speed,block->nominal_speed));
+  }
   
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  float v_allowable = max_allowable_speed(-settings.acceleration,MINIMUM_PLANNER_SPEED,block->millimeters);
+  float v_allowable = max_allowable_speed(-block->acceleration,MINIMUM_PLANNER_SPEED,block->millimeters);
   block->entry_speed = min(vmax_junction, v_allowable);
 
   // Initialize planner efficiency flags
@@ -470,41 +1039,163 @@ void plan_buffer_line(float x, float y, float z, float feed_rate, uint8_t invert
   // Update previous path unit_vector and nominal speed
   memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
   pl.previous_nominal_speed = block->nominal_speed;
+  pl.previous_millimeters = block->millimeters;
   
   // Update buffer head and next buffer head indices
   block_buffer_head = next_buffer_head;  
   next_buffer_head = next_block_index(block_buffer_head);
   
   // Update planner position
-  memcpy(pl.position, target, sizeof(target)); // pl.position[] = target[]
+  memcpy(pl.position, target_steps, sizeof(target_steps)); // pl.position[] = target_steps[]
 
   planner_recalculate(); 
 }
 
+// Add a synchronized event to the buffer. The stepper subsystem executes it once all the motion
+// buffered before it has been executed. Spindle and coolant events leave the look-ahead untouched,
+// so the motion plan continues across them. A dwell is prepped by the stepper segment generator like
+// a cruising block, of one step-less step event per acceleration tick, so it takes no extra code 
+// there and pauses and resumes with a feed hold. The motion before a dwell comes to a stop.
+// NOTE: Assumes buffer is available. Buffer checks are handled at a higher level by motion_control.
+void plan_buffer_sync_event(uint8_t event, float value)
+{
+  block_t *block = &block_buffer[block_buffer_head];
+  block->sync_event = event;
+  block->millimeters = 0.0; // No travel. Reported with zero feed rate.
+  if (event == PLAN_EVENT_DWELL) {
+    block->step_event_count = lround(value*ACCELERATION_TICKS_PER_SECOND);
+    if (block->step_event_count == 0) { return; } // Bail if this is a zero-length dwell
+    memset(block->steps, 0, sizeof(block->steps));
+    pl.previous_nominal_speed = 0.0; // Plan the next motion from a stop.
+  } else {
+    block->step_event_count = 0;
+    block->event_value = value; // Spindle direction or coolant mode
+  }
+
+  // Event blocks are never planned. If no motion block is pending, keep the optimally planned 
+  // block pointer at the buffer head.
+  if (block_buffer_planned == block_buffer_head) { block_buffer_planned = next_buffer_head; }
+  
+  // Update buffer head and next buffer head indices
+  block_buffer_head = next_buffer_head;  
+  next_buffer_head = next_block_index(block_buffer_head);
+}
+
+// Sets the G64 junction blending tolerance of all following blocks. Zero selects exact path mode G61.
+void plan_set_path_tolerance(float tolerance)
+{
+  pl.path_tolerance = tolerance;
+}
+
 // Reset the planner position vector (in steps). Called by the system abort routine.
-void plan_set_current_position(int32_t x, int32_t y, int32_t z)
+void plan_set_current_position(int32_t *position)
 {
-  pl.position[X_AXIS] = x;
-  pl.position[Y_AXIS] = y;
-  pl.position[Z_AXIS] = z;
+  memcpy(pl.position, position, sizeof(pl.position)); // pl.position[] = position[]
 }
 
 // Re-initialize buffer plan with a partially completed block, assumed to exist at the buffer tail.
 // Called after a steppers have come to a complete stop for a feed hold and the cycle is stopped.
+// NOTE: step_events_remaining are the block steps not yet prepped into stepper segments.
 void plan_cycle_reinitialize(int32_t step_events_remaining) 
 {
-  block_t *block = &block_buffer[block_buffer_tail]; // Point to partially completed block
+  uint8_t block_index = block_buffer_tail;
+  block_t *block = &block_buffer[block_index]; // Point to partially completed block
   
-  // Only remaining millimeters and step_event_count need to be updated for planner recalculate. 
-  // Other variables (step_x, step_y, step_z, rate_delta, etc.) all need to remain the same to
-  // ensure the original planned motion is resumed exactly.
-  block->millimeters = (block->millimeters*step_events_remaining)/block->step_event_count;
-  block->step_event_count = step_events_remaining;
+  // A partially completed dwell only resumes its remaining ticks. Replan from the motion block after
+  // any event blocks at the buffer tail, which starts from rest just the same.
+  if (block->sync_event) {
+    block->step_event_count = step_events_remaining;
+    while ((block_index != block_buffer_head) && block_buffer[block_index].sync_event) {
+      block_index = next_block_index( block_index );
+    }
+    block_buffer_planned = block_index;
+    if (block_index == block_buffer_head) { return; } // No motion to replan.
+    block = &block_buffer[block_index];
+  } else {
+    // Only remaining millimeters and step_event_count need to be updated for planner recalculate. 
+    // Other variables (steps[], acceleration, etc.) all need to remain the same to
+    // ensure the original planned motion is resumed exactly.
+    block->millimeters = (block->millimeters*step_events_remaining)/block->step_event_count;
+    block->step_event_count = step_events_remaining;
+  }
   
   // Re-plan from a complete stop. Reset planner entry speeds and flags.
   block->entry_speed = 0.0;
-  block->max_entry_speed = 0.0;
+  block->max_junction_speed = 0.0;
+  block->junction_fixed_flag = true;
   block->nominal_length_flag = false;
   block->recalculate_flag = true;
+  block_buffer_planned = block_index; // Replan the whole buffer from the stop.
   planner_recalculate();  
 }
+
+
+// Rescales the nominal speeds of all blocks in the buffer to the current feed and rapid override 
+// values and replans the buffer, without flushing it. Called by the stepper subsystem upon an
+// override command, which passes the step events not yet prepped and the step rate of the last
+// prepped segment, if the first block is partially completed. Otherwise, step_events_remaining is
+// zero. Either way, the entry speed of the first block is already being executed and can not change. 
+// NOTE: A reduced nominal speed may be lower than speeds already committed to by the first block.
+// Junctions are then planned no lower than the deceleration from the first block entry speed. Such a
+// block decelerates to its nominal speed at the start, which the trapezoid generator and stepper 
+// segment generator both handle. The prior plan was able to decelerate at least as quickly, so this 
+// never exceeds a junction speed limit or the deceleration needed to stop at the end of the buffer.
+void plan_update_overrides(int32_t step_events_remaining, uint32_t current_rate)
+{
+  uint8_t block_index = block_buffer_tail;
+  if (block_index == block_buffer_head) { return; }
+  block_t *previous = NULL;
+  block_t *block = &block_buffer[block_index];
+  if (block->sync_event) { step_events_remaining = 0; } // A partially completed dwell has no speed.
+  
+  // Truncate the partially completed block to its remaining steps, as plan_cycle_reinitialize() 
+  // does, and start it at the current speed.
+  if (step_events_remaining) {
+    block->millimeters = (block->millimeters*step_events_remaining)/block->step_event_count;
+    block->step_event_count = step_events_remaining;
+    block->entry_speed = (current_rate*block->millimeters)/block->step_event_count;
+    block->max_junction_speed = block->entry_speed;
+    block->junction_fixed_flag = true;
+    block->nominal_length_flag = false;
+  }
+  
+  while (block_index != block_buffer_head) {
+    block = &block_buffer[block_index];
+    block_index = next_block_index( block_index );
+    if (block->sync_event) { continue; } // Transparent to the look-ahead.
+    float programmed_speed = block_programmed_speed(block);
+    float max_speed = block_max_speed(block);
+    uint8_t override = sys.feed_override;
+    if (block->rapid_motion_flag) { override = sys.rapid_override; }
+    block->override = limit_override_by_max_speed(override, programmed_speed, max_speed);
+    block->nominal_speed = min(programmed_speed*block->override/100.0, max_speed);
+    if (previous || !step_events_remaining) {
+      block->nominal_length_flag = (block->nominal_speed <= 
+        max_allowable_speed(-block->acceleration,MINIMUM_PLANNER_SPEED,block->millimeters));
+    }
+    if (previous) {
+      // Do not plan the junction below the deceleration from the previous junction speed, which
+      // is planned by the forward pass from the fixed first block entry speed. If the nominal speeds
+      // no longer allow it, the junction speed limit is fixed at it. This is never above the 
+      // cornering limit, as the prior plan decelerated at least as quickly.
+      float v_decelerate = 
+        min_reachable_speed(previous->acceleration,previous->entry_speed,previous->millimeters);
+      if ((v_decelerate > 0.0) && (max_entry_speed(previous,block) < v_decelerate)) { 
+        block->max_junction_speed = v_decelerate;
+        block->junction_fixed_flag = true;
+      }
+      block->entry_speed = min(block->entry_speed,max_entry_speed(previous,block));
+      if (block->entry_speed < v_decelerate) { block->entry_speed = v_decelerate; }
+    }
+    block->recalculate_flag = true;
+    previous = block;
+  }
+  if (previous == NULL) { return; } // Only event blocks. Nothing to replan.
+  if (pl.previous_nominal_speed > 0.0) { pl.previous_nominal_speed = previous->nominal_speed; }
+
+  // Replan the whole buffer, from the first motion block.
+  block_index = block_buffer_tail;
+  while (block_buffer[block_index].sync_event) { block_index = next_block_index( block_index ); }
+  block_buffer_planned = block_index;
+  planner_recalculate();
+}
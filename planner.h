@@ -29,46 +29,116 @@
 
 #ifndef planner_h
 #define planner_h
+
+#include "nuts_bolts.h"
                  
-// The number of linear motions that can be in the plan at any give time
+// The number of linear motions that can be in the plan at any give time. Each block takes 40 bytes with
+// 3 axes. With the default config.h, this leaves about 380 bytes of the 2KB RAM of the 328p as 
+// headroom for the stack.
 #ifndef BLOCK_BUFFER_SIZE
   #define BLOCK_BUFFER_SIZE 18
 #endif
 
 // This struct is used when buffering the setup for each linear movement "nominal" values are as specified in 
 // the source g-code and may never actually be reached if acceleration management is active.
+// NOTE: The block buffer is the largest user of RAM, so nothing is stored that is cheaply derived from 
+// the other fields, such as the initial rate, and the planner flags are packed into a single byte.
 typedef struct {
 
   // Fields used by the bresenham algorithm for tracing the line
   uint8_t  direction_bits;            // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-  uint32_t steps_x, steps_y, steps_z; // Step count along each axis
+  uint32_t steps[N_AXIS];             // Step count along each axis
   int32_t  step_event_count;          // The number of step events required to complete this block
 
   // Fields used by the motion planner to manage acceleration
-  float nominal_speed;               // The nominal speed for this block in mm/min  
+  float nominal_speed;               // The nominal speed for this block in mm/min, with overrides applied
   float entry_speed;                 // Entry speed at previous-current block junction in mm/min
-  float max_entry_speed;             // Maximum allowable junction entry speed in mm/min
+  float max_junction_speed;          // Junction entry speed limit in mm/min by cornering acceleration only
   float millimeters;                 // The total travel of this block in mm
-  uint8_t recalculate_flag;           // Planner flag to recalculate trapezoids on entry junction
-  uint8_t nominal_length_flag;        // Planner flag for nominal speed always reached
+  float acceleration;                // Path acceleration in mm/min^2, limited by the axis accelerations
+  uint8_t recalculate_flag : 1;       // Planner flag to recalculate trapezoids on entry junction
+  uint8_t nominal_length_flag : 1;    // Planner flag for nominal speed always reached
+  uint8_t rapid_motion_flag : 1;      // Flags a seek motion, scaled by the rapid rather than the feed override
+  uint8_t sync_event : 2;             // Synchronized event type of a non-motion block. Zero for motion blocks.
+  uint8_t trapezoid_flag : 1;         // Flags a changed trapezoid for plan_get_current_trapezoid()
+  uint8_t junction_fixed_flag : 1;    // Flags the junction speed limit as not limited by the nominal speeds
+  uint8_t override;                   // The feed or rapid override percent applied to the nominal speed
+  int8_t event_value;                 // Spindle direction or coolant mode of a spindle or coolant event block
+
+  // The trapezoid generator settings are derived from these. See plan_get_rate_delta() and
+  // plan_get_current_trapezoid().
+
+} block_t;
 
-  // Settings for the trapezoid generator
-  uint32_t initial_rate;              // The step rate at start of block  
+// The trapezoid of the executing block, i.e. its nominal and final step rates and the step indices of
+// its acceleration and deceleration phases. Only the stepper segment generator needs them, and only 
+// for the block it is prepping, so they are computed from its speeds on demand rather than stored in
+// every block. See plan_get_current_trapezoid().
+typedef struct {
+  uint32_t nominal_rate;              // The nominal step rate for this block in step_events/minute
   uint32_t final_rate;                // The step rate at end of block
-  int32_t rate_delta;                 // The steps/minute to add or subtract when changing speed (must be positive)
   uint32_t accelerate_until;          // The index of the step event on which to stop acceleration
   uint32_t decelerate_after;          // The index of the step event on which to start decelerating
-  uint32_t nominal_rate;              // The nominal step rate for this block in step_events/minute
-
-} block_t;
+} plan_trapezoid_t;
+
+// Synchronized event types. Event blocks are queued in the planner buffer in program order with the 
+// motion blocks, so the stepper subsystem executes them exactly where they fall in the motion stream,
+// rather than the planner buffer being drained for them. Spindle and coolant events take no time and
+// are transparent to the look-ahead. A dwell is a block of step-less acceleration ticks, which the
+// motion before it decelerates to a stop for. Besides the sync_event type, a spindle or coolant event 
+// block only uses the event_value, and a dwell only the step_event_count (dwell ticks). Both have zero
+// millimeters and no steps.
+#define PLAN_EVENT_SPINDLE 1 // Spindle direction, 1 = CW, -1 = CCW, 0 = Stop
+#define PLAN_EVENT_COOLANT 2 // Coolant mode. See coolant_control.h
+#define PLAN_EVENT_DWELL   3 // Dwell time in seconds
+
+// Planner buffer telemetry for the status report. Shows whether a stuttering job is starved of
+// blocks by the serial stream and parser, or limited by the planner itself.
+typedef struct {
+  uint16_t underruns;             // Times the segment prep ran out of planner blocks during a cycle
+  uint8_t min_depth;              // Fewest blocks in the planner buffer, when a block started prepping
+  uint8_t max_recalculate_ticks;  // Longest planner_recalculate(), in timebase ticks of 1024 CPU cycles
+} plan_telemetry_t;
+extern plan_telemetry_t plan_telemetry;
+
+#ifdef ENABLE_CYCLE_TIME_ESTIMATE
+  // The number of feed rates the cycle time estimate is broken down by. The time of any further 
+  // feed rates, such as the changing feed rates of inverse time motions, is summed up as other.
+  #ifndef ESTIMATE_FEED_RATES
+    #define ESTIMATE_FEED_RATES 4
+  #endif
+
+  // Cycle time estimate of the '$T' estimate mode, accumulated from the trapezoids of the blocks
+  // as planned for execution. Times in seconds, feed rates as programmed in mm/min.
+  typedef struct {
+    float feed_rate[ESTIMATE_FEED_RATES];  // Programmed feed rates in order of appearance
+    float feed_time[ESTIMATE_FEED_RATES];  // Time at each feed rate
+    float other_time;                      // Time at feed rates beyond the breakdown
+    float rapid_time;                      // Time of seek motions
+    float dwell_time;                      // Time of dwells
+  } plan_estimate_t;
+  extern plan_estimate_t plan_estimate;
+#endif
       
 // Initialize the motion plan subsystem      
 void plan_init();
 
-// Add a new linear movement to the buffer. x, y and z is the signed, absolute target position in 
-// millimaters. Feed rate specifies the speed of the motion. If feed rate is inverted, the feed
-// rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
-void plan_buffer_line(float x, float y, float z, float feed_rate, uint8_t invert_feed_rate);
+#ifdef FIXED_POINT_COORDINATES
+  // Update the fixed-point step scale of the axes from the steps/mm settings. Called by plan_init()
+  // and upon any settings change.
+  void plan_update_step_scale();
+#endif
+
+// Add a new linear movement to the buffer. target[N_AXIS] is the signed, absolute target position 
+// in parser coordinates, i.e. millimeters or fixed point. See coord_t. Feed rate specifies the speed
+// of the motion. If feed rate is inverted, the feed rate is taken to mean "frequency" and would 
+// complete the operation in 1/feed_rate minutes. A negative feed rate indicates a seek motion at the
+// default seek rate.
+void plan_buffer_line(coord_t *target, float feed_rate, uint8_t invert_feed_rate);
+
+// Add a synchronized event to the buffer, executed after all motions buffered before it.
+// NOTE: Assumes buffer is available, as plan_buffer_line() does.
+void plan_buffer_sync_event(uint8_t event, float value);
 
 // Called when the current block is no longer needed. Discards the block and makes the memory
 // availible for new blocks.
@@ -77,19 +147,57 @@ void plan_discard_current_block();
 // Gets the current block. Returns NULL if buffer empty
 block_t *plan_get_current_block();
 
+// Returns the step rate at the start of the block, by its planned entry speed
+uint32_t plan_get_initial_rate(block_t *block);
+
+// Returns the step rate change per acceleration tick of the block, by its acceleration
+uint32_t plan_get_rate_delta(block_t *block);
+
+// Computes the trapezoid of the current block, by its entry speed and that of the next motion block,
+// and clears its trapezoid flag. The planner sets the flag whenever either junction speed changes.
+void plan_get_current_trapezoid(plan_trapezoid_t *trapezoid);
+
+#ifdef JERK_LIMITED_ACCELERATION
+  // Returns the highest speed, from or to which an S-curve ramp at the acceleration and jerk reaches
+  // the given speed within the distance, in any consistent units. A zero jerk ramps linearly.
+  float plan_ramp_max_speed(float speed, float distance, float acceleration, float jerk);
+#endif
+
+// Set the G64 junction blending tolerance in mm. Zero selects exact path mode G61.
+void plan_set_path_tolerance(float tolerance);
+
 // Reset the planner position vector (in steps)
-void plan_set_current_position(int32_t x, int32_t y, int32_t z);
+void plan_set_current_position(int32_t *position);
 
 // Reinitialize plan with a partially completed block
 void plan_cycle_reinitialize(int32_t step_events_remaining);
 
+// Rescale the nominal speeds of all blocks in the buffer to the current feed and rapid overrides 
+// and replan. If partially completed, the first block is replanned from the given step rate.
+void plan_update_overrides(int32_t step_events_remaining, uint32_t current_rate);
+
 // Reset buffer
 void plan_reset_buffer();
 
 // Returns the status of the block ring buffer. True, if buffer is full.
 uint8_t plan_check_full_buffer();
 
+// Returns the number of free blocks in the block ring buffer.
+uint8_t plan_get_block_buffer_available();
+
+// Returns the number of blocks in the block ring buffer.
+uint8_t plan_get_block_buffer_count();
+
+// Restarts the minimum depth and maximum recalculate time telemetry. Underruns keep counting.
+void plan_reset_telemetry();
+
 // Block until all buffered steps are executed
 void plan_synchronize();
 
+#ifdef ENABLE_CYCLE_TIME_ESTIMATE
+  // Adds the time of the current block to the cycle time estimate and discards it. Takes the place
+  // of the stepper subsystem in the '$T' estimate mode.
+  void plan_estimate_current_block();
+#endif
+
 #endif
@@ -109,30 +109,14 @@ void printInteger(long n)
   print_uint32_base10(n);
 }
 
-// Convert float to string by immediately converting to a long integer, which contains
-// more digits than a float. Number of decimal places, which are tracked by a counter,
-// may be set by the user. The integer is then efficiently converted to a string.
+// Prints an unsigned fixed-point integer with settings.decimal_places decimal places.
 // NOTE: AVR '%' and '/' integer operations are very efficient. Bitshifting speed-up 
 // techniques are actually just slightly slower. Found this out the hard way.
-void printFloat(float n)
+static void print_uint32_fixed(uint32_t a)
 {
-  if (n < 0) {
-    serial_write('-');
-    n = -n;
-  }
-
-  uint8_t decimals = settings.decimal_places;
-  while (decimals >= 2) { // Quickly convert values expected to be E0 to E-4.
-    n *= 100;
-    decimals -= 2;
-  }
-  if (decimals) { n *= 10; }
-  n += 0.5; // Add rounding factor. Ensures carryover through entire value.
-    
   // Generate digits backwards and store in string.
-  unsigned char buf[10]; 
+  unsigned char buf[12]; 
   uint8_t i = 0;
-  uint32_t a = (long)n;  
   buf[settings.decimal_places] = '.'; // Place decimal point, even if decimal places are zero.
   while(a > 0) {
     if (i == settings.decimal_places) { i++; } // Skip decimal point location
@@ -151,3 +135,51 @@ void printFloat(float n)
   for (; i > 0; i--)
     serial_write(buf[i-1]);
 }
+
+// Convert float to string by immediately converting to a long integer, which contains
+// more digits than a float. Number of decimal places, which are tracked by a counter,
+// may be set by the user. The integer is then efficiently converted to a string.
+void printFloat(float n)
+{
+  if (n < 0) {
+    serial_write('-');
+    n = -n;
+  }
+
+  uint8_t decimals = settings.decimal_places;
+  while (decimals >= 2) { // Quickly convert values expected to be E0 to E-4.
+    n *= 100;
+    decimals -= 2;
+  }
+  if (decimals) { n *= 10; }
+  n += 0.5; // Add rounding factor. Ensures carryover through entire value.
+  print_uint32_fixed((long)n);
+}
+
+void printFixed(long n)
+{
+  if (n < 0) {
+    serial_write('-');
+    n = -n;
+  }
+  print_uint32_fixed(n);
+}
+
+uint8_t printFixedLength(long n)
+{
+  uint8_t length = 1; // Decimal point
+  if (n < 0) {
+    length++;
+    n = -n;
+  }
+  // Count the digits, with at least one before the decimal point.
+  uint8_t digits = 1;
+  uint32_t a = n;
+  uint32_t p = 10;
+  while ((digits < 10) && (a >= p)) { 
+    digits++; 
+    p *= 10; 
+  }
+  if (digits <= settings.decimal_places) { digits = settings.decimal_places+1; }
+  return(length+digits);
+}
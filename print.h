@@ -40,4 +40,11 @@ void print_uint8_base2(uint8_t n);
 
 void printFloat(float n);
 
+// Prints a fixed-point integer in units of the last of settings.decimal_places, i.e. with the
+// same format as printFloat().
+void printFixed(long n);
+
+// Returns the number of characters printFixed() prints for the given value.
+uint8_t printFixedLength(long n);
+
 #endif
\ No newline at end of file
@@ -35,15 +35,30 @@
 #include "print.h"
 #include "settings.h"
 #include "config.h"
+#include "hal.h"
 #include "nuts_bolts.h"
 #include "stepper.h"
 #include "report.h"
 #include "motion_control.h"
+#include "planner.h"
 
 static char line[LINE_BUFFER_SIZE]; // Line to be executed. Zero-terminated.
 static uint8_t char_counter; // Last character counter in line variable.
 static uint8_t iscomment; // Comment/block delete flag for processor to ignore comment characters.
 
+#ifdef ENABLE_BINARY_STREAM
+  // Binary motion stream state. The records are read into the line buffer, as lines are.
+  static uint8_t binary_mode;   // Set by '$B'. Incoming data is read as binary records.
+  static uint8_t binary_frame;  // Flags a frame start was received and its record is being read.
+  static uint8_t binary_escape; // Flags the next frame byte is escaped.
+#endif
+
+// Automatic status report state. The system time the next report is due, and the machine state and
+// position of the last report, which the $40 setting compares to skip unchanged reports.
+static uint32_t auto_report_time;
+static uint8_t auto_report_state;
+static int32_t auto_report_position[N_AXIS];
+
 
 static void protocol_reset_line_buffer()
 {
@@ -55,12 +70,13 @@ static void protocol_reset_line_buffer()
 void protocol_init() 
 {
   protocol_reset_line_buffer();
+  #ifdef ENABLE_BINARY_STREAM
+    binary_mode = false; // Reset to g-code, so a host can always recover with a reset.
+  #endif
   report_init_message(); // Welcome message   
+  auto_report_state = 0xff; // Report upon the next interval, even if unchanged since before the reset.
   
-  PINOUT_DDR &= ~(PINOUT_MASK); // Set as input pins
-  PINOUT_PORT |= PINOUT_MASK; // Enable internal pull-up resistors. Normal high operation.
-  PINOUT_PCMSK |= PINOUT_MASK;   // Enable specific pins of the Pin Change Interrupt
-  PCICR |= (1 << PINOUT_INT);   // Enable Pin Change Interrupt
+  hal_pinout_init(); // Set as input pins with pull-ups and enable their pin change interrupt.
 }
 
 // Executes user startup script, if stored.
@@ -83,20 +99,46 @@ void protocol_execute_startup()
 // only the runtime command execute variable to have the main program execute these when 
 // its ready. This works exactly like the character-based runtime commands when picked off
 // directly from the incoming serial data stream.
-ISR(PINOUT_INT_vect) 
+ISR(HAL_PINOUT_vect) 
 {
   // Enter only if any pinout pin is actively low.
-  if ((PINOUT_PIN & PINOUT_MASK) ^ PINOUT_MASK) { 
-    if (bit_isfalse(PINOUT_PIN,bit(PIN_RESET))) {
+  uint8_t pin = hal_pinout_read();
+  if ((pin & PINOUT_MASK) ^ PINOUT_MASK) { 
+    if (bit_isfalse(pin,bit(PIN_RESET))) {
       mc_reset();
-    } else if (bit_isfalse(PINOUT_PIN,bit(PIN_FEED_HOLD))) {
+    } else if (bit_isfalse(pin,bit(PIN_FEED_HOLD))) {
       sys.execute |= EXEC_FEED_HOLD; 
-    } else if (bit_isfalse(PINOUT_PIN,bit(PIN_CYCLE_START))) {
+    } else if (bit_isfalse(pin,bit(PIN_CYCLE_START))) {
       sys.execute |= EXEC_CYCLE_START;
     }
   }
 }
 
+// Pushes a status report every $39 milliseconds, as if the host had polled with '?'. The reports are
+// scheduled by the system timebase, so they stay evenly spaced however the main program is busy,
+// except if the TX buffer is too full, when the report is sent as soon as there is room. With the 
+// $40 setting, a due report is skipped while the state and machine position are as last reported.
+static void protocol_auto_report()
+{
+  uint32_t time = sys_get_time();
+  if ((int32_t)(time-auto_report_time) < 0) { return; } // Not yet due.
+  int32_t position[N_AXIS];
+  cli(); // Atomic copy, since the stepper interrupt updates the position.
+  memcpy(position,sys.position,sizeof(sys.position));
+  sei();
+  if (bit_isfalse(settings.flags,BITFLAG_AUTO_REPORT_ON_CHANGE) || (sys.state != auto_report_state) ||
+      memcmp(position,auto_report_position,sizeof(position))) {
+    if (!report_realtime_status()) { return; } // Still due. Retry once the TX buffer has room.
+    auto_report_state = sys.state;
+    memcpy(auto_report_position,position,sizeof(position));
+  }
+  // Schedule one interval after the due time, or after now, if more than an interval behind.
+  uint32_t interval = ((uint32_t)settings.status_report_interval*HAL_TIMEBASE_PER_SECOND)/1000;
+  auto_report_time += interval;
+  if ((int32_t)(time-auto_report_time) >= 0) { auto_report_time = time+interval; }
+}
+
+
 // Executes run-time commands, when required. This is called from various check points in the main
 // program, primarily where there may be a while loop waiting for a buffer to clear space or any
 // point where the execution time from the last check point may be more than a fraction of a second.
@@ -110,6 +152,15 @@ ISR(PINOUT_INT_vect)
 // limit switches, or the main program.
 void protocol_execute_runtime()
 {
+  // Keep the stepper segment buffer full. This is the only place the main program feeds the 
+  // stepper subsystem, since this function is called from every main program wait loop.
+  st_prep_buffer();
+  #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+    // In the estimate mode, time the oldest block in place of the stepper subsystem, once the planner
+    // buffer is full, so every block is estimated with a full look-ahead, as when streaming a job.
+    if ((sys.state == STATE_ESTIMATE) && plan_check_full_buffer()) { plan_estimate_current_block(); }
+  #endif
+
   if (sys.execute) { // Enter only if any bit flag is true
     uint8_t rt_exec = sys.execute; // Avoid calling volatile multiple times
     
@@ -146,10 +197,9 @@ void protocol_execute_runtime()
       return; // Nothing else to do but exit.
     }
     
-    // Execute and serial print status
+    // Execute and serial print status. Stays flagged until there is room to send it.
     if (rt_exec & EXEC_STATUS_REPORT) { 
-      report_realtime_status();
-      bit_false(sys.execute,EXEC_STATUS_REPORT);
+      if (report_realtime_status()) { bit_false(sys.execute,EXEC_STATUS_REPORT); }
     }
     
     // Initiate stepper feed hold
@@ -158,6 +208,13 @@ void protocol_execute_runtime()
       bit_false(sys.execute,EXEC_FEED_HOLD);
     }
     
+    // Cancel jog. Decelerates to a stop like a feed hold. The remaining jog motions are flushed,
+    // once stopped. Ignored if not jogging.
+    if (rt_exec & EXEC_JOG_CANCEL) {
+      if (sys.state == STATE_JOG) { st_feed_hold(); }
+      bit_false(sys.execute,EXEC_JOG_CANCEL);
+    }
+    
     // Reinitializes the stepper module running state and, if a feed hold, re-plans the buffer.
     // NOTE: EXEC_CYCLE_STOP is set by the stepper subsystem when a cycle or feed hold completes.
     if (rt_exec & EXEC_CYCLE_STOP) {
@@ -174,11 +231,48 @@ void protocol_execute_runtime()
     }
   }
   
-  // Overrides flag byte (sys.override) and execution should be installed here, since they 
-  // are runtime and require a direct and controlled interface to the main stepper program.
+  // Execute feed and rapid overrides. Updates the override values and, if changed, rescales and 
+  // replans the blocks in the planner buffer through the stepper subsystem, which knows how far 
+  // the first block has been executed.
+  if (sys.override) {
+    uint8_t rt_override = sys.override; // Avoid calling volatile multiple times
+    bit_false(sys.override,rt_override);
+    
+    int16_t new_feed_override = sys.feed_override;
+    if (rt_override & EXEC_FEED_OVR_RESET) { new_feed_override = 100; }
+    if (rt_override & EXEC_FEED_OVR_COARSE_PLUS) { new_feed_override += FEED_OVERRIDE_COARSE_INCREMENT; }
+    if (rt_override & EXEC_FEED_OVR_COARSE_MINUS) { new_feed_override -= FEED_OVERRIDE_COARSE_INCREMENT; }
+    if (rt_override & EXEC_FEED_OVR_FINE_PLUS) { new_feed_override += FEED_OVERRIDE_FINE_INCREMENT; }
+    if (rt_override & EXEC_FEED_OVR_FINE_MINUS) { new_feed_override -= FEED_OVERRIDE_FINE_INCREMENT; }
+    new_feed_override = min(new_feed_override,MAX_FEED_OVERRIDE);
+    new_feed_override = max(new_feed_override,MIN_FEED_OVERRIDE);
+    
+    uint8_t new_rapid_override = sys.rapid_override;
+    if (rt_override & EXEC_RAPID_OVR_RESET) { new_rapid_override = 100; }
+    if (rt_override & EXEC_RAPID_OVR_MEDIUM) { new_rapid_override = RAPID_OVERRIDE_MEDIUM; }
+    if (rt_override & EXEC_RAPID_OVR_LOW) { new_rapid_override = RAPID_OVERRIDE_LOW; }
+    
+    if ((new_feed_override != sys.feed_override) || (new_rapid_override != sys.rapid_override)) {
+      sys.feed_override = new_feed_override;
+      sys.rapid_override = new_rapid_override;
+      st_update_overrides();
+    }
+  }
+  
+  if (settings.status_report_interval) { protocol_auto_report(); }
 }  
 
 
+// Waits until any jog in progress is complete or cancelled. 
+static void protocol_jog_synchronize()
+{
+  while (sys.state == STATE_JOG || sys.jog_cancel) {
+    protocol_execute_runtime();
+    if (sys.abort) { return; }
+  }
+}
+
+
 // Directs and executes one line of formatted input from protocol_process. While mostly
 // incoming streaming g-code blocks, this also executes Grbl internal commands, such as 
 // settings, initiating the homing cycle, and toggling switch states. This differs from
@@ -192,6 +286,10 @@ uint8_t protocol_execute_line(char *line)
   // Grbl internal command and parameter lines are of the form '$4=374.3' or '$' for help  
   if(line[0] == '$') {
     
+    mc_arc_synchronize(); // Complete any pending arc motion before executing Grbl commands.
+    mc_line_synchronize();
+    if (sys.abort) { return(STATUS_OK); }
+
     uint8_t char_counter = 1; 
     uint8_t helper_var = 0; // Helper variable
     float parameter, value;
@@ -223,6 +321,23 @@ uint8_t protocol_execute_line(char *line)
           report_feedback_message(MESSAGE_ENABLED);
         }
         break; 
+      #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+        case 'T' : // Set cycle time estimate mode
+          if ( line[++char_counter] != 0 ) { return(STATUS_UNSUPPORTED_STATEMENT); }
+          // As the check g-code mode, but toggling off first reports the estimate of all motions
+          // so far. A reset restores the parser and planner positions, which the motions moved.
+          if ( sys.state == STATE_ESTIMATE ) { 
+            plan_synchronize();
+            report_cycle_time_estimate();
+            mc_reset(); 
+            report_feedback_message(MESSAGE_DISABLED);
+          } else {
+            if (sys.state) { return(STATUS_IDLE_ERROR); }
+            sys.state = STATE_ESTIMATE;
+            report_feedback_message(MESSAGE_ENABLED);
+          }
+          break; 
+      #endif
       case 'X' : // Disable alarm lock
         if ( line[++char_counter] != 0 ) { return(STATUS_UNSUPPORTED_STATEMENT); }
         if (sys.state == STATE_ALARM) { 
@@ -240,18 +355,31 @@ uint8_t protocol_execute_line(char *line)
           } else { return(STATUS_IDLE_ERROR); }
         } else { return(STATUS_SETTING_DISABLED); }
         break;
-//    case 'J' : break;  // Jogging methods
-      // TODO: Here jogging can be placed for execution as a seperate subprogram. It does not need to be 
-      // susceptible to other runtime commands except for e-stop. The jogging function is intended to
-      // be a basic toggle on/off with controlled acceleration and deceleration to prevent skipped 
-      // steps. The user would supply the desired feedrate, axis to move, and direction. Toggle on would
-      // start motion and toggle off would initiate a deceleration to stop. One could 'feather' the
-      // motion by repeatedly toggling to slow the motion to the desired location. Location data would 
-      // need to be updated real-time and supplied to the user through status queries.
-      //   More controlled exact motions can be taken care of by inputting G0 or G1 commands, which are 
-      // handled by the planner. It would be possible for the jog subprogram to insert blocks into the
-      // block buffer without having the planner plan them. It would need to manage de/ac-celerations 
-      // on its own carefully. This approach could be effective and possibly size/memory efficient.
+      #ifdef STEPPER_ISR_STATS
+        case 'S' : // Print and clear stepper interrupt timing statistics
+          if ( line[++char_counter] != 0 ) { return(STATUS_UNSUPPORTED_STATEMENT); }
+          report_stepper_stats();
+          break;
+      #endif
+      #ifdef ENABLE_BINARY_STREAM
+        case 'B' : // Enter binary motion stream mode
+          if ( line[++char_counter] != 0 ) { return(STATUS_UNSUPPORTED_STATEMENT); }
+          binary_mode = true;
+          binary_frame = false;
+          break;
+      #endif
+      case 'J' : // Jog motion
+        if ( line[++char_counter] != '=' ) { return(STATUS_UNSUPPORTED_STATEMENT); }
+        // Finish stopping any cancelled jog, which flushes the planner, before queuing a new one.
+        while (sys.jog_cancel) {
+          protocol_execute_runtime();
+          if (sys.abort) { return(STATUS_OK); }
+        }
+        // Jogs only start when Grbl is idle with no g-code motions left, or join a running jog.
+        if ( (sys.state == STATE_IDLE && plan_get_current_block() == NULL) || 
+             sys.state == STATE_JOG || sys.state == STATE_CHECK_MODE ) {
+          return(gc_execute_jog_line(&line[++char_counter]));
+        } else { return(STATUS_IDLE_ERROR); }
       case 'N' : // Startup lines. 
         if ( line[++char_counter] == 0 ) { // Print startup lines
           for (helper_var=0; helper_var < N_STARTUP_LINE; helper_var++) {
@@ -291,17 +419,118 @@ uint8_t protocol_execute_line(char *line)
     return(STATUS_OK); // If '$' command makes it to here, then everything's ok.
 
   } else {
+    protocol_jog_synchronize(); // G-code motions must not join a jog.
+    if (sys.abort) { return(STATUS_OK); }
     return(gc_execute_line(line));    // Everything else is gcode
   }
 }
 
 
+#ifdef ENABLE_BINARY_STREAM
+// Updates a CRC-16/CCITT checksum, polynomial 0x1021, with the next data byte.
+static uint16_t crc16_update(uint16_t crc, uint8_t data)
+{
+  uint8_t i;
+  crc ^= (uint16_t)data << 8;
+  for (i=0; i<8; i++) {
+    if (crc & 0x8000) { crc = (crc << 1) ^ 0x1021; }
+    else { crc <<= 1; }
+  }
+  return(crc);
+}
+
+// Executes a complete binary motion record in the line buffer. The record is the type byte, 
+// followed by the x, y, z target in absolute work coordinates and the feed rate in mm/min, as
+// little-endian int32 in units of 0.001, and the CRC-16 of these, initialized to 0xFFFF.
+static uint8_t protocol_execute_record()
+{
+  uint8_t i;
+  uint16_t crc = 0xffff;
+  for (i=0; i<BINARY_RECORD_SIZE-2; i++) { crc = crc16_update(crc,line[i]); }
+  if (crc != ((uint8_t)line[BINARY_RECORD_SIZE-2] | ((uint16_t)(uint8_t)line[BINARY_RECORD_SIZE-1] << 8))) { 
+    return(STATUS_BAD_CHECKSUM); 
+  }
+  
+  switch (line[0]) {
+    case BINARY_RECORD_END: binary_mode = false; return(STATUS_OK);
+    case BINARY_RECORD_SEEK: case BINARY_RECORD_LINEAR: break;
+    default: return(STATUS_UNSUPPORTED_STATEMENT);
+  }
+  if (sys.state == STATE_ALARM) { return(STATUS_ALARM_LOCK); }
+  protocol_jog_synchronize();
+  if (sys.abort) { return(STATUS_OK); }
+  
+  int32_t value[N_AXIS+1]; // Target and feed rate. Same byte order as the AVR.
+  memcpy(value,line+1,sizeof(value));
+  float feed_rate = -1.0; // Seek motion
+  if (line[0] == BINARY_RECORD_LINEAR) {
+    if (value[N_AXIS] <= 0) { return(STATUS_INVALID_STATEMENT); }
+    feed_rate = 0.001*value[N_AXIS];
+  }
+  
+  // Convert to machine coordinates and update the g-code parser position, as a G90 G0/G1 would,
+  // so g-code continues from the end of the binary stream.
+  #ifdef FIXED_POINT_COORDINATES
+    for (i=0; i<N_AXIS; i++) { 
+      gc.position[i] = value[i]*(COORD_PER_MM/1000) + gc.coord_system[i] + gc.coord_offset[i];
+    }
+  #else
+    for (i=0; i<N_AXIS; i++) { gc.position[i] = 0.001*value[i] + gc.coord_system[i] + gc.coord_offset[i]; }
+  #endif
+  mc_line(gc.position, feed_rate, false);
+  return(STATUS_OK);
+}
+
+// Reads the binary motion stream. Each record is sent as a frame, starting with the frame start
+// byte. Within a frame, the frame start, escape, and runtime command characters and 0xFF, which 
+// is the serial no-data value, are sent as the escape byte followed by the character XOR'ed with
+// 0x20. Any byte may be escaped this way. Data between frames is ignored, and a frame start before
+// the end of a record discards the record.
+static void protocol_process_binary(uint8_t c)
+{
+  if (c == BINARY_FRAME_START) {
+    if (char_counter > 0) { report_status_message(STATUS_BAD_CHECKSUM); } // Truncated record
+    binary_frame = true;
+    binary_escape = false;
+    char_counter = 0;
+  } else if (binary_frame) {
+    if (c == BINARY_FRAME_ESCAPE) {
+      binary_escape = true;
+    } else {
+      if (binary_escape) {
+        c ^= 0x20;
+        binary_escape = false;
+      }
+      line[char_counter++] = c;
+      if (char_counter == BINARY_RECORD_SIZE) { // Record is complete. Then execute!
+        binary_frame = false;
+        char_counter = 0;
+        // Runtime command check point before executing record, as for a line.
+        protocol_execute_runtime();
+        if (sys.abort) { return; }
+        report_status_message(protocol_execute_record());
+      }
+    }
+  }
+}
+#endif
+
+
 // Process and report status one line of incoming serial data. Performs an initial filtering
 // by removing spaces and comments and capitalizing all letters.
 void protocol_process()
 {
   uint8_t c;
+  mc_line_continue(); // Plan any queued line motions and pending arc segments, as planner buffer
+  mc_arc_continue();  // space frees up.
   while((c = serial_read()) != SERIAL_NO_DATA) {
+    #ifdef ENABLE_BINARY_STREAM
+      if (binary_mode) {
+        protocol_process_binary(c);
+        if (sys.abort) { return; } // Bail to main program upon system abort
+        continue; // No arcs in binary mode. 
+      }
+    #endif
     if ((c == '\n') || (c == '\r')) { // End of line reached
 
       // Runtime command check point before executing line. Prevent any furthur line executions.
@@ -345,5 +574,8 @@ void protocol_process()
         }
       }
     }
+    mc_line_continue(); // Keep planning queued lines and generating a pending arc, while reading
+    mc_arc_continue();  // the next line.
   }
+  mc_line_continue(); // Out of serial data. Plan any pending merged line, if the planner runs low.
 }
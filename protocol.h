@@ -41,6 +41,14 @@
   #define LINE_BUFFER_SIZE 70
 #endif
 
+// Binary motion stream framing and record definitions. See doc/commands.txt.
+#define BINARY_FRAME_START  0xC0 // Starts every record frame.
+#define BINARY_FRAME_ESCAPE 0xDB // Precedes a frame byte sent XOR'ed with 0x20.
+#define BINARY_RECORD_SIZE  (1+4*(N_AXIS+1)+2) // Type byte, axes target and feed rate int32, CRC-16.
+#define BINARY_RECORD_END    0   // Leave binary motion stream mode.
+#define BINARY_RECORD_SEEK   1   // G0 straight line motion to target at the default seek rate.
+#define BINARY_RECORD_LINEAR 2   // G1 straight line motion to target at the record feed rate.
+
 // Initialize the serial protocol
 void protocol_init();
 
@@ -34,12 +34,32 @@
 */
 
 #include <avr/pgmspace.h>
+#include <avr/interrupt.h>
 #include "report.h"
 #include "print.h"
+#include "serial.h"
 #include "settings.h"
 #include "nuts_bolts.h"
 #include "gcode.h"
 #include "coolant_control.h"
+#include "planner.h"
+#include "stepper.h"
+
+// Realtime status report scale factors, from the machine position in steps and the work offsets
+// in mm to the printed fixed-point units, i.e. mm or inches in units of the last decimal place.
+static float status_step_scale[N_AXIS];
+static float status_mm_scale;
+static uint8_t status_length; // Length of the last status report.
+
+
+void report_init()
+{
+  uint8_t i;
+  status_mm_scale = 1.0;
+  for (i=0; i<settings.decimal_places; i++) { status_mm_scale *= 10; }
+  if (bit_istrue(settings.flags,BITFLAG_REPORT_INCHES)) { status_mm_scale *= INCH_PER_MM; }
+  for (i=0; i<N_AXIS; i++) { status_step_scale[i] = status_mm_scale/settings.steps_per_mm[i]; }
+}
 
 
 // Handles the primary confirmation protocol response for streaming interfaces and human-feedback.
@@ -48,12 +68,14 @@
 // operation. Errors events can originate from the g-code parser, settings module, or asynchronously
 // from a critical error, such as a triggered hard limit. Interface should always monitor for these
 // responses.
+// When enabled by the $24 setting, the response is followed by the free planner blocks and free
+// serial receive buffer bytes, i.e. 'ok Bf:17,127', so a streaming interface can keep both full.
 // NOTE: In silent mode, all error codes are greater than zero.
 // TODO: Install silent mode to return only numeric values, primarily for GUIs.
 void report_status_message(uint8_t status_code) 
 {
   if (status_code == 0) { // STATUS_OK
-    printPgmString(PSTR("ok\r\n"));
+    printPgmString(PSTR("ok"));
   } else {
     printPgmString(PSTR("error: "));
     switch(status_code) {          
@@ -83,9 +105,17 @@ void report_status_message(uint8_t status_code)
       printPgmString(PSTR("Alarm lock")); break;
       case STATUS_OVERFLOW:
       printPgmString(PSTR("Line overflow")); break;
+      case STATUS_BAD_CHECKSUM:
+      printPgmString(PSTR("Bad record checksum")); break;
     }
-    printPgmString(PSTR("\r\n"));
   }
+  if (bit_istrue(settings.flags,BITFLAG_REPORT_BUFFER_STATE)) {
+    printPgmString(PSTR(" Bf:"));
+    printInteger(plan_get_block_buffer_available());
+    printPgmString(PSTR(","));
+    printInteger(serial_get_rx_buffer_available());
+  }
+  printPgmString(PSTR("\r\n"));
 }
 
 // Prints alarm messages.
@@ -97,6 +127,8 @@ void report_alarm_message(int8_t alarm_code)
     printPgmString(PSTR("Hard limit")); break;
     case ALARM_ABORT_CYCLE: 
     printPgmString(PSTR("Abort during cycle")); break;
+    case ALARM_HOMING_FAIL: 
+    printPgmString(PSTR("Homing fail")); break;
   }
   printPgmString(PSTR(". MPos?\r\n"));
   delay_ms(500); // Force delay to ensure message clears serial write buffer.
@@ -144,10 +176,23 @@ void report_grbl_help() {
                       "$C (check gcode mode)\r\n"
                       "$X (kill alarm lock)\r\n"
                       "$H (run homing cycle)\r\n"
-                      "~ (cycle start)\r\n"
+                      "$J=line (jog)\r\n"));
+  #ifdef ENABLE_BINARY_STREAM
+    printPgmString(PSTR("$B (binary motion stream)\r\n"));
+  #endif
+  #ifdef STEPPER_ISR_STATS
+    printPgmString(PSTR("$S (view stepper timing)\r\n"));
+  #endif
+  #ifdef ENABLE_CYCLE_TIME_ESTIMATE
+    printPgmString(PSTR("$T (cycle time estimate mode)\r\n"));
+  #endif
+  printPgmString(PSTR("~ (cycle start)\r\n"
                       "! (feed hold)\r\n"
                       "? (current status)\r\n"
-                      "ctrl-x (reset Grbl)\r\n"));
+                      "ctrl-x (reset Grbl)\r\n"
+                      "0x85 (cancel jog)\r\n"
+                      "0x90-0x94 (feed override: 100%,+10%,-10%,+1%,-1%)\r\n"
+                      "0x95-0x97 (rapid override: 100%,50%,25%)\r\n"));
 }
 
 // Grbl global settings print out.
@@ -163,7 +208,7 @@ void report_grbl_settings() {
   printPgmString(PSTR(" (step port invert mask, int:")); print_uint8_base2(settings.invert_mask);  
   printPgmString(PSTR(")\r\n$7=")); printInteger(settings.stepper_idle_lock_time);
   printPgmString(PSTR(" (step idle delay, msec)\r\n$8=")); printFloat(settings.acceleration/(60*60)); // Convert from mm/min^2 for human readability
-  printPgmString(PSTR(" (acceleration, mm/sec^2)\r\n$9=")); printFloat(settings.junction_deviation);
+  printPgmString(PSTR(" (path acceleration, mm/sec^2)\r\n$9=")); printFloat(settings.junction_deviation);
   printPgmString(PSTR(" (junction deviation, mm)\r\n$10=")); printFloat(settings.mm_per_arc_segment);
   printPgmString(PSTR(" (arc, mm/segment)\r\n$11=")); printInteger(settings.n_arc_correction);
   printPgmString(PSTR(" (n-arc correction, int)\r\n$12=")); printInteger(settings.decimal_places);
@@ -178,10 +223,92 @@ void report_grbl_settings() {
   printPgmString(PSTR(" (homing feed, mm/min)\r\n$20=")); printFloat(settings.homing_seek_rate);
   printPgmString(PSTR(" (homing seek, mm/min)\r\n$21=")); printInteger(settings.homing_debounce_delay);
   printPgmString(PSTR(" (homing debounce, msec)\r\n$22=")); printFloat(settings.homing_pulloff);
-  printPgmString(PSTR(" (homing pull-off, mm)\r\n")); 
+  printPgmString(PSTR(" (homing pull-off, mm)\r\n$23=")); printFloat(settings.arc_tolerance);
+  printPgmString(PSTR(" (arc tolerance, mm)\r\n$24=")); printInteger(bit_istrue(settings.flags,BITFLAG_REPORT_BUFFER_STATE));
+  printPgmString(PSTR(" (buffer state in responses, bool)\r\n$25=")); printFloat(settings.max_rate[X_AXIS]);
+  printPgmString(PSTR(" (x max rate, mm/min)\r\n$26=")); printFloat(settings.max_rate[Y_AXIS]);
+  printPgmString(PSTR(" (y max rate, mm/min)\r\n$27=")); printFloat(settings.max_rate[Z_AXIS]);
+  printPgmString(PSTR(" (z max rate, mm/min)\r\n$28=")); printFloat(settings.max_acceleration[X_AXIS]/(60*60));
+  printPgmString(PSTR(" (x accel, mm/sec^2)\r\n$29=")); printFloat(settings.max_acceleration[Y_AXIS]/(60*60));
+  printPgmString(PSTR(" (y accel, mm/sec^2)\r\n$30=")); printFloat(settings.max_acceleration[Z_AXIS]/(60*60));
+  printPgmString(PSTR(" (z accel, mm/sec^2)\r\n$31=")); printInteger(settings.status_report_mask);
+  printPgmString(PSTR(" (status report mask, int:")); print_uint8_base2(settings.status_report_mask);
+  printPgmString(PSTR(")\r\n")); 
+  #if N_AXIS > 3
+    uint8_t idx;
+    for (idx=A_AXIS; idx<N_AXIS; idx++) {
+      uint8_t n = 32+3*(idx-A_AXIS);
+      char axis = 'a'+(idx-A_AXIS);
+      printPgmString(PSTR("$")); printInteger(n); 
+      printPgmString(PSTR("=")); printFloat(settings.steps_per_mm[idx]);
+      printPgmString(PSTR(" (")); serial_write(axis); printPgmString(PSTR(", step/unit)\r\n$")); printInteger(n+1); 
+      printPgmString(PSTR("=")); printFloat(settings.max_rate[idx]);
+      printPgmString(PSTR(" (")); serial_write(axis); printPgmString(PSTR(" max rate, unit/min)\r\n$")); printInteger(n+2); 
+      printPgmString(PSTR("=")); printFloat(settings.max_acceleration[idx]/(60*60));
+      printPgmString(PSTR(" (")); serial_write(axis); printPgmString(PSTR(" accel, unit/sec^2)\r\n"));
+    }
+  #endif
+  #ifdef JERK_LIMITED_ACCELERATION
+    printPgmString(PSTR("$38=")); printFloat(settings.jerk/(60.0*60*60));
+    printPgmString(PSTR(" (jerk, mm/sec^3)\r\n"));
+  #endif
+  printPgmString(PSTR("$39=")); printInteger(settings.status_report_interval);
+  printPgmString(PSTR(" (auto status report interval, msec)\r\n$40=")); 
+  printInteger(bit_istrue(settings.flags,BITFLAG_AUTO_REPORT_ON_CHANGE));
+  printPgmString(PSTR(" (auto report on change only, bool)\r\n"));
 }
 
 
+#ifdef STEPPER_ISR_STATS
+  // Prints the stepper interrupt timing statistics since the last '$S' and clears them. The cycle
+  // times are CPU cycles from the step timer compare match to the end of the interrupt, and the peak
+  // rate is the fastest step event rate in step/sec, reported only above F_CPU/65536.
+  void report_stepper_stats()
+  {
+    st_stats_t stats;
+    st_read_stats(&stats);
+    printPgmString(PSTR("[ISR max:")); printInteger(stats.isr_max_cycles);
+    printPgmString(PSTR(",avg:"));
+    if (stats.isr_count) { printInteger(stats.isr_sum_cycles/stats.isr_count); }
+    else { printInteger(0); }
+    printPgmString(PSTR(",peak:"));
+    if (stats.min_ceiling) { printInteger(F_CPU/((uint32_t)stats.min_ceiling+1)); }
+    else { printInteger(0); }
+    printPgmString(PSTR(",busy:")); printInteger(stats.busy_skips);
+    printPgmString(PSTR(",pulse:")); printInteger(stats.pulse_collisions);
+    printPgmString(PSTR("]\r\n"));
+  }
+#endif
+
+
+#ifdef ENABLE_CYCLE_TIME_ESTIMATE
+  // Prints the cycle time estimate of the '$T' estimate mode in seconds. The total, rapid and dwell
+  // times come first, followed by the time at each programmed feed rate in unit/min, and the time at
+  // any feed rates beyond those.
+  void report_cycle_time_estimate()
+  {
+    uint8_t idx;
+    float time = plan_estimate.rapid_time+plan_estimate.dwell_time+plan_estimate.other_time;
+    for (idx=0; idx<ESTIMATE_FEED_RATES; idx++) { time += plan_estimate.feed_time[idx]; }
+    printPgmString(PSTR("[Time:")); printFloat(time);
+    printPgmString(PSTR(",rapid:")); printFloat(plan_estimate.rapid_time);
+    printPgmString(PSTR(",dwell:")); printFloat(plan_estimate.dwell_time);
+    printPgmString(PSTR("]\r\n"));
+    for (idx=0; (idx<ESTIMATE_FEED_RATES) && (plan_estimate.feed_rate[idx] != 0.0); idx++) {
+      printPgmString(PSTR("[F"));
+      if (bit_istrue(settings.flags,BITFLAG_REPORT_INCHES)) { printFloat(plan_estimate.feed_rate[idx]*INCH_PER_MM); }
+      else { printFloat(plan_estimate.feed_rate[idx]); }
+      printPgmString(PSTR(":")); printFloat(plan_estimate.feed_time[idx]);
+      printPgmString(PSTR("]\r\n"));
+    }
+    if (plan_estimate.other_time > 0.0) {
+      printPgmString(PSTR("[F other:")); printFloat(plan_estimate.other_time);
+      printPgmString(PSTR("]\r\n"));
+    }
+  }
+#endif
+
+
 // Prints gcode coordinate offset parameters
 void report_gcode_parameters()
 {
@@ -213,8 +340,8 @@ void report_gcode_parameters()
   }
   printPgmString(PSTR("[G92:")); // Print G92,G92.1 which are not persistent in memory
   for (i=0; i<N_AXIS; i++) {
-    if (bit_istrue(settings.flags,BITFLAG_REPORT_INCHES)) { printFloat(gc.coord_offset[i]*INCH_PER_MM); }
-    else { printFloat(gc.coord_offset[i]); }
+    if (bit_istrue(settings.flags,BITFLAG_REPORT_INCHES)) { printFloat(coord_to_mm(gc.coord_offset[i])*INCH_PER_MM); }
+    else { printFloat(coord_to_mm(gc.coord_offset[i])); }
     if (i < (N_AXIS-1)) { printPgmString(PSTR(",")); }
     else { printPgmString(PSTR("]\r\n")); }
   } 
@@ -248,6 +375,9 @@ void report_gcode_modes()
   
   if (gc.inverse_feed_rate_mode) { printPgmString(PSTR(" G93")); }
   else { printPgmString(PSTR(" G94")); }
+
+  if (gc.path_mode == PATH_MODE_CONTINUOUS) { printPgmString(PSTR(" G64")); }
+  else { printPgmString(PSTR(" G61")); }
     
   switch (gc.program_flow) {
     case PROGRAM_FLOW_RUNNING : printPgmString(PSTR(" M0")); break;
@@ -287,54 +417,149 @@ void report_startup_line(uint8_t n, char *line)
   printPgmString(PSTR("\r\n"));
 }
 
+// Returns the number of characters printInteger() prints for a non-negative integer.
+static uint8_t integer_length(uint32_t n)
+{
+  uint8_t length = 1;
+  while (n >= 10) { 
+    n /= 10; 
+    length++; 
+  }
+  return(length);
+}
+
  // Prints real-time data. This function grabs a real-time snapshot of the stepper subprogram 
  // and the actual location of the CNC machine. Users may change the following function to their
  // specific needs, but the desired real-time data report must be as short as possible. This is
  // requires as it minimizes the computational overhead and allows grbl to keep running smoothly, 
  // especially during g-code programs with fast, short line segments and high frequency reports (5-20Hz).
-void report_realtime_status()
+ // The report is written to the TX buffer as a whole, only when it has room, so it never waits on
+ // the serial port. Otherwise, it returns false to be called again later. A report longer than 
+ // the TX buffer is written once the buffer is empty, and then only waits for the excess.
+uint8_t report_realtime_status()
 {
   // **Under construction** Bare-bones status report. Provides real-time machine position relative to 
   // the system power on location (0,0,0) and work coordinate position (G54 and G92 applied). Eventually
   // to be added are distance to go on block, processed block id, and feed rate. Also a settings bitmask
   // for a user to select the desired real-time data.
+  
+  // Skip the snapshot, while the TX buffer does not have room for a report as long as the last.
+  uint8_t tx_free = serial_get_tx_buffer_free();
+  if ((tx_free < status_length) && (tx_free < TX_BUFFER_SIZE-1)) { return(false); }
+  
   uint8_t i;
-  int32_t current_position[3]; // Copy current state of the system position variable
+  int32_t current_position[N_AXIS]; // Copy current state of the system position variable
+  cli(); // Atomic copy, since the stepper interrupt updates the position.
   memcpy(current_position,sys.position,sizeof(sys.position));
-  float print_position[3];
- 
-  // Report current machine state
+  sei();
+  
+  // Current machine state
+  const char *state_string;
   switch (sys.state) {
-    case STATE_IDLE: printPgmString(PSTR("<Idle")); break;
-//    case STATE_INIT: printPgmString(PSTR("[Init")); break; // Never observed
-    case STATE_QUEUED: printPgmString(PSTR("<Queue")); break;
-    case STATE_CYCLE: printPgmString(PSTR("<Run")); break;
-    case STATE_HOLD: printPgmString(PSTR("<Hold")); break;
-    case STATE_HOMING: printPgmString(PSTR("<Home")); break;
-    case STATE_ALARM: printPgmString(PSTR("<Alarm")); break;
-    case STATE_CHECK_MODE: printPgmString(PSTR("<Check")); break;
+    case STATE_IDLE: state_string = PSTR("<Idle"); break;
+    case STATE_QUEUED: state_string = PSTR("<Queue"); break;
+    case STATE_CYCLE: state_string = PSTR("<Run"); break;
+    case STATE_HOLD: state_string = PSTR("<Hold"); break;
+    case STATE_HOMING: state_string = PSTR("<Home"); break;
+    case STATE_ALARM: state_string = PSTR("<Alarm"); break;
+    case STATE_CHECK_MODE: state_string = PSTR("<Check"); break;
+    case STATE_JOG: state_string = PSTR("<Jog"); break;
+    case STATE_ESTIMATE: state_string = PSTR("<Estimate"); break;
+    default: state_string = PSTR(""); // STATE_INIT. Never observed.
   }
- 
+  
+  // Convert the machine and work positions to fixed-point, take the fields enabled by the status
+  // report mask, and measure the report length. The fixed part is the state and ">\r\n".
+  uint8_t mask = settings.status_report_mask;
+  int32_t machine_position[N_AXIS], work_position[N_AXIS];
+  uint8_t length = strlen_P(state_string)+3;
+  for (i=0; i<N_AXIS; i++) {
+    machine_position[i] = lround(current_position[i]*status_step_scale[i]);
+    work_position[i] = machine_position[i] - 
+                       lround(coord_to_mm(gc.coord_system[i]+gc.coord_offset[i])*status_mm_scale);
+  }
+  if (mask & BITFLAG_RT_STATUS_MACHINE_POSITION) {
+    length += 6 + (N_AXIS-1); // ",MPos:" and the commas between the axes
+    for (i=0; i<N_AXIS; i++) { length += printFixedLength(machine_position[i]); }
+  }
+  if (mask & BITFLAG_RT_STATUS_WORK_POSITION) {
+    length += 6 + (N_AXIS-1); // ",WPos:" and the commas between the axes
+    for (i=0; i<N_AXIS; i++) { length += printFixedLength(work_position[i]); }
+  }
+  if (mask & BITFLAG_RT_STATUS_OVERRIDES) {
+    length += 5 + integer_length(sys.feed_override) + integer_length(sys.rapid_override);
+  }
+  uint8_t planner_count = plan_get_block_buffer_count();
+  if (mask & BITFLAG_RT_STATUS_PLANNER_BUFFER) { length += 5 + integer_length(planner_count); }
+  uint8_t rx_count = (RX_BUFFER_SIZE-1)-serial_get_rx_buffer_available();
+  if (mask & BITFLAG_RT_STATUS_SERIAL_RX) { length += 4 + integer_length(rx_count); }
+  int32_t feed_rate = lround(st_get_realtime_rate()*status_mm_scale);
+  if (mask & BITFLAG_RT_STATUS_FEED_RATE) { length += 3 + printFixedLength(feed_rate); }
+  plan_telemetry_t telemetry = plan_telemetry;
+  uint16_t recalculate_time = telemetry.max_recalculate_ticks*(1024000000UL/F_CPU); // usec
+  if (mask & BITFLAG_RT_STATUS_PLANNER_STATS) {
+    length += 6 + integer_length(telemetry.underruns) + integer_length(telemetry.min_depth) + 
+              integer_length(recalculate_time);
+  }  
+  status_length = length;
+  if ((tx_free < length) && (tx_free < TX_BUFFER_SIZE-1)) { return(false); }
+  
+  printPgmString(state_string);
+  
   // Report machine position
-  printPgmString(PSTR(",MPos:")); 
-  for (i=0; i<= 2; i++) {
-    print_position[i] = current_position[i]/settings.steps_per_mm[i];
-    if (bit_istrue(settings.flags,BITFLAG_REPORT_INCHES)) { print_position[i] *= INCH_PER_MM; }
-    printFloat(print_position[i]);
-    printPgmString(PSTR(","));
+  if (mask & BITFLAG_RT_STATUS_MACHINE_POSITION) {
+    printPgmString(PSTR(",MPos:")); 
+    for (i=0; i<N_AXIS; i++) {
+      printFixed(machine_position[i]);
+      if (i < (N_AXIS-1)) { printPgmString(PSTR(",")); }
+    }
   }
   
   // Report work position
-  printPgmString(PSTR("WPos:")); 
-  for (i=0; i<= 2; i++) {
-    if (bit_istrue(settings.flags,BITFLAG_REPORT_INCHES)) {
-      print_position[i] -= (gc.coord_system[i]+gc.coord_offset[i])*INCH_PER_MM;
-    } else {
-      print_position[i] -= gc.coord_system[i]+gc.coord_offset[i];
+  if (mask & BITFLAG_RT_STATUS_WORK_POSITION) {
+    printPgmString(PSTR(",WPos:")); 
+    for (i=0; i<N_AXIS; i++) {
+      printFixed(work_position[i]);
+      if (i < (N_AXIS-1)) { printPgmString(PSTR(",")); }
     }
-    printFloat(print_position[i]);
-    if (i < 2) { printPgmString(PSTR(",")); }
+  }
+  
+  // Report feed and rapid override values in percent
+  if (mask & BITFLAG_RT_STATUS_OVERRIDES) {
+    printPgmString(PSTR(",Ov:")); 
+    printInteger(sys.feed_override);
+    printPgmString(PSTR(","));
+    printInteger(sys.rapid_override);
+  }
+  
+  // Report the blocks in the planner buffer and the characters in the serial receive buffer
+  if (mask & BITFLAG_RT_STATUS_PLANNER_BUFFER) {
+    printPgmString(PSTR(",Buf:"));
+    printInteger(planner_count);
+  }
+  if (mask & BITFLAG_RT_STATUS_SERIAL_RX) {
+    printPgmString(PSTR(",RX:"));
+    printInteger(rx_count);
+  }
+  
+  // Report current feed rate in the report units
+  if (mask & BITFLAG_RT_STATUS_FEED_RATE) {
+    printPgmString(PSTR(",F:"));
+    printFixed(feed_rate);
+  }
+  
+  // Report planner underruns, and the minimum buffer depth and longest recalculate time in usec 
+  // since the last report. Restarts the latter two for the next report.
+  if (mask & BITFLAG_RT_STATUS_PLANNER_STATS) {
+    printPgmString(PSTR(",Pl:"));
+    printInteger(telemetry.underruns);
+    printPgmString(PSTR(","));
+    printInteger(telemetry.min_depth);
+    printPgmString(PSTR(","));
+    printInteger(recalculate_time);
+    plan_reset_telemetry();
   }
     
   printPgmString(PSTR(">\r\n"));
+  return(true);
 }
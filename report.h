@@ -45,10 +45,12 @@
 #define STATUS_IDLE_ERROR 11
 #define STATUS_ALARM_LOCK 12
 #define STATUS_OVERFLOW 13
+#define STATUS_BAD_CHECKSUM 14
 
 // Define Grbl alarm codes. Less than zero to distinguish alarm error from status error.
 #define ALARM_HARD_LIMIT -1
 #define ALARM_ABORT_CYCLE -2
+#define ALARM_HOMING_FAIL -3
 
 // Define Grbl feedback message codes.
 #define MESSAGE_CRITICAL_EVENT 1
@@ -75,8 +77,17 @@ void report_grbl_help();
 // Prints Grbl global settings
 void report_grbl_settings();
 
-// Prints realtime status report
-void report_realtime_status();
+// Precomputes the realtime status report scale factors. Called upon any settings change.
+void report_init();
+
+// Prints realtime status report, when the serial TX buffer has room. Returns false, when deferred.
+uint8_t report_realtime_status();
+
+// Prints and clears the stepper interrupt timing statistics. Requires STEPPER_ISR_STATS.
+void report_stepper_stats();
+
+// Prints the cycle time estimate of the '$T' estimate mode. Requires ENABLE_CYCLE_TIME_ESTIMATE.
+void report_cycle_time_estimate();
 
 // Prints Grbl persistent coordinate parameters
 void report_gcode_parameters();
@@ -37,7 +37,7 @@ import serial
 import time
 
 # Open grbl serial port
-s = serial.Serial('/dev/tty.usbmodem1811',9600)
+s = serial.Serial('/dev/tty.usbmodem1811',115200)
 
 # Open g-code file
 f = open('grbl.gcode','r');
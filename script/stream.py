@@ -9,6 +9,13 @@ from the serial buffer and does not have to wait for a
 response from the computer. This effectively adds another
 buffer layer to prevent buffer starvation.
 
+When grbl reports its buffer state in every response 
+($24=1, e.g. 'ok Bf:17,127' for 17 free planner blocks and
+127 free serial read buffer bytes), the serial read buffer 
+size is taken from grbl rather than assumed, and each line
+is only sent once the most recent response shows room for
+it in both the serial read buffer and the planner buffer.
+
 TODO: - Add runtime command capabilities
 
   The MIT License (MIT)
@@ -41,7 +48,13 @@ import sys
 import argparse
 # import threading
 
-RX_BUFFER_SIZE = 128
+RX_BUFFER_SIZE = 128 # Default, if grbl does not report its buffer state
+
+# Returns the (free planner blocks, free serial read buffer bytes) reported in a grbl response.
+def buffer_state(response) :
+    m = re.search(r'Bf:(\d+),(\d+)', response)
+    if m : return (int(m.group(1)), int(m.group(2)))
+    return None
 
 # Define command line argument interface
 parser = argparse.ArgumentParser(description='Stream g-code file to grbl. (pySerial and argparse libraries required)')
@@ -61,7 +74,7 @@ args = parser.parse_args()
 #     t.start()
 
 # Initialize
-s = serial.Serial(args.device_file,9600)
+s = serial.Serial(args.device_file,115200)
 f = args.gcode_file
 verbose = True
 if args.quiet : verbose = False
@@ -74,19 +87,34 @@ s.write("\r\n\r\n")
 time.sleep(2)
 s.flushInput()
 
+# Learn the serial read buffer size from the response to an empty line, while grbl is idle.
+s.write("\n")
+state = buffer_state(s.readline())
+if state :
+    RX_BUFFER_SIZE = state[1]+1
+    print "Grbl buffer state: ", state[0], " free planner blocks, ", state[1], " free serial buffer bytes"
+
 # Stream g-code to grbl
 print "Streaming ", args.gcode_file.name, " to ", args.device_file
 l_count = 0
 g_count = 0
 c_line = []
+# Free serial read buffer bytes and planner blocks by the most recent response, less the lines sent
+# since. Without buffer state reports, only the characters in the serial read buffer are counted.
+rx_free = RX_BUFFER_SIZE-1
+blocks_free = None
 # periodic() # Start status report periodic timer
 for line in f:
     l_count += 1 # Iterate line counter
 #     l_block = re.sub('\s|\(.*?\)','',line).upper() # Strip comments/spaces/new line and capitalize
     l_block = line.strip()
-    c_line.append(len(l_block)+1) # Track number of characters in grbl serial read buffer
     grbl_out = '' 
-    while sum(c_line) >= RX_BUFFER_SIZE-1 | s.inWaiting() :
+    # Wait until the line fits the serial read buffer and the planner buffer has a free block for it.
+    # Lines sent just before a response may not have arrived in time to be counted in it, so the line
+    # must also fit by counting the characters of all unacknowledged lines. If there are none, the line
+    # is sent regardless of the planner, since no further response would ever free a block.
+    while ( len(l_block)+1 > min(rx_free, RX_BUFFER_SIZE-1-sum(c_line)) or
+            (blocks_free is not None and blocks_free <= 0 and c_line) or s.inWaiting() ) :
         out_temp = s.readline().strip() # Wait for grbl response
         if out_temp.find('ok') < 0 and out_temp.find('error') < 0 :
             print "  Debug: ",out_temp # Debug response
@@ -95,8 +123,16 @@ for line in f:
             g_count += 1 # Iterate g-code counter
             grbl_out += str(g_count); # Add line finished indicator
             del c_line[0]
+            state = buffer_state(out_temp)
+            if state :
+                blocks_free, rx_free = state
+            else :
+                rx_free = RX_BUFFER_SIZE-1
     if verbose: print "SND: " + str(l_count) + " : " + l_block,
     s.write(l_block + '\n') # Send block to grbl
+    c_line.append(len(l_block)+1) # Track number of characters in grbl serial read buffer
+    rx_free -= len(l_block)+1
+    if blocks_free is not None : blocks_free -= 1 # Assume the line plans one block
     if verbose : print "BUF:",str(sum(c_line)),"REC:",grbl_out
 
 # Wait for user input after streaming is completed
@@ -27,9 +27,9 @@
   THE SOFTWARE.
 */
 
-#include <avr/interrupt.h>
 #include "serial.h"
 #include "config.h"
+#include "hal.h"
 #include "motion_control.h"
 #include "protocol.h"
 
@@ -41,40 +41,23 @@ uint8_t tx_buffer[TX_BUFFER_SIZE];
 uint8_t tx_buffer_head = 0;
 volatile uint8_t tx_buffer_tail = 0;
 
+// Returns the number of bytes in the RX buffer. This replaces a typical byte counter to prevent
+// the interrupt and main programs from writing to the counter at the same time.
+static uint8_t get_rx_buffer_count()
+{
+  uint8_t head = rx_buffer_head; // Temporary rx_buffer_head, as the RX interrupt may update it.
+  if (head >= rx_buffer_tail) { return(head-rx_buffer_tail); }
+  return (RX_BUFFER_SIZE - (rx_buffer_tail-head));
+}
+
 #ifdef ENABLE_XONXOFF
   volatile uint8_t flow_ctrl = XON_SENT; // Flow control state variable
-  
-  // Returns the number of bytes in the RX buffer. This replaces a typical byte counter to prevent
-  // the interrupt and main programs from writing to the counter at the same time.
-  static uint8_t get_rx_buffer_count()
-  {
-    if (rx_buffer_head == rx_buffer_tail) { return(0); }
-    if (rx_buffer_head < rx_buffer_tail) { return(rx_buffer_tail-rx_buffer_head); }
-    return (RX_BUFFER_SIZE - (rx_buffer_head-rx_buffer_tail));
-  }
 #endif
 
 void serial_init()
 {
-  // Set baud rate
-  #if BAUD_RATE < 57600
-    uint16_t UBRR0_value = ((F_CPU / (8L * BAUD_RATE)) - 1)/2 ;
-    UCSR0A &= ~(1 << U2X0); // baud doubler off  - Only needed on Uno XXX
-  #else
-    uint16_t UBRR0_value = ((F_CPU / (4L * BAUD_RATE)) - 1)/2;
-    UCSR0A |= (1 << U2X0);  // baud doubler on for high baud rates, i.e. 115200
-  #endif
-  UBRR0H = UBRR0_value >> 8;
-  UBRR0L = UBRR0_value;
-            
-  // enable rx and tx
-  UCSR0B |= 1<<RXEN0;
-  UCSR0B |= 1<<TXEN0;
-	
-  // enable interrupt on complete reception of a byte
-  UCSR0B |= 1<<RXCIE0;
-	  
-  // defaults to 8-bit, no parity, 1 stop bit
+  // Set baud rate, enable rx and tx, and enable the interrupt on complete reception of a byte.
+  hal_serial_init();
 }
 
 void serial_write(uint8_t data) {
@@ -92,27 +75,34 @@ void serial_write(uint8_t data) {
   tx_buffer_head = next_head;
   
   // Enable Data Register Empty Interrupt to make sure tx-streaming is running
-  UCSR0B |=  (1 << UDRIE0); 
+  hal_serial_tx_enable();
+}
+
+uint8_t serial_get_tx_buffer_free()
+{
+  uint8_t tail = tx_buffer_tail; // Temporary tx_buffer_tail (to optimize for volatile)
+  if (tx_buffer_head >= tail) { return(TX_BUFFER_SIZE-1-(tx_buffer_head-tail)); }
+  return(tail-tx_buffer_head-1);
 }
 
 // Data Register Empty Interrupt handler
-ISR(SERIAL_UDRE)
+ISR(HAL_SERIAL_TX_vect)
 {
   // Temporary tx_buffer_tail (to optimize for volatile)
   uint8_t tail = tx_buffer_tail;
   
   #ifdef ENABLE_XONXOFF
     if (flow_ctrl == SEND_XOFF) { 
-      UDR0 = XOFF_CHAR; 
+      hal_serial_write(XOFF_CHAR); 
       flow_ctrl = XOFF_SENT; 
     } else if (flow_ctrl == SEND_XON) { 
-      UDR0 = XON_CHAR; 
+      hal_serial_write(XON_CHAR); 
       flow_ctrl = XON_SENT; 
     } else
   #endif
   { 
     // Send a byte from the buffer	
-    UDR0 = tx_buffer[tail];
+    hal_serial_write(tx_buffer[tail]);
   
     // Update tail position
     tail++;
@@ -122,7 +112,7 @@ ISR(SERIAL_UDRE)
   }
   
   // Turn off Data Register Empty Interrupt to stop tx-streaming if this concludes the transfer
-  if (tail == tx_buffer_head) { UCSR0B &= ~(1 << UDRIE0); }
+  if (tail == tx_buffer_head) { hal_serial_tx_disable(); }
 }
 
 uint8_t serial_read()
@@ -139,7 +129,7 @@ uint8_t serial_read()
     #ifdef ENABLE_XONXOFF
       if ((get_rx_buffer_count() < RX_BUFFER_LOW) && flow_ctrl == XOFF_SENT) { 
         flow_ctrl = SEND_XON;
-        UCSR0B |=  (1 << UDRIE0); // Force TX
+        hal_serial_tx_enable(); // Force TX
       }
     #endif
     
@@ -147,10 +137,15 @@ uint8_t serial_read()
   }
 }
 
-ISR(SERIAL_RX)
+ISR(HAL_SERIAL_RX_vect)
 {
-  uint8_t data = UDR0;
+  uint8_t data = hal_serial_read();
   uint8_t next_head;
+  #ifdef STEP_PULSE_LATCHED
+    // Let the step interrupts preempt the rest of this handler, which masks itself until done.
+    hal_serial_rx_disable();
+    sei();
+  #endif
   
   // Pick off runtime command characters directly from the serial stream. These characters are
   // not passed into the buffer, but these set system state flag bits for runtime execution.
@@ -159,6 +154,15 @@ ISR(SERIAL_RX)
     case CMD_CYCLE_START:   sys.execute |= EXEC_CYCLE_START; break; // Set as true
     case CMD_FEED_HOLD:     sys.execute |= EXEC_FEED_HOLD; break; // Set as true
     case CMD_RESET:         mc_reset(); break; // Call motion control reset routine.
+    case CMD_JOG_CANCEL:    sys.execute |= EXEC_JOG_CANCEL; break; // Set as true
+    case CMD_FEED_OVR_RESET:        sys.override |= EXEC_FEED_OVR_RESET; break;
+    case CMD_FEED_OVR_COARSE_PLUS:  sys.override |= EXEC_FEED_OVR_COARSE_PLUS; break;
+    case CMD_FEED_OVR_COARSE_MINUS: sys.override |= EXEC_FEED_OVR_COARSE_MINUS; break;
+    case CMD_FEED_OVR_FINE_PLUS:    sys.override |= EXEC_FEED_OVR_FINE_PLUS; break;
+    case CMD_FEED_OVR_FINE_MINUS:   sys.override |= EXEC_FEED_OVR_FINE_MINUS; break;
+    case CMD_RAPID_OVR_RESET:       sys.override |= EXEC_RAPID_OVR_RESET; break;
+    case CMD_RAPID_OVR_MEDIUM:      sys.override |= EXEC_RAPID_OVR_MEDIUM; break;
+    case CMD_RAPID_OVR_LOW:         sys.override |= EXEC_RAPID_OVR_LOW; break;
     default: // Write character to buffer    
       next_head = rx_buffer_head + 1;
       if (next_head == RX_BUFFER_SIZE) { next_head = 0; }
@@ -171,12 +175,21 @@ ISR(SERIAL_RX)
         #ifdef ENABLE_XONXOFF
           if ((get_rx_buffer_count() >= RX_BUFFER_FULL) && flow_ctrl == XON_SENT) {
             flow_ctrl = SEND_XOFF;
-            UCSR0B |=  (1 << UDRIE0); // Force TX
+            hal_serial_tx_enable(); // Force TX
           } 
         #endif
         
       }
   }
+  #ifdef STEP_PULSE_LATCHED
+    cli();
+    hal_serial_rx_enable();
+  #endif
+}
+
+uint8_t serial_get_rx_buffer_available()
+{
+  return((RX_BUFFER_SIZE-1)-get_rx_buffer_count());
 }
 
 void serial_reset_read_buffer() 
@@ -56,8 +56,14 @@ void serial_init();
 
 void serial_write(uint8_t data);
 
+// Returns the number of bytes that can be written without waiting on the TX buffer.
+uint8_t serial_get_tx_buffer_free();
+
 uint8_t serial_read();
 
+// Returns the number of bytes that can be received before the RX buffer is full.
+uint8_t serial_get_rx_buffer_available();
+
 // Reset and empty data in read buffer. Used by e-stop and reset.
 void serial_reset_read_buffer();
 
@@ -35,9 +35,16 @@
 #include "settings.h"
 #include "eeprom.h"
 #include "limits.h"
+#include "planner.h"
 
 settings_t settings;
 
+// RAM mirror of the work coordinate system data in EEPROM. These are read on every work coordinate
+// system select and parameter report, so they are loaded and verified once at power-up and served
+// from RAM from then on. Costs 72 bytes of RAM for the 6 records of 3 axes. The G28 and G30 home
+// positions are only read for their motions, which stop the machine anyway, and stay in EEPROM.
+static float coord_data_cache[N_COORDINATE_SYSTEM][N_AXIS];
+
 // Version 4 outdated settings record
 typedef struct {
   float steps_per_mm[3];
@@ -51,6 +58,129 @@ typedef struct {
   float junction_deviation;
 } settings_v4_t;
 
+// Version 5 outdated settings record
+typedef struct {
+  float steps_per_mm[3];
+  uint8_t microsteps;
+  uint8_t pulse_microseconds;
+  float default_feed_rate;
+  float default_seek_rate;
+  uint8_t invert_mask;
+  float mm_per_arc_segment;
+  float acceleration;
+  float junction_deviation;
+  uint8_t flags;
+  uint8_t homing_dir_mask;
+  float homing_feed_rate;
+  float homing_seek_rate;
+  uint16_t homing_debounce_delay;
+  float homing_pulloff;
+  uint8_t stepper_idle_lock_time;
+  uint8_t decimal_places;
+  uint8_t n_arc_correction;
+} settings_v5_t;
+
+// Version 6 outdated settings record
+typedef struct {
+  float steps_per_mm[3];
+  uint8_t microsteps;
+  uint8_t pulse_microseconds;
+  float default_feed_rate;
+  float default_seek_rate;
+  uint8_t invert_mask;
+  float mm_per_arc_segment;
+  float acceleration;
+  float junction_deviation;
+  uint8_t flags;
+  uint8_t homing_dir_mask;
+  float homing_feed_rate;
+  float homing_seek_rate;
+  uint16_t homing_debounce_delay;
+  float homing_pulloff;
+  uint8_t stepper_idle_lock_time;
+  uint8_t decimal_places;
+  uint8_t n_arc_correction;
+  float arc_tolerance;
+} settings_v6_t;
+
+// Version 7 outdated settings record
+typedef struct {
+  float steps_per_mm[3];
+  uint8_t microsteps;
+  uint8_t pulse_microseconds;
+  float default_feed_rate;
+  float default_seek_rate;
+  uint8_t invert_mask;
+  float mm_per_arc_segment;
+  float acceleration;
+  float junction_deviation;
+  uint8_t flags;
+  uint8_t homing_dir_mask;
+  float homing_feed_rate;
+  float homing_seek_rate;
+  uint16_t homing_debounce_delay;
+  float homing_pulloff;
+  uint8_t stepper_idle_lock_time;
+  uint8_t decimal_places;
+  uint8_t n_arc_correction;
+  float arc_tolerance;
+  float max_rate[3];
+  float max_acceleration[3];
+} settings_v7_t;
+
+// Version 8 outdated settings record
+typedef struct {
+  float steps_per_mm[3];
+  uint8_t microsteps;
+  uint8_t pulse_microseconds;
+  float default_feed_rate;
+  float default_seek_rate;
+  uint8_t invert_mask;
+  float mm_per_arc_segment;
+  float acceleration;
+  float junction_deviation;
+  uint8_t flags;
+  uint8_t homing_dir_mask;
+  float homing_feed_rate;
+  float homing_seek_rate;
+  uint16_t homing_debounce_delay;
+  float homing_pulloff;
+  uint8_t stepper_idle_lock_time;
+  uint8_t decimal_places;
+  uint8_t n_arc_correction;
+  float arc_tolerance;
+  float max_rate[3];
+  float max_acceleration[3];
+  uint8_t status_report_mask;
+} settings_v8_t;
+
+// Version 9 outdated settings record
+typedef struct {
+  float steps_per_mm[3];
+  uint8_t microsteps;
+  uint8_t pulse_microseconds;
+  float default_feed_rate;
+  float default_seek_rate;
+  uint8_t invert_mask;
+  float mm_per_arc_segment;
+  float acceleration;
+  float junction_deviation;
+  uint8_t flags;
+  uint8_t homing_dir_mask;
+  float homing_feed_rate;
+  float homing_seek_rate;
+  uint16_t homing_debounce_delay;
+  float homing_pulloff;
+  uint8_t stepper_idle_lock_time;
+  uint8_t decimal_places;
+  uint8_t n_arc_correction;
+  float arc_tolerance;
+  float max_rate[3];
+  float max_acceleration[3];
+  uint8_t status_report_mask;
+  float jerk;
+} settings_v9_t;
+
 
 // Method to store startup lines into EEPROM
 void settings_store_startup_line(uint8_t n, char *line)
@@ -59,9 +189,12 @@ void settings_store_startup_line(uint8_t n, char *line)
   memcpy_to_eeprom_with_checksum(addr,(char*)line, LINE_BUFFER_SIZE);
 }
 
-// Method to store coord data parameters into EEPROM
+// Method to store coord data parameters into EEPROM and its RAM mirror
 void settings_write_coord_data(uint8_t coord_select, float *coord_data)
 {  
+  if (coord_select < N_COORDINATE_SYSTEM) { 
+    memcpy(coord_data_cache[coord_select], coord_data, sizeof(float)*N_AXIS);
+  }
   uint16_t addr = coord_select*(sizeof(float)*N_AXIS+1) + EEPROM_ADDR_PARAMETERS;
   memcpy_to_eeprom_with_checksum(addr,(char*)coord_data, sizeof(float)*N_AXIS);
 }  
@@ -73,6 +206,25 @@ void write_global_settings()
   memcpy_to_eeprom_with_checksum(EEPROM_ADDR_GLOBAL, (char*)&settings, sizeof(settings_t));
 }
 
+// Sets the axis limits of settings migrated from a version without them to the global seek rate
+// and acceleration, which plans all motions as before, except any feed rates above the seek rate.
+static void migrate_axis_limits()
+{
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    settings.max_rate[idx] = settings.default_seek_rate;
+    settings.max_acceleration[idx] = settings.acceleration;
+  }
+}
+
+// Sets the automatic status report settings, which are new since version 9, to their defaults.
+static void migrate_auto_report()
+{
+  settings.status_report_interval = DEFAULT_STATUS_REPORT_INTERVAL;
+  if (DEFAULT_AUTO_REPORT_ON_CHANGE) { settings.flags |= BITFLAG_AUTO_REPORT_ON_CHANGE; }
+  else { settings.flags &= ~BITFLAG_AUTO_REPORT_ON_CHANGE; }
+}
+
 // Method to reset Grbl global settings back to defaults. 
 void settings_reset(bool reset_all) {
   // Reset all settings or only the migration settings to the new version.
@@ -87,6 +239,24 @@ void settings_reset(bool reset_all) {
     settings.mm_per_arc_segment = DEFAULT_MM_PER_ARC_SEGMENT;
     settings.invert_mask = DEFAULT_STEPPING_INVERT_MASK;
     settings.junction_deviation = DEFAULT_JUNCTION_DEVIATION;
+    settings.max_rate[X_AXIS] = DEFAULT_X_MAX_RATE;
+    settings.max_rate[Y_AXIS] = DEFAULT_Y_MAX_RATE;
+    settings.max_rate[Z_AXIS] = DEFAULT_Z_MAX_RATE;
+    settings.max_acceleration[X_AXIS] = DEFAULT_X_ACCELERATION;
+    settings.max_acceleration[Y_AXIS] = DEFAULT_Y_ACCELERATION;
+    settings.max_acceleration[Z_AXIS] = DEFAULT_Z_ACCELERATION;
+    #if N_AXIS > 3
+      settings.steps_per_mm[A_AXIS] = DEFAULT_A_STEPS_PER_MM;
+      settings.max_rate[A_AXIS] = DEFAULT_A_MAX_RATE;
+      settings.max_acceleration[A_AXIS] = DEFAULT_A_ACCELERATION;
+    #endif
+    #if N_AXIS > 4
+      settings.steps_per_mm[B_AXIS] = DEFAULT_B_STEPS_PER_MM;
+      settings.max_rate[B_AXIS] = DEFAULT_B_MAX_RATE;
+      settings.max_acceleration[B_AXIS] = DEFAULT_B_ACCELERATION;
+    #endif
+  } else {
+    migrate_axis_limits();
   }
   // New settings since last version
   settings.flags = 0;
@@ -95,6 +265,8 @@ void settings_reset(bool reset_all) {
   if (DEFAULT_INVERT_ST_ENABLE) { settings.flags |= BITFLAG_INVERT_ST_ENABLE; }
   if (DEFAULT_HARD_LIMIT_ENABLE) { settings.flags |= BITFLAG_HARD_LIMIT_ENABLE; }
   if (DEFAULT_HOMING_ENABLE) { settings.flags |= BITFLAG_HOMING_ENABLE; }
+  if (DEFAULT_REPORT_BUFFER_STATE) { settings.flags |= BITFLAG_REPORT_BUFFER_STATE; }
+  if (DEFAULT_AUTO_REPORT_ON_CHANGE) { settings.flags |= BITFLAG_AUTO_REPORT_ON_CHANGE; }
   settings.homing_dir_mask = DEFAULT_HOMING_DIR_MASK;
   settings.homing_feed_rate = DEFAULT_HOMING_FEEDRATE;
   settings.homing_seek_rate = DEFAULT_HOMING_RAPID_FEEDRATE;
@@ -103,6 +275,10 @@ void settings_reset(bool reset_all) {
   settings.stepper_idle_lock_time = DEFAULT_STEPPER_IDLE_LOCK_TIME;
   settings.decimal_places = DEFAULT_DECIMAL_PLACES;
   settings.n_arc_correction = DEFAULT_N_ARC_CORRECTION;
+  settings.arc_tolerance = DEFAULT_ARC_TOLERANCE;
+  settings.status_report_mask = DEFAULT_STATUS_REPORT_MASK;
+  settings.jerk = DEFAULT_JERK;
+  settings.status_report_interval = DEFAULT_STATUS_REPORT_INTERVAL;
   write_global_settings();
 }
 
@@ -120,8 +296,8 @@ uint8_t settings_read_startup_line(uint8_t n, char *line)
   }
 }
 
-// Read selected coordinate data from EEPROM. Updates pointed coord_data value.
-uint8_t settings_read_coord_data(uint8_t coord_select, float *coord_data)
+// Loads selected coordinate data from EEPROM. Updates pointed coord_data value.
+static uint8_t load_coord_data(uint8_t coord_select, float *coord_data)
 {
   uint16_t addr = coord_select*(sizeof(float)*N_AXIS+1) + EEPROM_ADDR_PARAMETERS;
   if (!(memcpy_from_eeprom_with_checksum((char*)coord_data, addr, sizeof(float)*N_AXIS))) {
@@ -134,6 +310,18 @@ uint8_t settings_read_coord_data(uint8_t coord_select, float *coord_data)
   }
 }  
 
+// Read selected coordinate data from its RAM mirror, or from EEPROM for the home positions. Updates
+// pointed coord_data value. Work coordinate systems always succeed, since the data was verified and
+// any bad records reset at power-up.
+uint8_t settings_read_coord_data(uint8_t coord_select, float *coord_data)
+{
+  if (coord_select < N_COORDINATE_SYSTEM) {
+    memcpy(coord_data, coord_data_cache[coord_select], sizeof(float)*N_AXIS);
+    return(true);
+  }
+  return(load_coord_data(coord_select, coord_data));
+}  
+
 // Reads Grbl global settings struct from EEPROM.
 uint8_t read_global_settings() {
   // Check version-byte of eeprom
@@ -145,12 +333,60 @@ uint8_t read_global_settings() {
       return(false);
     }
   } else {
-    if (version <= 4) {
+    if (N_AXIS > 3) {
+      // Outdated settings records are all 3-axis records. Reset to defaults.
+      return(false);
+    } else if (version <= 4) {
       // Migrate from settings version 4 to current version.
       if (!(memcpy_from_eeprom_with_checksum((char*)&settings, 1, sizeof(settings_v4_t)))) {
         return(false);
       }     
       settings_reset(false); // Old settings ok. Write new settings only.
+    } else if (version == 5) {
+      // Migrate from settings version 5. The arc tolerance, axis limits, and all later settings are new.
+      if (!(memcpy_from_eeprom_with_checksum((char*)&settings, EEPROM_ADDR_GLOBAL, sizeof(settings_v5_t)))) {
+        return(false);
+      }
+      settings.arc_tolerance = DEFAULT_ARC_TOLERANCE;
+      migrate_axis_limits();
+      settings.status_report_mask = DEFAULT_STATUS_REPORT_MASK;
+      settings.jerk = DEFAULT_JERK;
+      migrate_auto_report();
+      write_global_settings();
+    } else if (version == 6) {
+      // Migrate from settings version 6. The axis limits and all later settings are new.
+      if (!(memcpy_from_eeprom_with_checksum((char*)&settings, EEPROM_ADDR_GLOBAL, sizeof(settings_v6_t)))) {
+        return(false);
+      }
+      migrate_axis_limits();
+      settings.status_report_mask = DEFAULT_STATUS_REPORT_MASK;
+      settings.jerk = DEFAULT_JERK;
+      migrate_auto_report();
+      write_global_settings();
+    } else if (version == 7) {
+      // Migrate from settings version 7. The status report mask and all later settings are new.
+      if (!(memcpy_from_eeprom_with_checksum((char*)&settings, EEPROM_ADDR_GLOBAL, sizeof(settings_v7_t)))) {
+        return(false);
+      }
+      settings.status_report_mask = DEFAULT_STATUS_REPORT_MASK;
+      settings.jerk = DEFAULT_JERK;
+      migrate_auto_report();
+      write_global_settings();
+    } else if (version == 8) {
+      // Migrate from settings version 8. The jerk and the automatic status reports are new.
+      if (!(memcpy_from_eeprom_with_checksum((char*)&settings, EEPROM_ADDR_GLOBAL, sizeof(settings_v8_t)))) {
+        return(false);
+      }
+      settings.jerk = DEFAULT_JERK;
+      migrate_auto_report();
+      write_global_settings();
+    } else if (version == 9) {
+      // Migrate from settings version 9. Only the automatic status reports are new.
+      if (!(memcpy_from_eeprom_with_checksum((char*)&settings, EEPROM_ADDR_GLOBAL, sizeof(settings_v9_t)))) {
+        return(false);
+      }
+      migrate_auto_report();
+      write_global_settings();
     } else {      
       return(false);
     }
@@ -203,10 +439,51 @@ uint8_t settings_store_global_setting(int parameter, float value) {
     case 20: settings.homing_seek_rate = value; break;
     case 21: settings.homing_debounce_delay = round(value); break;
     case 22: settings.homing_pulloff = value; break;
+    case 23: settings.arc_tolerance = fabs(value); break;
+    case 24:
+      if (value) { settings.flags |= BITFLAG_REPORT_BUFFER_STATE; }
+      else { settings.flags &= ~BITFLAG_REPORT_BUFFER_STATE; }
+      break;
+    case 25: case 26: case 27:
+      if (value <= 0.0) { return(STATUS_SETTING_VALUE_NEG); } 
+      settings.max_rate[parameter-25] = value; break;
+    case 28: case 29: case 30:
+      if (value <= 0.0) { return(STATUS_SETTING_VALUE_NEG); } 
+      settings.max_acceleration[parameter-28] = value*60*60; break; // Convert to mm/min^2 for grbl internal use.
+    case 31: settings.status_report_mask = trunc(value); break;
+    #if N_AXIS > 3
+      // Steps, max rate, and acceleration of the A axis, followed by those of the B axis.
+      case 32: case 33: case 34: 
+      #if N_AXIS > 4
+        case 35: case 36: case 37:
+      #endif
+        if (value <= 0.0) { return(STATUS_SETTING_VALUE_NEG); } 
+        parameter -= 32;
+        switch (parameter % 3) {
+          case 0: settings.steps_per_mm[A_AXIS+parameter/3] = value; break;
+          case 1: settings.max_rate[A_AXIS+parameter/3] = value; break;
+          case 2: settings.max_acceleration[A_AXIS+parameter/3] = value*60*60; break;
+        }
+        break;
+    #endif
+    #ifdef JERK_LIMITED_ACCELERATION
+      case 38: settings.jerk = fabs(value)*60*60*60; break; // Convert to mm/min^3 for grbl internal use.
+    #endif
+    case 39: 
+      if (value < 0.0) { return(STATUS_SETTING_VALUE_NEG); }
+      settings.status_report_interval = min(round(value),0xffff); break;
+    case 40:
+      if (value) { settings.flags |= BITFLAG_AUTO_REPORT_ON_CHANGE; }
+      else { settings.flags &= ~BITFLAG_AUTO_REPORT_ON_CHANGE; }
+      break;
     default: 
       return(STATUS_INVALID_STATEMENT);
   }
   write_global_settings();
+  report_init(); // Update status report scaling for any changed steps, units, or decimal places.
+  #ifdef FIXED_POINT_COORDINATES
+    plan_update_step_scale(); // Update the step conversion of the planner for any changed steps.
+  #endif
   return(STATUS_OK);
 }
 
@@ -217,11 +494,15 @@ void settings_init() {
     settings_reset(true);
     report_grbl_settings();
   }
-  // Read all parameter data into a dummy variable. If error, reset to zero, otherwise do nothing.
-  float coord_data[N_AXIS];
+  report_init();
+  // Verify all parameter data and load the work coordinate systems into the RAM mirror. If error, 
+  // reset to zero, otherwise do nothing.
   uint8_t i;
+  float coord_data[N_AXIS];
   for (i=0; i<=SETTING_INDEX_NCOORD; i++) {
-    if (!settings_read_coord_data(i, coord_data)) {
+    float *coord = coord_data;
+    if (i < N_COORDINATE_SYSTEM) { coord = coord_data_cache[i]; }
+    if (!load_coord_data(i, coord)) {
       report_status_message(STATUS_SETTING_READ_FAIL);
     }
   }
@@ -37,7 +37,7 @@
 
 // Version of the EEPROM data. Will be used to migrate existing data from older versions of Grbl
 // when firmware is upgraded. Always stored in byte 0 of eeprom
-#define SETTINGS_VERSION 5
+#define SETTINGS_VERSION 10
 
 // Define bit flag masks for the boolean settings in settings.flag.
 #define BITFLAG_REPORT_INCHES      bit(0)
@@ -45,6 +45,17 @@
 #define BITFLAG_INVERT_ST_ENABLE   bit(2)
 #define BITFLAG_HARD_LIMIT_ENABLE  bit(3)
 #define BITFLAG_HOMING_ENABLE      bit(4)
+#define BITFLAG_REPORT_BUFFER_STATE bit(5)
+#define BITFLAG_AUTO_REPORT_ON_CHANGE bit(6)
+
+// Define status report mask bit map. Each bit enables a field of the realtime status report.
+#define BITFLAG_RT_STATUS_MACHINE_POSITION bit(0)
+#define BITFLAG_RT_STATUS_WORK_POSITION    bit(1)
+#define BITFLAG_RT_STATUS_OVERRIDES        bit(2)
+#define BITFLAG_RT_STATUS_PLANNER_BUFFER   bit(3)
+#define BITFLAG_RT_STATUS_SERIAL_RX        bit(4)
+#define BITFLAG_RT_STATUS_FEED_RATE        bit(5)
+#define BITFLAG_RT_STATUS_PLANNER_STATS    bit(6)
 
 // Define EEPROM memory address location values for Grbl settings and parameters
 // NOTE: The Atmega328p has 1KB EEPROM. The upper half is reserved for parameters and
@@ -64,7 +75,7 @@
 
 // Global persistent settings (Stored from byte EEPROM_ADDR_GLOBAL onwards)
 typedef struct {
-  float steps_per_mm[3];
+  float steps_per_mm[N_AXIS];
   uint8_t microsteps;
   uint8_t pulse_microseconds;
   float default_feed_rate;
@@ -82,7 +93,12 @@ typedef struct {
   uint8_t stepper_idle_lock_time; // If max value 255, steppers do not disable.
   uint8_t decimal_places;
   uint8_t n_arc_correction;
-//  uint8_t status_report_mask; // Mask to indicate desired report data.
+  float arc_tolerance;
+  float max_rate[N_AXIS];          // Maximum axis rates (mm/min). Limit the nominal speed of all motions.
+  float max_acceleration[N_AXIS];  // Maximum axis accelerations (mm/min^2). Limit the path acceleration.
+  uint8_t status_report_mask;      // Mask to indicate desired report data. See RT_STATUS bitmasks.
+  float jerk;                      // Path jerk of JERK_LIMITED_ACCELERATION (mm/min^3). Zero disables.
+  uint16_t status_report_interval; // Automatic status report interval (msec). Zero disables.
 } settings_t;
 extern settings_t settings;
 
@@ -98,10 +114,11 @@ void settings_store_startup_line(uint8_t n, char *line);
 // Reads an EEPROM startup line to the protocol line variable
 uint8_t settings_read_startup_line(uint8_t n, char *line);
 
-// Writes selected coordinate data to EEPROM
+// Writes selected coordinate data to EEPROM and its RAM mirror
 void settings_write_coord_data(uint8_t coord_select, float *coord_data);
 
-// Reads selected coordinate data from EEPROM
+// Reads selected coordinate data from the RAM mirror loaded from EEPROM at power-up, or from
+// EEPROM for the G28 and G30 home positions
 uint8_t settings_read_coord_data(uint8_t coord_select, float *coord_data);
 
 #endif
@@ -29,9 +29,9 @@
 
 #include "settings.h"
 #include "spindle_control.h"
-#include "planner.h"
+#include "motion_control.h"
 
-static uint8_t current_direction;
+static int8_t current_direction; // Programmed direction, which may be queued behind buffered motion
 
 void spindle_init()
 {
@@ -46,20 +46,27 @@ void spindle_stop()
   SPINDLE_ENABLE_PORT &= ~(1<<SPINDLE_ENABLE_BIT);
 }
 
-void spindle_run(int8_t direction) //, uint16_t rpm) 
+// Sets the spindle pins. Called by the stepper subsystem, when the motion stream reaches a spindle 
+// event, so it may run in the stepper interrupt.
+void spindle_set_direction(int8_t direction)
 {
-  if (direction != current_direction) {
-    plan_synchronize();
-    if (direction) {
-      if(direction > 0) {
-        SPINDLE_DIRECTION_PORT &= ~(1<<SPINDLE_DIRECTION_BIT);
-      } else {
-        SPINDLE_DIRECTION_PORT |= 1<<SPINDLE_DIRECTION_BIT;
-      }
-      SPINDLE_ENABLE_PORT |= 1<<SPINDLE_ENABLE_BIT;
+  if (direction) {
+    if(direction > 0) {
+      SPINDLE_DIRECTION_PORT &= ~(1<<SPINDLE_DIRECTION_BIT);
     } else {
-      spindle_stop();     
+      SPINDLE_DIRECTION_PORT |= 1<<SPINDLE_DIRECTION_BIT;
     }
+    SPINDLE_ENABLE_PORT |= 1<<SPINDLE_ENABLE_BIT;
+  } else {
+    spindle_stop();     
+  }
+}
+
+// Queues a spindle change in turn with the buffered motion, rather than waiting for it to complete.
+void spindle_run(int8_t direction) //, uint16_t rpm) 
+{
+  if (direction != current_direction) {
+    mc_sync_event(PLAN_EVENT_SPINDLE, direction);
     current_direction = direction;
   }
 }
@@ -33,6 +33,7 @@
 
 void spindle_init();
 void spindle_run(int8_t direction); //, uint16_t rpm);
+void spindle_set_direction(int8_t direction);
 void spindle_stop();
 
 #endif
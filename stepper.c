@@ -29,44 +29,133 @@
 
 
 #include <avr/interrupt.h>
+#include <math.h>
 #include "stepper.h"
 #include "config.h"
+#include "hal.h"
 #include "settings.h"
 #include "planner.h"
+#include "spindle_control.h"
+#include "coolant_control.h"
 
 // Some useful constants
 #define TICKS_PER_MICROSECOND (F_CPU/1000000)
-#define CYCLES_PER_ACCELERATION_TICK ((TICKS_PER_MICROSECOND*1000000)/ACCELERATION_TICKS_PER_SECOND)
+#define ACCELERATION_TICKS_PER_MINUTE (60*ACCELERATION_TICKS_PER_SECOND)
+
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+  // Define Adaptive Multi-Axis Step-Smoothing (AMASS) levels and cutoff frequencies. Below each cutoff
+  // step event frequency, the stepper ISR is over-driven by the next factor of two and the Bresenham
+  // step counts are scaled to match, so that the minor axes are stepped evenly between major axis steps.
+  // NOTE: AMASS_LEVEL0 is normal operation. No AMASS. No upper cutoff frequency. 
+  #define MAX_AMASS_LEVEL 3
+  #define AMASS_LEVEL1 (F_CPU/8000) // Over-drives ISR (x2). Defined as F_CPU/(Cutoff frequency in Hz)
+  #define AMASS_LEVEL2 (F_CPU/4000) // Over-drives ISR (x4)
+  #define AMASS_LEVEL3 (F_CPU/2000) // Over-drives ISR (x8)
+#endif
+
+// Stores the Bresenham line data of a planner block that is currently being executed by the stepper
+// segment buffer. The planner block itself is discarded as soon as all of its segments have been
+// prepped, so the stepper algorithm keeps its own copy. The buffer is one smaller than the segment
+// buffer, which guarantees that an entry is never overwritten while a queued segment still uses it.
+// NOTE: With AMASS enabled, the step counts are stored scaled by the maximum AMASS level, so that 
+// each segment can divide them down to its own level with a shift.
+typedef struct {
+  uint8_t  direction_bits;
+  uint32_t steps[N_AXIS];
+  uint32_t step_event_count;
+} st_block_t;
+static st_block_t st_block_buffer[SEGMENT_BUFFER_SIZE-1];
+
+// Primary stepper segment ring buffer. Contains small, short line segments for the stepper algorithm
+// to execute, which are "checked-out" incrementally from the first block in the planner buffer. Each
+// segment runs at a constant step rate, so the stepper ISR only needs to load the timer once per
+// segment rather than compute the trapezoid on every step event. Spindle and coolant events are queued
+// in turn with the motion as segments without step events, which store the event type in the prescaler
+// and the event value in the ceiling.
+typedef struct {
+  uint16_t n_step;          // Number of step events to be executed for this segment
+  uint16_t ceiling;         // Step timer compare value for this segment's step rate
+  uint8_t  prescaler;       // Step timer prescaler clock select bits for this segment's step rate
+  uint8_t  st_block_index;  // Stepper block data index. Uses this information to execute this segment.
+  #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+    uint8_t amass_level;    // Indicates AMASS level for the ISR to execute this segment
+  #endif
+} segment_t;
+static segment_t segment_buffer[SEGMENT_BUFFER_SIZE];
 
-// Stepper state variable. Contains running data and trapezoid variables.
+// Stepper state variable. Contains running data for the stepper ISR.
 typedef struct {
   // Used by the bresenham line algorithm
-  int32_t counter_x,        // Counter variables for the bresenham line tracer
-          counter_y, 
-          counter_z;
-  uint32_t event_count;
-  uint32_t step_events_completed;  // The number of step events left in current motion
-
-  // Used by the trapezoid generator
-  uint32_t cycles_per_step_event;        // The number of machine cycles between each step event
-  uint32_t trapezoid_tick_cycle_counter; // The cycles since last trapezoid_tick. Used to generate ticks at a steady
-                                              // pace without allocating a separate timer
-  uint32_t trapezoid_adjusted_rate;      // The current rate of step_events according to the trapezoid generator
-  uint32_t min_safe_rate;  // Minimum safe rate for full deceleration rate reduction step. Otherwise halves step_rate.
+  int32_t counter[N_AXIS];   // Counter variables for the bresenham line tracer
+  uint32_t steps[N_AXIS];    // Bresenham step counts of the executing segment, scaled by its AMASS level
+  uint16_t step_count;       // Steps remaining in the executing segment
+  uint8_t exec_block_index;  // Tracks the current st_block index. Change indicates new block.
+  #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+    uint8_t exec_amass_level; // AMASS level of the loaded step counts. Change requires a reload.
+  #endif
+  st_block_t *exec_block;    // Pointer to the block data for the segment being executed
+  segment_t *exec_segment;   // Pointer to the segment being executed
 } stepper_t;
-
 static stepper_t st;
-static block_t *current_block;  // A pointer to the block currently being traced
+
+static volatile uint8_t segment_buffer_tail;
+static volatile uint8_t segment_buffer_head;
+static uint8_t segment_next_head;
+
+// Segment preparation data struct. Contains all the necessary information to compute new segments
+// from the first block in the planner buffer. Only used by the main program.
+typedef struct {
+  uint8_t st_block_index;            // Index of stepper common data block being prepped
+  block_t *pl_block;                 // Pointer to the planner block being prepped
+  plan_trapezoid_t trapezoid;        // Trapezoid of the planner block being prepped
+  uint32_t step_events_remaining;    // Step events of the planner block not yet prepped into segments
+  uint32_t current_rate;             // The step rate at the end of the last prepped segment (step/min)
+  uint32_t rate_delta;               // Step rate change per acceleration tick of the prepped block
+  uint32_t min_safe_rate;  // Minimum safe rate for full deceleration rate reduction step. Otherwise halves step_rate.
+  uint8_t starved;                   // True, after running out of planner blocks. Counts each underrun once.
+  #ifdef JERK_LIMITED_ACCELERATION
+    float jerk;                      // Jerk setting of the prepped block in (step/min)/tick^2. Zero, if linear.
+    uint8_t ramp_phase;              // Trapezoid phase of the executing S-curve ramp. RAMP_NONE, if none.
+    uint32_t ramp_end;               // Step event index of the phase boundary the ramp was planned to
+    uint32_t ramp_limit_rate;        // Nominal or final rate of the block the ramp was planned to (step/min)
+    uint32_t ramp_initial_rate;      // Step rate at the start of the ramp (step/min)
+    float ramp_rate_change;          // Total signed step rate change of the ramp (step/min)
+    float ramp_time;                 // Elapsed time of the ramp (acceleration ticks)
+    float ramp_duration;             // Duration of the ramp (acceleration ticks)
+    float ramp_jerk_time;            // Duration of the rounding at each end of the ramp (acceleration ticks)
+    float ramp_jerk;                 // Signed jerk of the ramp in (step/min)/tick^2
+  #endif
+} st_prep_t;
+static st_prep_t prep;
+
+#ifdef JERK_LIMITED_ACCELERATION
+  // Define the trapezoid phases of the S-curve ramps.
+  #define RAMP_NONE 0
+  #define RAMP_ACCEL 1
+  #define RAMP_OVERRIDE 2 // Override deceleration to a reduced nominal rate during the accel phase
+  #define RAMP_DECEL 3
+#endif
 
 // Used by the stepper driver interrupt
 static uint8_t step_pulse_time; // Step pulse reset time after step rise
 static uint8_t out_bits;        // The next stepping-bits to be output
 static volatile uint8_t busy;   // True when SIG_OUTPUT_COMPARE1A is being serviced. Used to avoid retriggering that handler.
 
+#ifdef STEPPER_ISR_STATS
+  static volatile st_stats_t stats; // Stepper interrupt timing statistics. Updated by the ISR.
+#endif
+
 #if STEP_PULSE_DELAY > 0
   static uint8_t step_bits;  // Stores out_bits output to complete the step pulse delay
 #endif
 
+#ifdef STEP_PULSE_LATCHED
+  #ifdef STEP_PULSE_DELAY
+    #error "STEP_PULSE_LATCHED and STEP_PULSE_DELAY cannot be enabled together."
+  #endif
+  static volatile uint8_t step_latch; // Stepping port bits of the next step pulse. Direction bits output early.
+#endif
+
 //         __________________________
 //        /|                        |\     _________________         ^
 //       / |                        | \   /|               |\        |
@@ -78,13 +167,14 @@ static volatile uint8_t busy;   // True when SIG_OUTPUT_COMPARE1A is being servi
 //
 //                           time ----->
 // 
-//  The trapezoid is the shape the speed curve over time. It starts at block->initial_rate, accelerates by block->rate_delta
-//  during the first block->accelerate_until step_events_completed, then keeps going at constant speed until 
-//  step_events_completed reaches block->decelerate_after after which it decelerates until the trapezoid generator is reset.
+//  The trapezoid is the shape the speed curve over time. It starts at the block initial rate, accelerates by block->rate_delta
+//  during the first trapezoid.accelerate_until step events, then keeps going at constant speed until the step events
+//  reach trapezoid.decelerate_after after which it decelerates until the trapezoid generator is reset.
 //  The slope of acceleration is always +/- block->rate_delta and is applied at a constant rate following the midpoint rule
-//  by the trapezoid generator, which is called ACCELERATION_TICKS_PER_SECOND times per second.
+//  by the segment generator in st_prep_buffer(), which slices the trapezoid into constant rate segments that each
+//  last one acceleration tick, i.e. 1/ACCELERATION_TICKS_PER_SECOND seconds, or end at a trapezoid phase boundary.
 
-static void set_step_events_per_minute(uint32_t steps_per_minute);
+static void config_step_timer(segment_t *segment, uint32_t cycles);
 
 // Stepper state initialization. Cycle should only start if the st.cycle_start flag is
 // enabled. Startup init and limits call this function but shouldn't start the cycle.
@@ -96,21 +186,24 @@ void st_wake_up()
   } else { 
     STEPPERS_DISABLE_PORT &= ~(1<<STEPPERS_DISABLE_BIT);
   }
-  if (sys.state == STATE_CYCLE) {
+  if ((sys.state == STATE_CYCLE) || (sys.state == STATE_JOG) || (sys.state == STATE_HOMING)) {
     // Initialize stepper output bits
     out_bits = (0) ^ (settings.invert_mask); 
+    #ifdef STEP_PULSE_LATCHED
+      step_latch = out_bits;
+    #endif
     // Initialize step pulse timing from settings. Here to ensure updating after re-writing.
     #ifdef STEP_PULSE_DELAY
       // Set total step pulse time after direction pin set. Ad hoc computation from oscilloscope.
       step_pulse_time = -(((settings.pulse_microseconds+STEP_PULSE_DELAY-2)*TICKS_PER_MICROSECOND) >> 3);
       // Set delay between direction pin write and step command.
-      OCR2A = -(((settings.pulse_microseconds)*TICKS_PER_MICROSECOND) >> 3);
+      hal_pulse_timer_delay_init(-(((settings.pulse_microseconds)*TICKS_PER_MICROSECOND) >> 3));
     #else // Normal operation
       // Set step pulse time. Ad hoc computation from oscilloscope. Uses two's complement.
       step_pulse_time = -(((settings.pulse_microseconds-2)*TICKS_PER_MICROSECOND) >> 3);
     #endif
     // Enable stepper driver interrupt
-    TIMSK1 |= (1<<OCIE1A);
+    hal_step_timer_enable();
   }
 }
 
@@ -118,7 +211,7 @@ void st_wake_up()
 void st_go_idle() 
 {
   // Disable stepper driver interrupt
-  TIMSK1 &= ~(1<<OCIE1A); 
+  hal_step_timer_disable();
   // Disable steppers only upon system alarm activated or by user setting to not be kept enabled.
   if ((settings.stepper_idle_lock_time != 0xff) || bit_istrue(sys.execute,EXEC_ALARM)) {
     // Force stepper dwell to lock axes for a defined amount of time to ensure the axes come to a complete
@@ -132,212 +225,208 @@ void st_go_idle()
   }
 }
 
-// This function determines an acceleration velocity change every CYCLES_PER_ACCELERATION_TICK by
-// keeping track of the number of elapsed cycles during a de/ac-celeration. The code assumes that 
-// step_events occur significantly more often than the acceleration velocity iterations.
-inline static uint8_t iterate_trapezoid_cycle_counter() 
+// Returns the index of the next segment or stepper block in their respective ring buffers.
+static uint8_t next_segment_index(uint8_t index)
 {
-  st.trapezoid_tick_cycle_counter += st.cycles_per_step_event;  
-  if(st.trapezoid_tick_cycle_counter > CYCLES_PER_ACCELERATION_TICK) {
-    st.trapezoid_tick_cycle_counter -= CYCLES_PER_ACCELERATION_TICK;
-    return(true);
-  } else {
-    return(false);
-  }
-}          
+  index++;
+  if (index == SEGMENT_BUFFER_SIZE) { index = 0; }
+  return(index);
+}
 
-// "The Stepper Driver Interrupt" - This timer interrupt is the workhorse of Grbl. It is executed at the rate set with
-// config_step_timer. It pops blocks from the block_buffer and executes them by pulsing the stepper pins appropriately. 
-// It is supported by The Stepper Port Reset Interrupt which it uses to reset the stepper port after each pulse. 
-// The bresenham line tracer algorithm controls all three stepper outputs simultaneously with these two interrupts.
-ISR(TIMER1_COMPA_vect)
+static uint8_t next_st_block_index(uint8_t index)
+{
+  index++;
+  if (index == SEGMENT_BUFFER_SIZE-1) { index = 0; }
+  return(index);
+}
+
+// "The Stepper Driver Interrupt" - This timer interrupt is the workhorse of Grbl. It is executed at the rate
+// set by the segment being executed. It pops segments from the segment buffer and executes them by pulsing
+// the stepper pins appropriately. All the trapezoid math has already been done by st_prep_buffer() in the
+// main program, so the only per-step work here is the Bresenham line tracer and a timer reload once per
+// segment. It is supported by The Stepper Port Reset Interrupt which it uses to reset the stepper port after
+// each pulse. The bresenham line tracer algorithm controls all three stepper outputs simultaneously with
+// these two interrupts.
+ISR(HAL_STEP_TIMER_vect)
 {        
-  if (busy) { return; } // The busy-flag is used to avoid reentering this interrupt
+  #ifdef STEP_PULSE_LATCHED
+    // Begin the latched step pulse before anything else. Then clear the latched step bits, so that
+    // re-entering this interrupt while busy does not repeat the step.
+    STEPPING_PORT = (STEPPING_PORT & ~STEPPING_MASK) | step_latch;
+    #ifdef STEPPER_ISR_STATS
+      if (hal_pulse_timer_running()) { stats.pulse_collisions++; } // Last step pulse reset has not triggered yet.
+    #endif
+    hal_pulse_timer_start(step_pulse_time);
+    step_latch = (step_latch & DIRECTION_MASK) | (settings.invert_mask & STEP_MASK);
+  #endif
+  #ifdef STEPPER_ISR_STATS
+    if (busy) { stats.busy_skips++; return; }
+    // Sample the interrupt time only while the step timer is unprescaled and counts CPU cycles.
+    uint8_t sample_cycles = hal_step_timer_unprescaled();
+    #ifndef STEP_PULSE_LATCHED
+      if (hal_pulse_timer_running()) { stats.pulse_collisions++; } // Last step pulse reset has not triggered yet.
+    #endif
+  #else
+    if (busy) { return; } // The busy-flag is used to avoid reentering this interrupt
+  #endif
   
-  // Set the direction pins a couple of nanoseconds before we step the steppers
-  STEPPING_PORT = (STEPPING_PORT & ~DIRECTION_MASK) | (out_bits & DIRECTION_MASK);
-  // Then pulse the stepping pins
-  #ifdef STEP_PULSE_DELAY
-    step_bits = (STEPPING_PORT & ~STEP_MASK) | out_bits; // Store out_bits to prevent overwriting.
-  #else  // Normal operation
-    STEPPING_PORT = (STEPPING_PORT & ~STEP_MASK) | out_bits;
+  #ifndef STEP_PULSE_LATCHED
+    // Set the direction pins a couple of nanoseconds before we step the steppers
+    STEPPING_PORT = (STEPPING_PORT & ~DIRECTION_MASK) | (out_bits & DIRECTION_MASK);
+    // Then pulse the stepping pins
+    #ifdef STEP_PULSE_DELAY
+      step_bits = (STEPPING_PORT & ~STEP_MASK) | out_bits; // Store out_bits to prevent overwriting.
+    #else  // Normal operation
+      STEPPING_PORT = (STEPPING_PORT & ~STEP_MASK) | out_bits;
+    #endif
+    // Enable step pulse reset timer so that The Stepper Port Reset Interrupt can reset the signal after
+    // exactly settings.pulse_microseconds microseconds, independent of the step timer prescaler.
+    hal_pulse_timer_start(step_pulse_time);
   #endif
-  // Enable step pulse reset timer so that The Stepper Port Reset Interrupt can reset the signal after
-  // exactly settings.pulse_microseconds microseconds, independent of the main Timer1 prescaler.
-  TCNT2 = step_pulse_time; // Reload timer counter
-  TCCR2B = (1<<CS21); // Begin timer2. Full speed, 1/8 prescaler
 
   busy = true;
-  // Re-enable interrupts to allow ISR_TIMER2_OVERFLOW to trigger on-time and allow serial communications
+  // Re-enable interrupts to allow the step pulse reset interrupt to trigger on-time and allow serial communications
   // regardless of time in this handler. The following code prepares the stepper driver for the next
   // step interrupt compare and will always finish before returning to the main program.
   sei();
   
-  // If there is no current block, attempt to pop one from the buffer
-  if (current_block == NULL) {
-    // Anything in the buffer? If so, initialize next motion.
-    current_block = plan_get_current_block();
-    if (current_block != NULL) {
-      if (sys.state == STATE_CYCLE) {
-        // During feed hold, do not update rate and trap counter. Keep decelerating.
-        st.trapezoid_adjusted_rate = current_block->initial_rate;
-        set_step_events_per_minute(st.trapezoid_adjusted_rate); // Initialize cycles_per_step_event
-        st.trapezoid_tick_cycle_counter = CYCLES_PER_ACCELERATION_TICK/2; // Start halfway for midpoint rule.
+  // If there is no segment being executed, attempt to pop one from the segment buffer
+  if (st.exec_segment == NULL) {
+    // Execute any spindle and coolant events first. They are reached right after the last step of
+    // the motion before them, which has just been pulsed.
+    while ((segment_buffer_head != segment_buffer_tail) && (segment_buffer[segment_buffer_tail].n_step == 0)) {
+      st_execute_sync_event(segment_buffer[segment_buffer_tail].prescaler, segment_buffer[segment_buffer_tail].ceiling);
+      segment_buffer_tail = next_segment_index(segment_buffer_tail);
+    }
+    // Anything in the buffer? If so, load and initialize next step segment.
+    if (segment_buffer_head != segment_buffer_tail) {
+      st.exec_segment = &segment_buffer[segment_buffer_tail];
+      // Load the segment step rate into the step timer. Takes effect on the next step event.
+      hal_step_timer_set_rate(st.exec_segment->prescaler, st.exec_segment->ceiling);
+      #ifdef STEPPER_ISR_STATS
+        if (st.exec_segment->prescaler == 1) {
+          if ((st.exec_segment->ceiling < stats.min_ceiling) || !stats.min_ceiling) { 
+            stats.min_ceiling = st.exec_segment->ceiling; 
+          }
+        }
+      #endif
+      st.step_count = st.exec_segment->n_step;
+      // If the new segment starts a new planner block, initialize the Bresenham counters. Segments
+      // continuing the same block, including those prepped after a feed hold, keep them intact.
+      if (st.exec_block_index != st.exec_segment->st_block_index) {
+        st.exec_block_index = st.exec_segment->st_block_index;
+        st.exec_block = &st_block_buffer[st.exec_block_index];
+        int32_t counter_init = -(st.exec_block->step_event_count >> 1);
+        #define INIT_AXIS_COUNTER(idx) st.counter[idx] = counter_init;
+        FOR_EACH_AXIS(INIT_AXIS_COUNTER)
+        #undef INIT_AXIS_COUNTER
+        #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+          st.exec_amass_level = 0xff; // Force reload of the step counts below.
+        #else
+          #define LOAD_AXIS_STEPS(idx) st.steps[idx] = st.exec_block->steps[idx];
+          FOR_EACH_AXIS(LOAD_AXIS_STEPS)
+          #undef LOAD_AXIS_STEPS
+        #endif
       }
-      st.min_safe_rate = current_block->rate_delta + (current_block->rate_delta >> 1); // 1.5 x rate_delta
-      st.counter_x = -(current_block->step_event_count >> 1);
-      st.counter_y = st.counter_x;
-      st.counter_z = st.counter_x;
-      st.event_count = current_block->step_event_count;
-      st.step_events_completed = 0;     
+      #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+        // With AMASS enabled, adjust Bresenham axis increment counters according to AMASS level. The
+        // variable 32-bit shifts are costly on the AVR, so they are only redone when the level changes,
+        // which is only a few times per acceleration ramp. Most segments load with just a compare.
+        if (st.exec_amass_level != st.exec_segment->amass_level) {
+          st.exec_amass_level = st.exec_segment->amass_level;
+          #define LOAD_AXIS_STEPS(idx) st.steps[idx] = st.exec_block->steps[idx] >> st.exec_amass_level;
+          FOR_EACH_AXIS(LOAD_AXIS_STEPS)
+          #undef LOAD_AXIS_STEPS
+        }
+      #endif
     } else {
+      // Segment buffer empty. Shutdown. The main program determines if this is the end of the
+      // cycle, a completed feed hold, or a buffer underrun.
       st_go_idle();
       bit_true(sys.execute,EXEC_CYCLE_STOP); // Flag main program for cycle end
-    }    
-  } 
-
-  if (current_block != NULL) {
-    // Execute step displacement profile by bresenham line algorithm
-    out_bits = current_block->direction_bits;
-    st.counter_x += current_block->steps_x;
-    if (st.counter_x > 0) {
-      out_bits |= (1<<X_STEP_BIT);
-      st.counter_x -= st.event_count;
-      if (out_bits & (1<<X_DIRECTION_BIT)) { sys.position[X_AXIS]--; }
-      else { sys.position[X_AXIS]++; }
+      busy = false;
+      return;
     }
-    st.counter_y += current_block->steps_y;
-    if (st.counter_y > 0) {
-      out_bits |= (1<<Y_STEP_BIT);
-      st.counter_y -= st.event_count;
-      if (out_bits & (1<<Y_DIRECTION_BIT)) { sys.position[Y_AXIS]--; }
-      else { sys.position[Y_AXIS]++; }
-    }
-    st.counter_z += current_block->steps_z;
-    if (st.counter_z > 0) {
-      out_bits |= (1<<Z_STEP_BIT);
-      st.counter_z -= st.event_count;
-      if (out_bits & (1<<Z_DIRECTION_BIT)) { sys.position[Z_AXIS]--; }
-      else { sys.position[Z_AXIS]++; }
-    }
-    
-    st.step_events_completed++; // Iterate step events
-
-    // While in block steps, check for de/ac-celeration events and execute them accordingly.
-    if (st.step_events_completed < current_block->step_event_count) {
-      if (sys.state == STATE_HOLD) {
-        // Check for and execute feed hold by enforcing a steady deceleration from the moment of 
-        // execution. The rate of deceleration is limited by rate_delta and will never decelerate
-        // faster or slower than in normal operation. If the distance required for the feed hold 
-        // deceleration spans more than one block, the initial rate of the following blocks are not
-        // updated and deceleration is continued according to their corresponding rate_delta.
-        // NOTE: The trapezoid tick cycle counter is not updated intentionally. This ensures that 
-        // the deceleration is smooth regardless of where the feed hold is initiated and if the
-        // deceleration distance spans multiple blocks.
-        if ( iterate_trapezoid_cycle_counter() ) {                    
-          // If deceleration complete, set system flags and shutdown steppers.
-          if (st.trapezoid_adjusted_rate <= current_block->rate_delta) {
-            // Just go idle. Do not NULL current block. The bresenham algorithm variables must
-            // remain intact to ensure the stepper path is exactly the same. Feed hold is still
-            // active and is released after the buffer has been reinitialized.
-            st_go_idle();
-            bit_true(sys.execute,EXEC_CYCLE_STOP); // Flag main program that feed hold is complete.
-          } else {
-            st.trapezoid_adjusted_rate -= current_block->rate_delta;
-            set_step_events_per_minute(st.trapezoid_adjusted_rate);
-          }      
-        }
-        
-      } else {
-        // The trapezoid generator always checks step event location to ensure de/ac-celerations are 
-        // executed and terminated at exactly the right time. This helps prevent over/under-shooting
-        // the target position and speed. 
-        // NOTE: By increasing the ACCELERATION_TICKS_PER_SECOND in config.h, the resolution of the 
-        // discrete velocity changes increase and accuracy can increase as well to a point. Numerical 
-        // round-off errors can effect this, if set too high. This is important to note if a user has 
-        // very high acceleration and/or feedrate requirements for their machine.
-        if (st.step_events_completed < current_block->accelerate_until) {
-          // Iterate cycle counter and check if speeds need to be increased.
-          if ( iterate_trapezoid_cycle_counter() ) {
-            st.trapezoid_adjusted_rate += current_block->rate_delta;
-            if (st.trapezoid_adjusted_rate >= current_block->nominal_rate) {
-              // Reached nominal rate a little early. Cruise at nominal rate until decelerate_after.
-              st.trapezoid_adjusted_rate = current_block->nominal_rate;
-            }
-            set_step_events_per_minute(st.trapezoid_adjusted_rate);
-          }
-        } else if (st.step_events_completed >= current_block->decelerate_after) {
-          // Reset trapezoid tick cycle counter to make sure that the deceleration is performed the
-          // same every time. Reset to CYCLES_PER_ACCELERATION_TICK/2 to follow the midpoint rule for
-          // an accurate approximation of the deceleration curve. For triangle profiles, down count
-          // from current cycle counter to ensure exact deceleration curve.
-          if (st.step_events_completed == current_block-> decelerate_after) {
-            if (st.trapezoid_adjusted_rate == current_block->nominal_rate) {
-              st.trapezoid_tick_cycle_counter = CYCLES_PER_ACCELERATION_TICK/2; // Trapezoid profile
-            } else {  
-              st.trapezoid_tick_cycle_counter = CYCLES_PER_ACCELERATION_TICK-st.trapezoid_tick_cycle_counter; // Triangle profile
-            }
-          } else {
-            // Iterate cycle counter and check if speeds need to be reduced.
-            if ( iterate_trapezoid_cycle_counter() ) {  
-              // NOTE: We will only do a full speed reduction if the result is more than the minimum safe 
-              // rate, initialized in trapezoid reset as 1.5 x rate_delta. Otherwise, reduce the speed by
-              // half increments until finished. The half increments are guaranteed not to exceed the 
-              // CNC acceleration limits, because they will never be greater than rate_delta. This catches
-              // small errors that might leave steps hanging after the last trapezoid tick or a very slow
-              // step rate at the end of a full stop deceleration in certain situations. The half rate 
-              // reductions should only be called once or twice per block and create a nice smooth 
-              // end deceleration.
-              if (st.trapezoid_adjusted_rate > st.min_safe_rate) {
-                st.trapezoid_adjusted_rate -= current_block->rate_delta;
-              } else {
-                st.trapezoid_adjusted_rate >>= 1; // Bit shift divide by 2
-              }
-              if (st.trapezoid_adjusted_rate < current_block->final_rate) {
-                // Reached final rate a little early. Cruise to end of block at final rate.
-                st.trapezoid_adjusted_rate = current_block->final_rate;
-              }
-              set_step_events_per_minute(st.trapezoid_adjusted_rate);
-            }
-          }
-        } else {
-          // No accelerations. Make sure we cruise exactly at the nominal rate.
-          if (st.trapezoid_adjusted_rate != current_block->nominal_rate) {
-            st.trapezoid_adjusted_rate = current_block->nominal_rate;
-            set_step_events_per_minute(st.trapezoid_adjusted_rate);
-          }
-        }
-      }            
-    } else {   
-      // If current block is finished, reset pointer 
-      current_block = NULL;
-      plan_discard_current_block();
+  }
+
+  // Execute step displacement profile by bresenham line algorithm. During a homing motion, axes
+  // locked by their limit switch stop stepping from the next step event on, while the rest continue.
+  // NOTE: Unrolled per axis at compile time, so all array offsets and pin bits are constants. 
+  uint8_t axis_lock = sys.homing_axis_lock; // Always zero outside of homing.
+  out_bits = st.exec_block->direction_bits;
+  #define STEP_AXIS(idx) \
+    st.counter[idx] += st.steps[idx]; \
+    if (st.counter[idx] > 0) { \
+      st.counter[idx] -= st.exec_block->step_event_count; \
+      if (!(axis_lock & (1<<idx))) { \
+        out_bits |= (1<<STEP_BIT_##idx); \
+        if (out_bits & (1<<DIRECTION_BIT_##idx)) { sys.position[idx]--; } \
+        else { sys.position[idx]++; } \
+      } \
     }
+  FOR_EACH_AXIS(STEP_AXIS)
+  #undef STEP_AXIS
+  
+  // Check if the segment is complete. If so, release it back to the segment preparation routine.
+  st.step_count--;
+  if (st.step_count == 0) {
+    st.exec_segment = NULL;
+    segment_buffer_tail = next_segment_index(segment_buffer_tail);
   }
+
   out_bits ^= settings.invert_mask;  // Apply step and direction invert mask    
+  #ifdef STEP_PULSE_LATCHED
+    // Latch the next step pulse. If the current step pulse has already ended, set the direction pins
+    // for it now. Otherwise, the step pulse reset interrupt sets them, when it ends the pulse.
+    step_latch = out_bits;
+    if (!hal_pulse_timer_running()) {
+      STEPPING_PORT = (STEPPING_PORT & ~DIRECTION_MASK) | (out_bits & DIRECTION_MASK);
+    }
+  #endif
+  
+  #ifdef STEPPER_ISR_STATS
+    // The step timer counter has counted the CPU cycles since the compare match, which includes
+    // the interrupt latency and any nested interrupts, i.e. the actual time used of the deadline.
+    if (sample_cycles) {
+      uint16_t cycles = hal_step_timer_count();
+      if (cycles > stats.isr_max_cycles) { stats.isr_max_cycles = cycles; }
+      if (stats.isr_count == 0xffff) { // Halve both to keep the average without overflowing.
+        stats.isr_sum_cycles >>= 1;
+        stats.isr_count >>= 1;
+      }
+      stats.isr_sum_cycles += cycles;
+      stats.isr_count++;
+    }
+  #endif
   busy = false;
 }
 
-// This interrupt is set up by ISR_TIMER1_COMPAREA when it sets the motor port bits. It resets
+// This interrupt is set up by the stepper driver interrupt when it sets the motor port bits. It resets
 // the motor port after a short period (settings.pulse_microseconds) completing one step cycle.
 // NOTE: Interrupt collisions between the serial and stepper interrupts can cause delays by
 // a few microseconds, if they execute right before one another. Not a big deal, but can
 // cause issues at high step rates if another high frequency asynchronous interrupt is 
 // added to Grbl.
-ISR(TIMER2_OVF_vect)
+ISR(HAL_PULSE_TIMER_vect)
 {
-  // Reset stepping pins (leave the direction pins)
-  STEPPING_PORT = (STEPPING_PORT & ~STEP_MASK) | (settings.invert_mask & STEP_MASK); 
-  TCCR2B = 0; // Disable Timer2 to prevent re-entering this interrupt when it's not needed. 
+  #ifdef STEP_PULSE_LATCHED
+    // Reset stepping pins and set the direction pins of the latched next step pulse
+    STEPPING_PORT = (STEPPING_PORT & ~STEPPING_MASK) | (step_latch & DIRECTION_MASK) |
+                    (settings.invert_mask & STEP_MASK);
+  #else
+    // Reset stepping pins (leave the direction pins)
+    STEPPING_PORT = (STEPPING_PORT & ~STEP_MASK) | (settings.invert_mask & STEP_MASK); 
+  #endif
+  hal_pulse_timer_stop(); // Prevents re-entering this interrupt when it's not needed.
 }
 
 #ifdef STEP_PULSE_DELAY
   // This interrupt is used only when STEP_PULSE_DELAY is enabled. Here, the step pulse is
-  // initiated after the STEP_PULSE_DELAY time period has elapsed. The ISR TIMER2_OVF interrupt
+  // initiated after the STEP_PULSE_DELAY time period has elapsed. The step pulse reset interrupt
   // will then trigger after the appropriate settings.pulse_microseconds, as in normal operation.
   // The new timing between direction, step pulse, and step complete events are setup in the
   // st_wake_up() routine.
-  ISR(TIMER2_COMPA_vect) 
+  ISR(HAL_PULSE_DELAY_vect) 
   { 
     STEPPING_PORT = step_bits; // Begin step pulse.
   }
@@ -347,11 +436,52 @@ ISR(TIMER2_OVF_vect)
 void st_reset()
 {
   memset(&st, 0, sizeof(st));
-  set_step_events_per_minute(MINIMUM_STEPS_PER_MINUTE);
-  current_block = NULL;
+  memset(&prep, 0, sizeof(prep));
+  segment_buffer_tail = 0;
+  segment_buffer_head = 0; 
+  segment_next_head = 1;
+  // Initialize the step timer to the minimum rate. Also loaded by the ISR upon each new segment.
+  segment_t idle_segment;
+  config_step_timer(&idle_segment, (TICKS_PER_MICROSECOND*1000000*60)/MINIMUM_STEPS_PER_MINUTE);
+  hal_step_timer_set_rate(idle_segment.prescaler, idle_segment.ceiling);
   busy = false;
 }
 
+// Abruptly stops all motion, without a deceleration, and keeps the steppers enabled and holding. 
+// Only the homing cycle uses this, once all axes have stopped stepping at their limit switches.
+void st_halt()
+{
+  hal_step_timer_disable(); // Disable stepper driver interrupt
+  st_reset();
+  bit_false(sys.execute,EXEC_CYCLE_STOP); // Discard any cycle stop flagged while halting.
+}
+
+// Returns the feed rate in mm/min of the last prepped segment, which the steppers reach within the
+// few acceleration ticks in the segment buffer. Zero when no planner block is being prepped.
+float st_get_realtime_rate()
+{
+  if (prep.pl_block == NULL) { return(0.0); }
+  return((prep.current_rate*prep.pl_block->millimeters)/prep.pl_block->step_event_count);
+}
+
+// Executes a spindle or coolant event. Called by the stepper ISR when the motion stream reaches the
+// event, or by motion control directly when there is no motion to wait for.
+void st_execute_sync_event(uint8_t event, int8_t value)
+{
+  if (event == PLAN_EVENT_SPINDLE) { spindle_set_direction(value); }
+  else { coolant_set_mode(value); }
+}
+
+#ifdef STEPPER_ISR_STATS
+  void st_read_stats(st_stats_t *stats_out)
+  {
+    cli();
+    memcpy(stats_out,(st_stats_t *)&stats,sizeof(st_stats_t));
+    memset((st_stats_t *)&stats,0,sizeof(st_stats_t));
+    sei();
+  }
+#endif
+
 // Initialize and start the stepper motor subsystem
 void st_init()
 {
@@ -360,73 +490,329 @@ void st_init()
   STEPPING_PORT = (STEPPING_PORT & ~STEPPING_MASK) | settings.invert_mask;
   STEPPERS_DISABLE_DDR |= 1<<STEPPERS_DISABLE_BIT;
 
-  // waveform generation = 0100 = CTC
-  TCCR1B &= ~(1<<WGM13);
-  TCCR1B |=  (1<<WGM12);
-  TCCR1A &= ~(1<<WGM11); 
-  TCCR1A &= ~(1<<WGM10);
-
-  // output mode = 00 (disconnected)
-  TCCR1A &= ~(3<<COM1A0); 
-  TCCR1A &= ~(3<<COM1B0); 
-	
-  // Configure Timer 2
-  TCCR2A = 0; // Normal operation
-  TCCR2B = 0; // Disable timer until needed.
-  TIMSK2 |= (1<<TOIE2); // Enable Timer2 Overflow interrupt     
-  #ifdef STEP_PULSE_DELAY
-    TIMSK2 |= (1<<OCIE2A); // Enable Timer2 Compare Match A interrupt
-  #endif
+  // Configure the step timer and the step pulse timer, which is disabled until needed.
+  hal_step_timer_init();
+  hal_pulse_timer_init();
 
   // Start in the idle state, but first wake up to check for keep steppers enabled option.
   st_wake_up();
   st_go_idle();
 }
 
-// Configures the prescaler and ceiling of timer 1 to produce the given rate as accurately as possible.
-// Returns the actual number of cycles per interrupt
-static uint32_t config_step_timer(uint32_t cycles)
+// Computes the prescaler and ceiling of the 16-bit step timer to produce the given rate as accurately as possible
+// and stores them in the segment. The ISR loads them into the timer when it begins the segment.
+static void config_step_timer(segment_t *segment, uint32_t cycles)
 {
-  uint16_t ceiling;
-  uint8_t prescaler;
-  uint32_t actual_cycles;
   if (cycles <= 0xffffL) {
-    ceiling = cycles;
-    prescaler = 1; // prescaler: 0
-    actual_cycles = ceiling;
+    segment->ceiling = cycles;
+    segment->prescaler = 1; // prescaler: 0
   } else if (cycles <= 0x7ffffL) {
-    ceiling = cycles >> 3;
-    prescaler = 2; // prescaler: 8
-    actual_cycles = ceiling * 8L;
+    segment->ceiling = cycles >> 3;
+    segment->prescaler = 2; // prescaler: 8
   } else if (cycles <= 0x3fffffL) {
-    ceiling =  cycles >> 6;
-    prescaler = 3; // prescaler: 64
-    actual_cycles = ceiling * 64L;
+    segment->ceiling =  cycles >> 6;
+    segment->prescaler = 3; // prescaler: 64
   } else if (cycles <= 0xffffffL) {
-    ceiling =  (cycles >> 8);
-    prescaler = 4; // prescaler: 256
-    actual_cycles = ceiling * 256L;
+    segment->ceiling =  (cycles >> 8);
+    segment->prescaler = 4; // prescaler: 256
   } else if (cycles <= 0x3ffffffL) {
-    ceiling = (cycles >> 10);
-    prescaler = 5; // prescaler: 1024
-    actual_cycles = ceiling * 1024L;    
+    segment->ceiling = (cycles >> 10);
+    segment->prescaler = 5; // prescaler: 1024
   } else {
     // Okay, that was slower than we actually go. Just set the slowest speed
-    ceiling = 0xffff;
-    prescaler = 5;
-    actual_cycles = 0xffff * 1024;
+    segment->ceiling = 0xffff;
+    segment->prescaler = 5;
   }
-  // Set prescaler
-  TCCR1B = (TCCR1B & ~(0x07<<CS10)) | (prescaler<<CS10);
-  // Set ceiling
-  OCR1A = ceiling;
-  return(actual_cycles);
 }
 
-static void set_step_events_per_minute(uint32_t steps_per_minute) 
+#ifdef JERK_LIMITED_ACCELERATION
+  // Plans the S-curve ramp of a trapezoid phase from the current rate to the target rate. The 
+  // acceleration ramps up at the jerk setting, holds at the acceleration setting, given by rate_delta,
+  // and ramps down again. A ramp too short to reach the acceleration ramps it up and down only. The
+  // ramp takes longer than the linear ramp, which the planner accounts for in the trapezoid phases.
+  static void st_prep_ramp(uint8_t ramp_phase, uint32_t ramp_end, uint32_t limit_rate, 
+                           uint32_t target_rate, uint32_t rate_delta)
+  {
+    prep.ramp_phase = ramp_phase;
+    prep.ramp_end = ramp_end;
+    prep.ramp_limit_rate = limit_rate;
+    prep.ramp_initial_rate = prep.current_rate;
+    prep.ramp_rate_change = (float)target_rate - (float)prep.current_rate;
+    prep.ramp_time = 0.0;
+    float rate_change = fabs(prep.ramp_rate_change);
+    if (rate_change*prep.jerk >= (float)rate_delta*rate_delta) {
+      prep.ramp_jerk_time = rate_delta/prep.jerk;
+      prep.ramp_duration = rate_change/rate_delta + prep.ramp_jerk_time;
+    } else {
+      prep.ramp_jerk_time = sqrt(rate_change/prep.jerk);
+      prep.ramp_duration = 2*prep.ramp_jerk_time;
+    }
+    prep.ramp_jerk = prep.jerk;
+    if (prep.ramp_rate_change < 0.0) { prep.ramp_jerk = -prep.ramp_jerk; }
+  }
+
+  // Returns the step rate of the S-curve ramp at the given time into the ramp.
+  static uint32_t st_ramp_rate(float t)
+  {
+    float rate_change;
+    if (t >= prep.ramp_duration) {
+      rate_change = prep.ramp_rate_change;
+    } else if (t < prep.ramp_jerk_time) {
+      rate_change = 0.5*prep.ramp_jerk*t*t;
+    } else if (t > prep.ramp_duration-prep.ramp_jerk_time) {
+      t = prep.ramp_duration-t;
+      rate_change = prep.ramp_rate_change - 0.5*prep.ramp_jerk*t*t;
+    } else {
+      rate_change = prep.ramp_jerk*prep.ramp_jerk_time*(t-0.5*prep.ramp_jerk_time);
+    }
+    float rate = prep.ramp_initial_rate + rate_change;
+    if (rate < 0.0) { return(0); }
+    return(lround(rate));
+  }
+#endif
+
+/* Prepares step segments from the first block in the planner buffer and stores them in the segment
+   buffer until it is full. Called continuously by the main program through the runtime command 
+   execution checkpoints, since the segment buffer only holds a fraction of a second of motion.
+   
+   Each segment covers one acceleration tick of the block trapezoid, or less if it ends at an 
+   acceleration, cruise, deceleration or block boundary, and runs at the constant midpoint rate of
+   that tick. The step timer prescaler and ceiling are computed here, so the expensive 32-bit divide 
+   is performed once per segment in the main program rather than in the stepper ISR. The planner block
+   trapezoid is computed when the block is loaded and again whenever the planner flags it as changed,
+   so any replanning of the first block by the planner is picked up, exactly as the stepper ISR did
+   previously.
+   
+   During a feed hold, the segments enforce a steady deceleration from the rate of the last prepped
+   segment, limited by the rate_delta of each block and regardless of the block trapezoids. If the
+   deceleration spans more than one block, it continues into the following blocks. When the rate 
+   reaches zero, no more segments are prepped and the steppers stop once the buffer has been emptied.
+   NOTE: Segments already in the buffer are executed as planned, so the feed hold deceleration begins
+   at most SEGMENT_BUFFER_SIZE-1 acceleration ticks after it is initiated.
+   
+   With JERK_LIMITED_ACCELERATION, the acceleration ramps of each block follow an S-curve, which is
+   planned from the current rate as the segments enter the ramp, and again, if the planner or an
+   override changes the ramp target. The feed hold deceleration remains linear.
+*/
+void st_prep_buffer()
 {
-  if (steps_per_minute < MINIMUM_STEPS_PER_MINUTE) { steps_per_minute = MINIMUM_STEPS_PER_MINUTE; }
-  st.cycles_per_step_event = config_step_timer((TICKS_PER_MICROSECOND*1000000*60)/steps_per_minute);
+  // Only prep segments when a cycle, jog, or homing motion is active. A queued cycle is primed by 
+  // st_cycle_start().
+  if ((sys.state != STATE_CYCLE) && (sys.state != STATE_HOLD) && (sys.state != STATE_JOG) && 
+      (sys.state != STATE_HOMING)) { return; }
+
+  while (segment_next_head != segment_buffer_tail) { // Check if we need to fill the buffer.
+
+    // Determine if we need to load a new planner block. 
+    if (prep.pl_block == NULL) {
+      prep.pl_block = plan_get_current_block(); // Query planner for a queued block
+      if (prep.pl_block == NULL) { // No planner blocks. Exit.
+        // Count the planner buffer underruns of a running cycle. The end of a program counts as one.
+        if (!prep.starved && (sys.state == STATE_CYCLE)) { plan_telemetry.underruns++; }
+        prep.starved = true;
+        return; 
+      }
+      prep.starved = false;
+      if (sys.state == STATE_CYCLE) { 
+        uint8_t depth = plan_get_block_buffer_count();
+        if (depth < plan_telemetry.min_depth) { plan_telemetry.min_depth = depth; }
+      }
+
+      // Spindle and coolant events take no time. Queue them for the stepper ISR as a segment without
+      // step events and move on to the next planner block. A dwell is prepped like a motion block.
+      if ((prep.pl_block->sync_event == PLAN_EVENT_SPINDLE) || (prep.pl_block->sync_event == PLAN_EVENT_COOLANT)) {
+        segment_t *prep_segment = &segment_buffer[segment_buffer_head];
+        prep_segment->n_step = 0;
+        prep_segment->prescaler = prep.pl_block->sync_event;
+        prep_segment->ceiling = prep.pl_block->event_value;
+        segment_buffer_head = segment_next_head;
+        segment_next_head = next_segment_index(segment_buffer_head);
+        prep.pl_block = NULL;
+        plan_discard_current_block();
+        continue;
+      }
+                        
+      // Copy the Bresenham line data of the new planner block into the next stepper block slot. The
+      // step-less dwell keeps the direction pins of the last block as they are.
+      uint8_t direction_bits = st_block_buffer[prep.st_block_index].direction_bits;
+      if (!prep.pl_block->sync_event) { direction_bits = prep.pl_block->direction_bits; }
+      prep.st_block_index = next_st_block_index(prep.st_block_index);
+      st_block_t *st_prep_block = &st_block_buffer[prep.st_block_index];
+      st_prep_block->direction_bits = direction_bits;
+      #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+        // With AMASS enabled, simply bit-shift multiply all Bresenham data by the max AMASS level, 
+        // such that we never divide beyond the original data anywhere in the algorithm.
+        #define COPY_AXIS_STEPS(idx) st_prep_block->steps[idx] = prep.pl_block->steps[idx] << MAX_AMASS_LEVEL;
+        st_prep_block->step_event_count = prep.pl_block->step_event_count << MAX_AMASS_LEVEL;
+      #else
+        #define COPY_AXIS_STEPS(idx) st_prep_block->steps[idx] = prep.pl_block->steps[idx];
+        st_prep_block->step_event_count = prep.pl_block->step_event_count;
+      #endif
+      FOR_EACH_AXIS(COPY_AXIS_STEPS)
+      #undef COPY_AXIS_STEPS
+
+      prep.step_events_remaining = prep.pl_block->step_event_count;
+      prep.rate_delta = plan_get_rate_delta(prep.pl_block);
+      prep.min_safe_rate = prep.rate_delta + (prep.rate_delta >> 1); // 1.5 x rate_delta
+      // During feed hold, do not update rate. Keep decelerating.
+      if (sys.state != STATE_HOLD) { prep.current_rate = plan_get_initial_rate(prep.pl_block); }
+      prep.pl_block->trapezoid_flag = true;
+      #ifdef JERK_LIMITED_ACCELERATION
+        // Convert the jerk setting to the step rate units of the block, like rate_delta. 
+        prep.jerk = 0.0;
+        prep.ramp_phase = RAMP_NONE;
+        if ((settings.jerk > 0.0) && (!prep.pl_block->sync_event)) {
+          prep.jerk = settings.jerk*prep.pl_block->step_event_count/
+            (prep.pl_block->millimeters*ACCELERATION_TICKS_PER_MINUTE*ACCELERATION_TICKS_PER_MINUTE);
+        }
+      #endif
+    }
+    block_t *pl_block = prep.pl_block;
+    if (pl_block->trapezoid_flag) { plan_get_current_trapezoid(&prep.trapezoid); }
+
+    // Determine the rate at the end of the next acceleration tick and the number of step events to
+    // the next trapezoid phase boundary, which the segment must not cross.
+    uint32_t step_events_completed = pl_block->step_event_count - prep.step_events_remaining;
+    uint32_t phase_steps = prep.step_events_remaining;
+    uint32_t rate_final;
+    if (sys.state == STATE_HOLD) {
+      // Feed hold deceleration. If complete, stop prepping. The steppers go idle and flag the main 
+      // program once the buffer empties. The partially completed block remains in the planner.
+      if (prep.current_rate <= prep.rate_delta) {
+        prep.current_rate = 0;
+        return;
+      }
+      rate_final = prep.current_rate - prep.rate_delta;
+      #ifdef JERK_LIMITED_ACCELERATION
+        prep.ramp_phase = RAMP_NONE; // Plan a new ramp upon resuming.
+      #endif
+    } else if (step_events_completed < prep.trapezoid.accelerate_until) {
+      phase_steps = prep.trapezoid.accelerate_until - step_events_completed;
+      if (prep.current_rate > prep.trapezoid.nominal_rate) {
+        // Override deceleration to a reduced nominal rate. See calculate_trapezoid_for_block().
+        rate_final = prep.current_rate - prep.rate_delta;
+        if ((rate_final < prep.trapezoid.nominal_rate) || (prep.current_rate <= prep.rate_delta)) { 
+          rate_final = prep.trapezoid.nominal_rate; 
+        }
+      } else {
+        rate_final = prep.current_rate + prep.rate_delta;
+        // Reached nominal rate a little early. Cruise at nominal rate until decelerate_after.
+        if (rate_final > prep.trapezoid.nominal_rate) { rate_final = prep.trapezoid.nominal_rate; }
+      }
+    } else if (step_events_completed < prep.trapezoid.decelerate_after) {
+      // No accelerations. Make sure we cruise exactly at the nominal rate.
+      phase_steps = prep.trapezoid.decelerate_after - step_events_completed;
+      prep.current_rate = prep.trapezoid.nominal_rate;
+      rate_final = prep.current_rate;
+    } else {
+      // NOTE: We will only do a full speed reduction if the result is more than the minimum safe 
+      // rate, initialized as 1.5 x rate_delta. Otherwise, reduce the speed by half increments until 
+      // finished. The half increments are guaranteed not to exceed the CNC acceleration limits, 
+      // because they will never be greater than rate_delta. This catches small errors that might 
+      // leave steps hanging after the last trapezoid tick or a very slow step rate at the end of a 
+      // full stop deceleration in certain situations.
+      if (prep.current_rate > prep.min_safe_rate) {
+        rate_final = prep.current_rate - prep.rate_delta;
+      } else {
+        rate_final = prep.current_rate >> 1; // Bit shift divide by 2
+      }
+      // Reached final rate a little early. Cruise to end of block at final rate.
+      if (rate_final < prep.trapezoid.final_rate) { rate_final = prep.trapezoid.final_rate; }
+    }
+
+    #ifdef JERK_LIMITED_ACCELERATION
+      // Follow the S-curve of the acceleration or deceleration phase instead, if the block has one.
+      // Plan a new ramp upon entering a phase, or when the planner or an override moves its target.
+      uint8_t ramp_phase = RAMP_NONE;
+      if ((prep.jerk > 0.0) && (sys.state != STATE_HOLD)) {
+        uint32_t ramp_end = pl_block->step_event_count;
+        uint32_t limit_rate = prep.trapezoid.final_rate;
+        if (step_events_completed < prep.trapezoid.accelerate_until) {
+          ramp_end = prep.trapezoid.accelerate_until;
+          limit_rate = prep.trapezoid.nominal_rate;
+          if (prep.current_rate > limit_rate) { ramp_phase = RAMP_OVERRIDE; }
+          else { ramp_phase = RAMP_ACCEL; }
+        } else if (step_events_completed >= prep.trapezoid.decelerate_after) {
+          ramp_phase = RAMP_DECEL;
+        }
+        if (ramp_phase != RAMP_NONE) {
+          if ((ramp_phase != prep.ramp_phase) || (ramp_end != prep.ramp_end) || (limit_rate != prep.ramp_limit_rate)) {
+            uint32_t target_rate = limit_rate;
+            if (ramp_phase == RAMP_ACCEL) {
+              // The peak rate of the accel phase, below the nominal rate for a triangle profile.
+              float peak_rate = plan_ramp_max_speed(prep.current_rate, 
+                (float)phase_steps*ACCELERATION_TICKS_PER_MINUTE, prep.rate_delta, prep.jerk);
+              if (peak_rate < target_rate) { target_rate = lround(peak_rate); }
+            }
+            st_prep_ramp(ramp_phase, ramp_end, limit_rate, target_rate, prep.rate_delta);
+          }
+          rate_final = st_ramp_rate(prep.ramp_time+1.0);
+        }
+      }
+    #endif
+
+    // Compute the segment rate by the midpoint rule and the number of step events it executes 
+    // during one acceleration tick. Always execute at least one step event. The step count is 
+    // truncated and may be clipped at the next phase boundary, so prorate the rate change to the 
+    // actual duration of the segment to keep the de/ac-celeration exact over time.
+    uint32_t segment_rate = (prep.current_rate + rate_final) >> 1;
+    if (segment_rate < MINIMUM_STEPS_PER_MINUTE) { segment_rate = MINIMUM_STEPS_PER_MINUTE; }
+    uint32_t n_step = segment_rate/ACCELERATION_TICKS_PER_MINUTE;
+    if (n_step == 0) { n_step = 1; }
+    if (n_step > phase_steps) { n_step = phase_steps; }
+    if (rate_final != prep.current_rate) {
+      float tick_fraction = ((float)n_step*ACCELERATION_TICKS_PER_MINUTE)/segment_rate;
+      if (rate_final > prep.current_rate) { 
+        rate_final = prep.current_rate + lround(tick_fraction*(rate_final-prep.current_rate));
+        if (rate_final > prep.trapezoid.nominal_rate) { rate_final = prep.trapezoid.nominal_rate; }
+      } else {
+        uint32_t rate_change = lround(tick_fraction*(prep.current_rate-rate_final));
+        if (rate_change >= prep.current_rate) { rate_final = 0; }
+        else { rate_final = prep.current_rate - rate_change; }
+        if ((sys.state != STATE_HOLD) && (rate_final < prep.trapezoid.final_rate)) { rate_final = prep.trapezoid.final_rate; }
+      }
+    }
+    #ifdef JERK_LIMITED_ACCELERATION
+      if (ramp_phase != RAMP_NONE) {
+        // Advance the S-curve by the actual duration of the segment, instead of prorating linearly.
+        prep.ramp_time += ((float)n_step*ACCELERATION_TICKS_PER_MINUTE)/segment_rate;
+        rate_final = st_ramp_rate(prep.ramp_time);
+      }
+    #endif
+
+    // Store the segment and update the segment buffer head index.
+    segment_t *prep_segment = &segment_buffer[segment_buffer_head];
+    prep_segment->st_block_index = prep.st_block_index;    
+    prep_segment->n_step = n_step;
+    uint32_t cycles = (TICKS_PER_MICROSECOND*1000000*60)/segment_rate; // (cycles/step event)
+    #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+      // Compute the multi-axis smoothing level for slow segments. The ISR is over-driven by the
+      // level factor, so the timer stays in its high resolution prescaler range and the segment
+      // executes the scaled number of ISR step events over the same time.
+      if (cycles < AMASS_LEVEL1) { prep_segment->amass_level = 0; }
+      else {
+        if (cycles < AMASS_LEVEL2) { prep_segment->amass_level = 1; }
+        else if (cycles < AMASS_LEVEL3) { prep_segment->amass_level = 2; }
+        else { prep_segment->amass_level = 3; }
+        cycles >>= prep_segment->amass_level;
+        prep_segment->n_step <<= prep_segment->amass_level;
+      }
+    #endif
+    config_step_timer(prep_segment, cycles);
+    segment_buffer_head = segment_next_head;
+    segment_next_head = next_segment_index(segment_buffer_head);
+    
+    prep.current_rate = rate_final;
+    prep.step_events_remaining -= n_step;
+
+    // Check for exit conditions and flag to load next planner block.
+    if (prep.step_events_remaining == 0) {
+      // The planner block is complete. All of its data is now held by the segment buffer and 
+      // the stepper block buffer. Discard it to make room in the planner for new blocks.
+      prep.pl_block = NULL;
+      plan_discard_current_block();
+    }
+  }
 }
 
 // Planner external interface to start stepper interrupt and execute the blocks in queue. Called
@@ -435,35 +821,79 @@ void st_cycle_start()
 {
   if (sys.state == STATE_QUEUED) {
     sys.state = STATE_CYCLE;
+    st_prep_buffer(); // Initialize step segment buffer before beginning cycle.
     st_wake_up();
   }
 }
 
-// Execute a feed hold with deceleration, only during cycle. Called by main program.
+// Execute a feed hold with deceleration, only during cycle. Called by main program. During a jog,
+// this cancels the jog instead. The deceleration is the same, but the remaining jog motions are 
+// flushed once stopped, so auto start is left as is.
 void st_feed_hold() 
 {
   if (sys.state == STATE_CYCLE) {
     sys.state = STATE_HOLD;
     sys.auto_start = false; // Disable planner auto start upon feed hold.
+  } else if (sys.state == STATE_JOG) {
+    sys.state = STATE_HOLD;
+    sys.jog_cancel = true;
+  }
+}
+
+// Applies changed feed and rapid override values to the planner buffer. Called by the main program.
+// If the first planner block is being prepped, it is replanned from the rate of the last prepped 
+// segment for the steps not yet prepped, so the override also applies to the executing block.
+// NOTE: As with a feed hold, segments already in the buffer are executed as planned.
+void st_update_overrides()
+{
+  if (prep.pl_block != NULL) {
+    plan_update_overrides(prep.step_events_remaining, prep.current_rate);
+  } else {
+    plan_update_overrides(0, 0);
   }
 }
 
-// Reinitializes the cycle plan and stepper system after a feed hold for a resume. Called by 
-// runtime command execution in the main program, ensuring that the planner re-plans safely.
+// Reinitializes the cycle plan and stepper system after the steppers have stopped, either due to a
+// completed feed hold, the end of the cycle, or a segment buffer underrun. Called by runtime command
+// execution in the main program, ensuring that the planner re-plans safely.
 // NOTE: Bresenham algorithm variables are still maintained through both the planner and stepper
-// cycle reinitializations. The stepper path should continue exactly as if nothing has happened.
-// Only the planner de/ac-celerations profiles and stepper rates have been updated.
+// cycle reinitializations. Any partially prepped block keeps its stepper block data and index, so the 
+// stepper path continues exactly as if nothing has happened. Only the planner de/ac-celerations 
+// profiles and stepper rates have been updated.
 void st_cycle_reinitialize()
 {
-  if (current_block != NULL) {
-    // Replan buffer from the feed hold stop location.
-    plan_cycle_reinitialize(current_block->step_event_count - st.step_events_completed);
-    // Update initial rate and timers after feed hold.
-    st.trapezoid_adjusted_rate = 0; // Resumes from rest
-    set_step_events_per_minute(st.trapezoid_adjusted_rate);
-    st.trapezoid_tick_cycle_counter = CYCLES_PER_ACCELERATION_TICK/2; // Start halfway for midpoint rule.
-    st.step_events_completed = 0;
+  // A cancelled jog has stopped. Discard the rest of the partially prepped block and all queued jog
+  // motions, and sync the planner and g-code parser to the stop position.
+  if (sys.jog_cancel) {
+    prep.pl_block = NULL;
+    plan_reset_buffer();
+    sys_sync_current_position();
+    sys.jog_cancel = false;
+    sys.state = STATE_IDLE;
+    return;
+  }
+  
+  block_t *pl_block = plan_get_current_block();
+  if (pl_block != NULL) {
+    // Replan buffer from the stop location. If the block was partially prepped, only the steps
+    // not yet prepped remain. Otherwise, the whole block is replanned to start from rest.
+    if (prep.pl_block != NULL) {
+      plan_cycle_reinitialize(prep.step_events_remaining);
+    } else {
+      plan_cycle_reinitialize(pl_block->step_event_count);
+    }
+    // Update initial rate after replanning. Resumes from rest.
+    prep.current_rate = plan_get_initial_rate(pl_block);
+    // A jog resumes immediately after a buffer underrun. It has no feed hold to resume from.
+    if (sys.state == STATE_JOG) {
+      st_prep_buffer(); 
+      st_wake_up();
+      return;
+    }
     sys.state = STATE_QUEUED;
+    // Resume immediately after a buffer underrun, if auto start is enabled. Auto start is disabled
+    // by a feed hold until the cycle is resumed by the user.
+    if (sys.auto_start) { st_cycle_start(); }
   } else {
     sys.state = STATE_IDLE;
   }
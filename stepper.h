@@ -31,6 +31,13 @@
 #define stepper_h 
 
 #include <avr/io.h>
+#include "config.h"
+
+// The number of constant rate step segments prepped ahead of the stepper ISR. Each segment lasts 
+// up to one acceleration tick, so this sets how far ahead of the steppers the main program works.
+#ifndef SEGMENT_BUFFER_SIZE
+  #define SEGMENT_BUFFER_SIZE 6
+#endif
 
 // Initialize and setup the stepper motor subsystem
 void st_init();
@@ -43,6 +50,9 @@ void st_go_idle();
 
 // Reset the stepper subsystem variables       
 void st_reset();
+
+// Immediately stops the stepper interrupt and discards all prepped segments. Steppers stay enabled.
+void st_halt();
              
 // Notify the stepper subsystem to start executing the g-code program in buffer.
 void st_cycle_start();
@@ -53,4 +63,31 @@ void st_cycle_reinitialize();
 // Initiates a feed hold of the running program
 void st_feed_hold();
 
+// Replans the buffer for changed feed and rapid override values
+void st_update_overrides();
+
+// Reloads step segment buffer. Called continuously by runtime execution system.
+void st_prep_buffer();
+
+// Executes a spindle or coolant planner event. See planner.h
+void st_execute_sync_event(uint8_t event, int8_t value);
+
+// Returns the current feed rate in mm/min, as prepped for the steppers.
+float st_get_realtime_rate();
+
+#ifdef STEPPER_ISR_STATS
+  // Stepper interrupt timing statistics. Cycles are CPU clock cycles.
+  typedef struct {
+    uint16_t isr_max_cycles;      // Worst step interrupt time, from the step timer compare match
+    uint32_t isr_sum_cycles;      // Sum of the sampled step interrupt times, for the average
+    uint16_t isr_count;           // Number of sampled step interrupts
+    uint16_t min_ceiling;         // Shortest unprescaled step timer ceiling, i.e. period-1. Zero if none.
+    uint32_t busy_skips;          // Step interrupts skipped, because the previous one was busy
+    uint32_t pulse_collisions;    // Step pulses started before the last pulse was reset
+  } st_stats_t;
+
+  // Copies the stepper interrupt statistics and clears them for the next measurement.
+  void st_read_stats(st_stats_t *stats);
+#endif
+
 #endif